@@ -0,0 +1,84 @@
+#include "helpers/AllocationCounter.h"
+#include "BenchmarkHarness.h"
+#include "utils/AlphabetKernel.h"
+#include "utils/BulkRandomGenerator.h"
+#include "utils/ThreadLocalRandomGenerator.h"
+#include <string>
+#include <vector>
+
+using namespace password_generator;
+using namespace password_generator::benchmarks;
+using password_generator::support::allocationCount;
+
+namespace {
+
+const char* isaName(utils::AlphabetKernel::Isa isa) {
+    switch (isa) {
+    case utils::AlphabetKernel::Isa::Sse41: return "sse4.1";
+    case utils::AlphabetKernel::Isa::Avx2: return "avx2";
+    default: return "scalar";
+    }
+}
+
+// Rows are per output character
+template <typename Fn>
+void report(const std::string& name, size_t iterations, size_t characters, Fn&& fn) {
+    size_t before = allocationCount().load();
+    fn();
+    double allocs = static_cast<double>(allocationCount().load() - before) / characters;
+    double nanos = measureNanos(iterations, fn) / characters;
+    printRow(name, nanos, allocs);
+}
+
+} // namespace
+
+int main() {
+    const std::string printable =
+        "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+        "!@#$%^&*()_+-=[]{}|;:,.<>?";
+    const size_t byteCount = 1 << 16;
+    std::vector<uint8_t> bytes(byteCount);
+    utils::ThreadLocalRandomGenerator rng;
+    utils::fillBytes(rng, bytes.data(), bytes.size());
+    std::vector<char> out(byteCount);
+
+    printHeader("AlphabetKernel::map, 64 KiB of random bytes, per character");
+    for (size_t size : {16, 62, 88}) {
+        utils::AlphabetKernel kernel(printable.substr(0, size));
+        for (auto isa : {utils::AlphabetKernel::Isa::Scalar, utils::AlphabetKernel::Isa::Sse41,
+                         utils::AlphabetKernel::Isa::Avx2}) {
+            if (!utils::AlphabetKernel::isSupported(isa)) {
+                continue;
+            }
+            size_t consumed;
+            const size_t characters = kernel.map(isa, bytes.data(), byteCount, out.data(),
+                                                 out.size(), consumed);
+            report(std::string(isaName(isa)) + " size=" + std::to_string(size), 200,
+                   characters, [&]() {
+                size_t used;
+                doNotOptimize(kernel.map(isa, bytes.data(), byteCount, out.data(), out.size(),
+                                         used));
+            });
+        }
+    }
+
+    // 10^6 passwords of 16 characters, random stream included
+    const size_t characters = 16 * 1000000;
+    std::vector<char> passwords(characters);
+    std::vector<uint32_t> indices(characters);
+    printHeader("1M x 16 characters over 88 symbols, per character");
+    report("bulk indices + table lookup", 3, characters, [&]() {
+        utils::generateIndices(rng, indices.data(), characters, 88);
+        for (size_t i = 0; i < characters; ++i) {
+            passwords[i] = printable[indices[i]];
+        }
+        doNotOptimize(passwords);
+    });
+    utils::AlphabetKernel kernel(printable);
+    report(std::string("kernel fill (") + isaName(utils::AlphabetKernel::bestIsa()) + ")", 3,
+           characters, [&]() {
+        kernel.fill(rng, passwords.data(), characters);
+        doNotOptimize(passwords);
+    });
+    return 0;
+}
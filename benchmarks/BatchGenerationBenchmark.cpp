@@ -0,0 +1,74 @@
+#include "helpers/AllocationCounter.h"
+#include "BenchmarkHarness.h"
+#include "strategies/BatchPasswordStrategy.h"
+#include "strategies/StandardPasswordStrategy.h"
+#include "strategies/PronounceablePasswordStrategy.h"
+#include "strategies/PatternPasswordStrategy.h"
+#include "providers/LowercaseProvider.h"
+#include "providers/UppercaseProvider.h"
+#include "providers/DigitProvider.h"
+#include "providers/SymbolProvider.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace password_generator;
+using namespace password_generator::benchmarks;
+using password_generator::support::allocationCount;
+
+namespace {
+
+constexpr size_t LENGTH = 16;
+
+// Rows are per password so batch sizes compare directly
+template <typename Fn>
+void report(const std::string& name, size_t count, Fn&& fn) {
+    size_t before = allocationCount().load();
+    fn();
+    double allocs = static_cast<double>(allocationCount().load() - before) / count;
+    size_t iterations = count >= 1000000 ? 3 : 2000000 / count;
+    double nanos = measureNanos(iterations, fn) / count;
+    printRow(name, nanos, allocs);
+}
+
+void compare(const char* title, strategies::IBatchPasswordStrategy& strategy) {
+    printHeader(title);
+    for (size_t count : {size_t(1), size_t(100), size_t(10000), size_t(1000000)}) {
+        std::string suffix = " N=" + std::to_string(count);
+
+        // What PasswordGenerator::generateBatch does today: N generate() calls
+        std::vector<std::string> passwords;
+        report("generate() x N" + suffix, count, [&]() {
+            passwords.clear();
+            passwords.reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                passwords.push_back(strategy.generate(LENGTH));
+            }
+            doNotOptimize(passwords);
+        });
+
+        std::vector<char> buffer(count * LENGTH);
+        report("generateBatch" + suffix, count, [&]() {
+            strategy.generateBatch(buffer.data(), count, LENGTH);
+            doNotOptimize(buffer);
+        });
+    }
+}
+
+} // namespace
+
+int main() {
+    strategies::StandardPasswordStrategy standard;
+    standard.addCharacterSet(std::make_unique<providers::LowercaseProvider>());
+    standard.addCharacterSet(std::make_unique<providers::UppercaseProvider>());
+    standard.addCharacterSet(std::make_unique<providers::DigitProvider>());
+    standard.addCharacterSet(std::make_unique<providers::SymbolProvider>());
+    compare("StandardPasswordStrategy, len=16, per password", standard);
+
+    strategies::PronounceablePasswordStrategy pronounceable;
+    compare("PronounceablePasswordStrategy, len=16, per password", pronounceable);
+
+    strategies::PatternPasswordStrategy pattern("ULLLDDSS");
+    compare("PatternPasswordStrategy ULLLDDSS, len=16, per password", pattern);
+    return 0;
+}
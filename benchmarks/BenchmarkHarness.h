@@ -0,0 +1,61 @@
+#ifndef BENCHMARK_HARNESS_H
+#define BENCHMARK_HARNESS_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+
+namespace password_generator {
+namespace benchmarks {
+
+/**
+ * @brief Keep a value observable so the optimiser cannot drop the work
+ */
+template <typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r"(&value) : "memory");
+}
+
+/**
+ * @brief Run fn iterations times after a short warm-up; returns ns per call
+ */
+template <typename Fn>
+double measureNanos(size_t iterations, Fn&& fn) {
+    for (size_t i = 0; i < iterations / 10 + 1; ++i) {
+        fn();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        fn();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+}
+
+inline void printHeader(const char* title) {
+    std::printf("\n%s\n", title);
+    std::printf("  %-36s %12s %14s\n", "case", "ns/op", "allocs/op");
+}
+
+inline void printRow(const std::string& name, double nanos, double allocs) {
+    std::printf("  %-36s %12.1f %14.2f\n", name.c_str(), nanos, allocs);
+}
+
+inline void printThroughputHeader(const char* title) {
+    std::printf("\n%s\n", title);
+    std::printf("  %-36s %12s %14s\n", "case", "GB/s", "ns/op");
+}
+
+/**
+ * @brief Row for bytes of output produced in nanos per call
+ */
+inline void printThroughputRow(const std::string& name, double bytes, double nanos) {
+    std::printf("  %-36s %12.2f %14.1f\n", name.c_str(), bytes / nanos, nanos);
+}
+
+} // namespace benchmarks
+} // namespace password_generator
+
+#endif // BENCHMARK_HARNESS_H
@@ -0,0 +1,73 @@
+#include "helpers/AllocationCounter.h"
+#include "BenchmarkHarness.h"
+#include "strategies/FixedAlphabetStrategy.h"
+#include "strategies/StandardPasswordStrategy.h"
+#include "providers/LowercaseProvider.h"
+#include "providers/UppercaseProvider.h"
+#include "providers/DigitProvider.h"
+#include "providers/SymbolProvider.h"
+#include "validators/CharacterTypeValidator.h"
+#include <memory>
+#include <string>
+
+using namespace password_generator;
+using namespace password_generator::benchmarks;
+using password_generator::support::allocationCount;
+
+namespace {
+
+using Types = validators::CharacterTypeValidator;
+
+constexpr size_t LENGTH = 16;
+constexpr unsigned ALL_TYPES = Types::UPPERCASE | Types::LOWERCASE | Types::DIGIT | Types::SYMBOL;
+
+template <typename Fn>
+void report(const std::string& name, size_t iterations, Fn&& fn) {
+    size_t before = allocationCount().load();
+    fn();
+    double allocs = static_cast<double>(allocationCount().load() - before);
+    double nanos = measureNanos(iterations, fn);
+    printRow(name, nanos, allocs);
+}
+
+} // namespace
+
+int main() {
+    const size_t iterations = 1000000;
+
+    // Same policy both ways: the four built-in sets, 16 characters, every
+    // type present
+    strategies::StandardPasswordStrategy standard;
+    standard.addCharacterSet(std::make_unique<providers::LowercaseProvider>());
+    standard.addCharacterSet(std::make_unique<providers::UppercaseProvider>());
+    standard.addCharacterSet(std::make_unique<providers::DigitProvider>());
+    standard.addCharacterSet(std::make_unique<providers::SymbolProvider>());
+
+    strategies::FixedAlphabetStrategy<strategies::alphabets::PRINTABLE, LENGTH, ALL_TYPES> fixed;
+    strategies::FixedAlphabetStrategy<strategies::alphabets::PRINTABLE, LENGTH, ALL_TYPES,
+                                      utils::ChaCha20Drbg> owned;
+
+    printHeader("88 symbols, len=16, all four types required");
+    char password[LENGTH];
+    report("Standard generate()", iterations, [&]() {
+        std::string result = standard.generate(LENGTH);
+        doNotOptimize(result);
+    });
+    report("Standard generateInto()", iterations, [&]() {
+        standard.generateInto(password, LENGTH);
+        doNotOptimize(password);
+    });
+    report("Fixed generate()", iterations, [&]() {
+        std::string result = fixed.generate(LENGTH);
+        doNotOptimize(result);
+    });
+    report("Fixed generateFixed() thread-local", iterations, [&]() {
+        fixed.generateFixed(password);
+        doNotOptimize(password);
+    });
+    report("Fixed generateFixed() own ChaCha20", iterations, [&]() {
+        owned.generateFixed(password);
+        doNotOptimize(password);
+    });
+    return 0;
+}
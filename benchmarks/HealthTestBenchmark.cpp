@@ -0,0 +1,115 @@
+#include "BenchmarkHarness.h"
+#include "utils/EntropyHealthTests.h"
+#include "utils/HardwareRandomGenerator.h"
+#include "utils/SystemEntropy.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define HAVE_X86_RNG_INSTRUCTIONS 1
+#endif
+
+using namespace password_generator;
+using namespace password_generator::benchmarks;
+
+namespace {
+
+// HardwareRandomGenerator draws and tests one APT window at a time
+constexpr size_t BLOCK = utils::EntropyHealthTests::APT_WINDOW;
+
+#if defined(HAVE_X86_RNG_INSTRUCTIONS)
+// The generator's RDRAND path without its health tests, for comparison only
+__attribute__((target("rdrnd")))
+void rdrandBlock(uint64_t* words) {
+    for (size_t i = 0; i < BLOCK / sizeof(uint64_t); ++i) {
+        unsigned long long value;
+        while (!_rdrand64_step(&value)) {
+        }
+        words[i] = value;
+    }
+}
+
+__attribute__((target("rdseed")))
+void rdseedBlock(uint64_t* words) {
+    for (size_t i = 0; i < BLOCK / sizeof(uint64_t); ++i) {
+        unsigned long long value;
+        while (!_rdseed64_step(&value)) {
+            _mm_pause();
+        }
+        words[i] = value;
+    }
+}
+#endif
+
+const char* sourceName(utils::HardwareRandomGenerator::Source source) {
+    switch (source) {
+        case utils::HardwareRandomGenerator::Source::RdSeed: return "rdseed";
+        case utils::HardwareRandomGenerator::Source::RdRand: return "rdrand";
+        case utils::HardwareRandomGenerator::Source::System: return "getrandom";
+    }
+    return "?";
+}
+
+// One row per source: raw blocks, the same blocks through the tests, and
+// HardwareRandomGenerator itself, which also copies and zeroes its block
+template <typename DrawBlock>
+void compare(utils::HardwareRandomGenerator::Source source, size_t iterations,
+             DrawBlock&& drawBlock) {
+    uint64_t words[BLOCK / sizeof(uint64_t)];
+    const std::string name = sourceName(source);
+
+    printThroughputRow(name + ", tests off", BLOCK, measureNanos(iterations, [&]() {
+        drawBlock(words);
+        doNotOptimize(words);
+    }));
+
+    utils::EntropyHealthTests health;
+    printThroughputRow(name + ", tests on", BLOCK, measureNanos(iterations, [&]() {
+        drawBlock(words);
+        doNotOptimize(health.process(reinterpret_cast<const uint8_t*>(words), BLOCK));
+    }));
+
+    utils::HardwareRandomGenerator generator(source);
+    if (generator.getSource() != source) {
+        std::printf("  (%s unavailable; generator row skipped)\n", name.c_str());
+        return;
+    }
+    uint8_t out[BLOCK];
+    printThroughputRow(name + ", HardwareRandomGenerator", BLOCK, measureNanos(iterations, [&]() {
+        generator.fillBytes(out, sizeof(out));
+        doNotOptimize(out);
+    }));
+}
+
+} // namespace
+
+// Usage: HealthTestBenchmark [blocks]
+int main(int argc, char* argv[]) {
+    const size_t iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20000;
+
+    std::vector<uint8_t> samples(BLOCK);
+    utils::fillSystemEntropy(samples.data(), samples.size());
+    utils::EntropyHealthTests health;
+    printThroughputHeader("RCT + APT alone, one 512-byte block");
+    printThroughputRow("EntropyHealthTests::process", BLOCK, measureNanos(iterations * 10, [&]() {
+        doNotOptimize(health.process(samples.data(), samples.size()));
+    }));
+
+    printThroughputHeader("512-byte block from each source, health tests off and on");
+#if defined(HAVE_X86_RNG_INSTRUCTIONS)
+    if (utils::HardwareRandomGenerator::hasRdRand()) {
+        compare(utils::HardwareRandomGenerator::Source::RdRand, iterations, rdrandBlock);
+    }
+    if (utils::HardwareRandomGenerator::hasRdSeed()) {
+        compare(utils::HardwareRandomGenerator::Source::RdSeed, iterations / 10, rdseedBlock);
+    }
+#endif
+    compare(utils::HardwareRandomGenerator::Source::System, iterations, [](uint64_t* words) {
+        utils::fillSystemEntropy(words, BLOCK);
+    });
+    return 0;
+}
@@ -0,0 +1,71 @@
+#include "BenchmarkHarness.h"
+#include "strategies/ParallelBatchGenerator.h"
+#include "strategies/StandardPasswordStrategy.h"
+#include "providers/LowercaseProvider.h"
+#include "providers/UppercaseProvider.h"
+#include "providers/DigitProvider.h"
+#include "providers/SymbolProvider.h"
+#include "utils/CpuQuota.h"
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace password_generator;
+using namespace password_generator::benchmarks;
+
+namespace {
+
+constexpr size_t LENGTH = 16;
+
+std::unique_ptr<core::interfaces::IPasswordStrategy> makeStrategy(
+    std::unique_ptr<core::interfaces::IRandomGenerator> rng) {
+    auto strategy = std::make_unique<strategies::StandardPasswordStrategy>(std::move(rng));
+    strategy->addCharacterSet(std::make_unique<providers::LowercaseProvider>());
+    strategy->addCharacterSet(std::make_unique<providers::UppercaseProvider>());
+    strategy->addCharacterSet(std::make_unique<providers::DigitProvider>());
+    strategy->addCharacterSet(std::make_unique<providers::SymbolProvider>());
+    return strategy;
+}
+
+} // namespace
+
+// Usage: ParallelBatchBenchmark [count] [max threads]
+//
+// Rows double the thread count up to max threads (default 32) whatever the
+// host, so results from different machines line up; rows beyond the CPU
+// quota are marked, since they measure oversubscription, not scaling.
+int main(int argc, char* argv[]) {
+    const size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    const size_t cpus = utils::availableCpus();
+    const size_t maxThreads = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 32;
+    std::vector<char> buffer(count * LENGTH);
+
+    std::printf("\nParallelBatchGenerator, %zu x %zu characters, %zu CPUs available\n", count,
+                LENGTH, cpus);
+    std::printf("  %-8s %14s %12s %12s\n", "threads", "passwords/s", "speedup", "efficiency");
+
+    double baseline = 0.0;
+    std::vector<size_t> threadCounts;
+    for (size_t threads = 1; threads < maxThreads; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+    for (size_t threads : threadCounts) {
+        strategies::ParallelBatchGenerator generator(makeStrategy, threads);
+        const double nanos = measureNanos(3, [&]() {
+            generator.generate(buffer.data(), count, LENGTH);
+            doNotOptimize(buffer);
+        });
+        const double rate = count / nanos * 1e9;
+        baseline = baseline > 0.0 ? baseline : rate;
+        std::printf("  %-8zu %14.0f %11.2fx %11.0f%%%s\n", threads, rate, rate / baseline,
+                    100.0 * rate / baseline / threads, threads > cpus ? "  *" : "");
+    }
+    if (maxThreads > cpus) {
+        std::printf("  * more threads than the %zu CPUs available: oversubscribed, not scaling\n",
+                    cpus);
+    }
+    return 0;
+}
@@ -0,0 +1,134 @@
+#include "helpers/AllocationCounter.h"
+#include "BenchmarkHarness.h"
+#include "utils/AlphabetKernel.h"
+#include "utils/PasswordBatch.h"
+#include "utils/SecureMemory.h"
+#include "utils/ThreadLocalRandomGenerator.h"
+#include "validators/MinLengthValidator.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace password_generator;
+using namespace password_generator::benchmarks;
+using password_generator::support::allocationCount;
+
+namespace {
+
+// Longer than the small-string buffer, so every std::string allocates
+constexpr size_t LENGTH = 16;
+
+// Discards everything, so write timings measure formatting only
+class NullBuffer : public std::streambuf {
+protected:
+    std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+    int overflow(int c) override { return c; }
+};
+
+size_t residentBytes() {
+    long pages = 0;
+    long resident = 0;
+    if (FILE* statm = std::fopen("/proc/self/statm", "r")) {
+        if (std::fscanf(statm, "%ld %ld", &pages, &resident) != 2) {
+            resident = 0;
+        }
+        std::fclose(statm);
+    }
+    return static_cast<size_t>(resident) * static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+}
+
+template <typename Fn>
+double elapsedMillis(Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+void printLayout(const char* name, size_t allocs, size_t rss, double build, double validate,
+                 double write, double wipe) {
+    std::printf("  %-24s %10zu %10.1f %10.1f %10.1f %10.1f %10.1f\n", name, allocs,
+                rss / 1048576.0, build, validate, write, wipe);
+}
+
+} // namespace
+
+// Usage: PasswordBatchBenchmark [count]
+int main(int argc, char* argv[]) {
+    const size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    const utils::AlphabetKernel kernel(
+        "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789");
+    const validators::MinLengthValidator validator(LENGTH);
+    utils::ThreadLocalRandomGenerator rng;
+    NullBuffer nullBuffer;
+    std::ostream sink(&nullBuffer);
+
+    std::printf("\nStoring %zu passwords of %zu characters\n", count, LENGTH);
+    std::printf("  %-24s %10s %10s %10s %10s %10s %10s\n", "layout", "allocs", "RSS MiB",
+                "build ms", "valid ms", "write ms", "wipe ms");
+
+    // The arena first: munmap returns its pages, so the vector starts clean
+    for (auto backing : {utils::PasswordBatch::Backing::Pages,
+                         utils::PasswordBatch::Backing::HugePages}) {
+        const size_t rssBefore = residentBytes();
+        const size_t allocsBefore = allocationCount().load();
+        utils::PasswordBatch batch;
+        const double build = elapsedMillis([&]() {
+            batch = utils::PasswordBatch(count, LENGTH, backing);
+            kernel.fill(rng, batch.data(), batch.bytes());
+        });
+        const size_t allocs = allocationCount().load() - allocsBefore;
+        const size_t rss = residentBytes() - rssBefore;
+        size_t invalid = 0;
+        const double validate = elapsedMillis([&]() {
+            invalid = batch.findInvalid(validator).size();
+        });
+        doNotOptimize(invalid);
+        const double write = elapsedMillis([&]() { batch.writeLines(sink); });
+        const double wipe = elapsedMillis([&]() { batch.wipe(); });
+        printLayout(backing == utils::PasswordBatch::Backing::Pages ? "PasswordBatch"
+                                                                    : "PasswordBatch, huge",
+                    allocs, rss, build, validate, write, wipe);
+    }
+
+    {
+        const size_t rssBefore = residentBytes();
+        const size_t allocsBefore = allocationCount().load();
+        std::vector<std::string> passwords;
+        const double build = elapsedMillis([&]() {
+            passwords.reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                std::string password(LENGTH, '\0');
+                kernel.fill(rng, &password[0], LENGTH);
+                passwords.push_back(std::move(password));
+            }
+        });
+        const size_t allocs = allocationCount().load() - allocsBefore;
+        const size_t rss = residentBytes() - rssBefore;
+        size_t invalid = 0;
+        const double validate = elapsedMillis([&]() {
+            for (const std::string& password : passwords) {
+                invalid += !validator.validate(password.data(), password.size());
+            }
+        });
+        doNotOptimize(invalid);
+        const double write = elapsedMillis([&]() {
+            for (const std::string& password : passwords) {
+                sink << password << '\n';
+            }
+        });
+        const double wipe = elapsedMillis([&]() {
+            for (std::string& password : passwords) {
+                utils::secureWipe(&password[0], password.size());
+            }
+        });
+        printLayout("vector<string>", allocs, rss, build, validate, write, wipe);
+    }
+    std::printf("  (allocs counts operator new; each arena is a single mapping)\n");
+    return 0;
+}
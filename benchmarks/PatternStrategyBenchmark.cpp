@@ -0,0 +1,39 @@
+#include "helpers/AllocationCounter.h"
+#include "BenchmarkHarness.h"
+#include "strategies/PatternPasswordStrategy.h"
+#include <string>
+
+using namespace password_generator;
+using namespace password_generator::benchmarks;
+using password_generator::support::allocationCount;
+
+int main() {
+    const size_t iterations = 200000;
+
+    struct Case {
+        const char* name;
+        const char* pattern;
+        size_t length;
+    };
+    const Case cases[] = {
+        {"classic ULL-DDD", "ULL-DDD", 7},
+        {"enrollment ENR-?d{4}-?u{4}", "ENR-?d{4}-?u{4}", 13},
+        {"hex token ?h{32}", "?h{32}", 32},
+        {"mixed L{4}D{2}[a-f0-9]{6}", "L{4}D{2}[a-f0-9]{6}", 12},
+    };
+
+    printHeader("PatternPasswordStrategy::generate (compiled program)");
+    for (const Case& c : cases) {
+        strategies::PatternPasswordStrategy strategy(c.pattern);
+        size_t before = allocationCount().load();
+        strategy.generate(c.length);
+        double allocs = static_cast<double>(allocationCount().load() - before);
+
+        double nanos = measureNanos(iterations, [&]() {
+            std::string password = strategy.generate(c.length);
+            doNotOptimize(password);
+        });
+        printRow(c.name, nanos, allocs);
+    }
+    return 0;
+}
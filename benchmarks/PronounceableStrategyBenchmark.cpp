@@ -0,0 +1,53 @@
+#include "helpers/AllocationCounter.h"
+#include "BenchmarkHarness.h"
+#include "strategies/PronounceablePasswordStrategy.h"
+#include "strategies/StandardPasswordStrategy.h"
+#include "providers/LowercaseProvider.h"
+#include "providers/UppercaseProvider.h"
+#include "providers/DigitProvider.h"
+#include "providers/SymbolProvider.h"
+#include <memory>
+#include <string>
+
+using namespace password_generator;
+using namespace password_generator::benchmarks;
+using password_generator::support::allocationCount;
+
+namespace {
+
+template <typename Fn>
+void report(const std::string& name, size_t iterations, Fn&& fn) {
+    size_t before = allocationCount().load();
+    fn();
+    double allocs = static_cast<double>(allocationCount().load() - before);
+    double nanos = measureNanos(iterations, fn);
+    printRow(name, nanos, allocs);
+}
+
+} // namespace
+
+int main() {
+    const size_t iterations = 200000;
+
+    strategies::StandardPasswordStrategy standard;
+    standard.addCharacterSet(std::make_unique<providers::LowercaseProvider>());
+    standard.addCharacterSet(std::make_unique<providers::UppercaseProvider>());
+    standard.addCharacterSet(std::make_unique<providers::DigitProvider>());
+    standard.addCharacterSet(std::make_unique<providers::SymbolProvider>());
+
+    strategies::PronounceablePasswordStrategy pronounceable;
+
+    printHeader("PronounceablePasswordStrategy vs StandardPasswordStrategy");
+    for (size_t length : {12, 16, 64}) {
+        std::string suffix = " len=" + std::to_string(length);
+        report("standard" + suffix, iterations, [&]() {
+            std::string password = standard.generate(length);
+            doNotOptimize(password);
+        });
+        report("pronounceable" + suffix, iterations, [&]() {
+            std::string password = pronounceable.generate(length);
+            doNotOptimize(password);
+        });
+    }
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include "BenchmarkHarness.h"
+#include "strategies/StandardPasswordStrategy.h"
+#include "providers/LowercaseProvider.h"
+#include "providers/UppercaseProvider.h"
+#include "providers/DigitProvider.h"
+#include "providers/SymbolProvider.h"
+#include "utils/CpuQuota.h"
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace password_generator;
+using namespace password_generator::benchmarks;
+
+namespace {
+
+constexpr size_t LENGTH = 16;
+
+std::unique_ptr<strategies::StandardPasswordStrategy> makeStrategy() {
+    auto strategy = std::make_unique<strategies::StandardPasswordStrategy>();
+    strategy->addCharacterSet(std::make_unique<providers::LowercaseProvider>());
+    strategy->addCharacterSet(std::make_unique<providers::UppercaseProvider>());
+    strategy->addCharacterSet(std::make_unique<providers::DigitProvider>());
+    strategy->addCharacterSet(std::make_unique<providers::SymbolProvider>());
+    return strategy;
+}
+
+} // namespace
+
+// One strategy called from many threads at once, each drawing from its
+// thread-local generator; compare ParallelBatchBenchmark, which gives every
+// worker its own strategy.
+// Usage: SharedStrategyBenchmark [passwords per thread] [max threads]
+int main(int argc, char* argv[]) {
+    const size_t perThread = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+    const size_t cpus = utils::availableCpus();
+    const size_t maxThreads = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : cpus;
+    auto strategy = makeStrategy();
+
+    std::printf("\nShared StandardPasswordStrategy, %zu x %zu characters per thread, "
+                "%zu CPUs available\n", perThread, LENGTH, cpus);
+    std::printf("  %-8s %14s %12s %12s\n", "threads", "passwords/s", "speedup", "efficiency");
+
+    double baseline = 0.0;
+    std::vector<size_t> threadCounts;
+    for (size_t threads = 1; threads < maxThreads; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+    for (size_t threads : threadCounts) {
+        const double nanos = measureNanos(1, [&]() {
+            std::vector<std::thread> workers;
+            for (size_t t = 0; t < threads; ++t) {
+                workers.emplace_back([&]() {
+                    for (size_t i = 0; i < perThread; ++i) {
+                        std::string password = strategy->generate(LENGTH);
+                        doNotOptimize(password);
+                    }
+                });
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        });
+        const double rate = threads * perThread / nanos * 1e9;
+        baseline = baseline > 0.0 ? baseline : rate;
+        std::printf("  %-8zu %14.0f %11.2fx %11.0f%%\n", threads, rate, rate / baseline,
+                    100.0 * rate / baseline / threads);
+    }
+    if (maxThreads > cpus) {
+        std::printf("  (rows above %zu threads oversubscribe the CPU quota)\n", cpus);
+    }
+    return 0;
+}
@@ -0,0 +1,112 @@
+#include "helpers/AllocationCounter.h"
+#include "BenchmarkHarness.h"
+#include "strategies/StandardPasswordStrategy.h"
+#include "providers/LowercaseProvider.h"
+#include "providers/UppercaseProvider.h"
+#include "providers/DigitProvider.h"
+#include "providers/SymbolProvider.h"
+#include "utils/BulkRandomGenerator.h"
+#include "utils/ThreadLocalRandomGenerator.h"
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace password_generator;
+using namespace password_generator::benchmarks;
+using password_generator::support::allocationCount;
+
+namespace {
+
+using ProviderList = std::vector<std::unique_ptr<core::interfaces::ICharacterSetProvider>>;
+
+ProviderList makeProviders() {
+    ProviderList providers;
+    providers.push_back(std::make_unique<providers::LowercaseProvider>());
+    providers.push_back(std::make_unique<providers::UppercaseProvider>());
+    providers.push_back(std::make_unique<providers::DigitProvider>());
+    providers.push_back(std::make_unique<providers::SymbolProvider>());
+    return providers;
+}
+
+// The generate path before the alphabet plan: character sets are fetched
+// from every provider and concatenated on each call
+std::string generateUncached(const ProviderList& providers,
+                             core::interfaces::IRandomGenerator& rng, size_t length) {
+    std::string allChars;
+    for (const auto& provider : providers) {
+        allChars += provider->getCharacters();
+    }
+
+    std::vector<std::string> requiredSets;
+    for (const auto& provider : providers) {
+        if (requiredSets.size() < length) {
+            std::string chars = provider->getCharacters();
+            if (!chars.empty()) {
+                requiredSets.push_back(std::move(chars));
+            }
+        }
+    }
+
+    const size_t required = requiredSets.size();
+    const size_t swaps = length > 0 ? length - 1 : 0;
+    utils::DrawBuffer draws(length + swaps);
+    for (size_t i = 0; i < required; ++i) {
+        draws[i] = static_cast<uint32_t>(requiredSets[i].length());
+    }
+    for (size_t i = required; i < length; ++i) {
+        draws[i] = static_cast<uint32_t>(allChars.length());
+    }
+    for (size_t k = 0; k < swaps; ++k) {
+        draws[length + k] = static_cast<uint32_t>(length - k);
+    }
+    draws.draw(rng);
+
+    std::string password(length, '\0');
+    for (size_t i = 0; i < required; ++i) {
+        password[i] = requiredSets[i][draws[i]];
+    }
+    for (size_t i = required; i < length; ++i) {
+        password[i] = allChars[draws[i]];
+    }
+    for (size_t k = 0; k < swaps; ++k) {
+        std::swap(password[length - 1 - k], password[draws[length + k]]);
+    }
+    return password;
+}
+
+template <typename Fn>
+void report(const std::string& name, size_t iterations, Fn&& fn) {
+    size_t before = allocationCount().load();
+    fn();
+    double allocs = static_cast<double>(allocationCount().load() - before);
+    double nanos = measureNanos(iterations, fn);
+    printRow(name, nanos, allocs);
+}
+
+} // namespace
+
+int main() {
+    const size_t iterations = 200000;
+    utils::ThreadLocalRandomGenerator rng;
+    ProviderList providers = makeProviders();
+
+    strategies::StandardPasswordStrategy strategy;
+    for (auto& provider : makeProviders()) {
+        strategy.addCharacterSet(std::move(provider));
+    }
+
+    printHeader("StandardPasswordStrategy::generate (94 symbols)");
+    for (size_t length : {16, 64}) {
+        std::string suffix = " len=" + std::to_string(length);
+        report("uncached sets" + suffix, iterations, [&]() {
+            std::string password = generateUncached(providers, rng, length);
+            doNotOptimize(password);
+        });
+        report("alphabet plan" + suffix, iterations, [&]() {
+            std::string password = strategy.generate(length);
+            doNotOptimize(password);
+        });
+    }
+    return 0;
+}
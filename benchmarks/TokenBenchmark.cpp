@@ -0,0 +1,116 @@
+#include "helpers/AllocationCounter.h"
+#include "BenchmarkHarness.h"
+#include "strategies/TokenPasswordStrategy.h"
+#include "utils/BulkRandomGenerator.h"
+#include "utils/Crc32.h"
+#include "utils/ThreadLocalRandomGenerator.h"
+#include "utils/TokenEncoding.h"
+#include <string>
+#include <vector>
+
+using namespace password_generator;
+using namespace password_generator::benchmarks;
+using password_generator::support::allocationCount;
+
+namespace {
+
+using utils::TokenEncoding;
+
+const char* encodingName(TokenEncoding encoding) {
+    switch (encoding) {
+    case TokenEncoding::Hex: return "hex";
+    case TokenEncoding::Base32: return "base32";
+    case TokenEncoding::Base58: return "base58";
+    default: return "base64url";
+    }
+}
+
+// Rows are GB/s of output, bytes per call being what fn writes
+template <typename Fn>
+void report(const std::string& name, size_t iterations, double bytes, Fn&& fn) {
+    printThroughputRow(name, bytes, measureNanos(iterations, fn));
+}
+
+} // namespace
+
+int main() {
+    const size_t inputSize = 1 << 20;
+    std::vector<uint8_t> input(inputSize);
+    utils::ThreadLocalRandomGenerator rng;
+    utils::fillBytes(rng, input.data(), input.size());
+    std::vector<char> out(2 * inputSize);
+
+    printThroughputHeader("Encoders, 1 MiB of input, GB/s of encoded output");
+    struct Encoder {
+        const char* name;
+        TokenEncoding encoding;
+        void (*encode)(const uint8_t*, size_t, char*);
+    };
+    const Encoder encoders[] = {
+        {"hex scalar", TokenEncoding::Hex, utils::encodeHexScalar},
+        {"hex simd", TokenEncoding::Hex, utils::encodeHex},
+        {"base32 scalar", TokenEncoding::Base32, utils::encodeBase32Scalar},
+        {"base32 simd", TokenEncoding::Base32, utils::encodeBase32},
+        {"base64url scalar", TokenEncoding::Base64Url, utils::encodeBase64UrlScalar},
+        {"base64url simd", TokenEncoding::Base64Url, utils::encodeBase64Url},
+    };
+    for (const Encoder& encoder : encoders) {
+        report(encoder.name, 200,
+               static_cast<double>(utils::encodedLength(encoder.encoding, inputSize)), [&]() {
+            encoder.encode(input.data(), inputSize, out.data());
+            doNotOptimize(out);
+        });
+    }
+
+    printThroughputHeader("Checksums, 1 MiB, GB/s of input");
+    report("crc32 slicing-by-8", 200, inputSize, [&]() {
+        doNotOptimize(utils::crc32(input.data(), inputSize));
+    });
+    report("crc32c", 200, inputSize, [&]() {
+        doNotOptimize(utils::crc32c(input.data(), inputSize));
+    });
+
+    // Random bytes, encoding, prefix and checksum together, as --token -b does
+    const TokenEncoding encodings[] = {TokenEncoding::Hex, TokenEncoding::Base32,
+                                       TokenEncoding::Base58, TokenEncoding::Base64Url};
+    const size_t count = 100000;
+    for (auto checksum : {strategies::TokenPasswordStrategy::Checksum::Crc32,
+                          strategies::TokenPasswordStrategy::Checksum::Crc32c}) {
+        printThroughputHeader(
+            checksum == strategies::TokenPasswordStrategy::Checksum::Crc32
+                ? "100k tokens of 32 bytes, prefix \"xyz_\", crc32, ns/op per token"
+                : "100k tokens of 32 bytes, prefix \"xyz_\", crc32c, ns/op per token");
+        for (TokenEncoding encoding : encodings) {
+            strategies::TokenPasswordStrategy strategy;
+            strategy.setEncoding(encoding);
+            strategy.setPrefix("xyz_");
+            strategy.setChecksum(checksum);
+            const size_t length = strategy.tokenLength();
+            std::vector<char> batch(count * length);
+            const double nanos = measureNanos(5, [&]() {
+                strategy.generateBatch(batch.data(), count, length);
+                doNotOptimize(batch);
+            }) / count;
+            printThroughputRow(encodingName(encoding), static_cast<double>(length), nanos);
+        }
+    }
+
+    printThroughputHeader("One token of 1 MiB, crc32c");
+    for (TokenEncoding encoding : encodings) {
+        strategies::TokenPasswordStrategy strategy;
+        strategy.setEncoding(encoding);
+        strategy.setBytes(strategies::TokenPasswordStrategy::MAX_BYTES);
+        strategy.setChecksum(strategies::TokenPasswordStrategy::Checksum::Crc32c);
+        std::vector<char> token(strategy.tokenLength());
+        strategy.generateInto(token.data(), token.size());
+        const size_t before = allocationCount().load();
+        report(encodingName(encoding), 20, static_cast<double>(token.size()), [&]() {
+            strategy.generateInto(token.data(), token.size());
+            doNotOptimize(token);
+        });
+        if (allocationCount().load() != before) {
+            std::printf("  (allocated after warm-up)\n");
+        }
+    }
+    return 0;
+}
@@ -29,6 +29,9 @@ class BatchCommand : public Command {
 private:
     size_t batchCount;
 public:
+    static constexpr size_t MAX_BATCH = 100000000;
+
+
     explicit BatchCommand(size_t count = 1) : batchCount(count) {}
     int execute(CommandContext& context) override;
 
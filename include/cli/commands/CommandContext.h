@@ -2,6 +2,15 @@
 
 #include "core/PasswordGenerator.h"
 #include "core/config/PasswordGeneratorConfig.h"
+#include "strategies/CompliantPasswordStrategy.h"
+#include "strategies/PassphrasePasswordStrategy.h"
+#include "strategies/StandardPasswordStrategy.h"
+#include "strategies/TokenPasswordStrategy.h"
+#include "strategies/UnicodePasswordStrategy.h"
+#include "strategies/UniquePasswordStrategy.h"
+#include "utils/CharacterFilter.h"
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -26,6 +35,46 @@ public:
     bool quietMode = false;
     std::string programName;
 
+    // Unique generation state (--unique, --shard, --key-file, --start)
+    bool uniqueMode = false;
+    uint64_t shardIndex = 0;
+    uint64_t shardCount = 1;
+    std::string keyFile;
+    uint64_t uniqueStart = 0;
+
+    // Relative character set weights (--weight)
+    double lowercaseWeight = 1.0;
+    double uppercaseWeight = 1.0;
+    double digitWeight = 1.0;
+    double symbolWeight = 1.0;
+
+    // Character filters (--no-ambiguous, --max-repeat, --no-adjacent, --charset-file)
+    utils::CharacterFilter filter;
+
+    // Built-in Unicode alphabets added to the enabled sets (--alphabet)
+    std::vector<std::string> unicodeAlphabets;
+
+    // Sample uniformly from passwords meeting the config's requirements (--compliant)
+    bool compliantMode = false;
+
+    // Passphrase state (--passphrase, --words, --wordlist, --separator)
+    bool passphraseMode = false;
+    size_t passphraseWords = strategies::PassphrasePasswordStrategy::DEFAULT_WORDS;
+    std::string wordListFile;
+    std::string passphraseSeparator = "-";
+    bool passphraseOptions = false;
+
+    // API token state (--token, --bytes, --prefix, --checksum)
+    bool tokenMode = false;
+    utils::TokenEncoding tokenEncoding = utils::TokenEncoding::Hex;
+    size_t tokenBytes = strategies::TokenPasswordStrategy::DEFAULT_BYTES;
+    std::string tokenPrefix;
+    strategies::TokenPasswordStrategy::Checksum tokenChecksum =
+        strategies::TokenPasswordStrategy::Checksum::Crc32;
+
+    // Batch worker threads (-j, --threads); 0 uses every CPU the cgroup quota allows
+    size_t threads = 0;
+
     // Argument processing state
     std::vector<std::string> args;
     size_t currentArgIndex = 0;
@@ -44,6 +93,37 @@ public:
     void showUsage() const;
     void showConfig() const;
 
+    // Build a unique-mode strategy from the current config, shard, key file and start position
+    std::unique_ptr<strategies::UniquePasswordStrategy> createUniqueStrategy() const;
+
+    // Tell the user, on stderr, which --start continues after this run; only
+    // meaningful, and only printed, with a persistent --key-file
+    void reportUniquePosition(const strategies::UniquePasswordStrategy& strategy) const;
+
+    // True if any --weight differs from the others
+    bool hasWeights() const;
+
+    // True if any character filter is set
+    bool hasFilters() const;
+
+    // Build a standard strategy from the current config, weights and filters
+    std::unique_ptr<strategies::StandardPasswordStrategy> createStandardStrategy() const;
+
+    // Build a compliant strategy from the current config's sets, requirements and length range
+    std::unique_ptr<strategies::CompliantPasswordStrategy> createCompliantStrategy() const;
+
+    // Build a Unicode strategy from the enabled sets and --alphabet names
+    std::unique_ptr<strategies::UnicodePasswordStrategy> createUnicodeStrategy() const;
+
+    // Build a passphrase strategy from the word list, word count and separator
+    std::unique_ptr<strategies::PassphrasePasswordStrategy> createPassphraseStrategy() const;
+
+    // Throw if options were given for a mode that is not selected
+    void checkModeOptions() const;
+
+    // Build a token strategy from the encoding, byte count, prefix and checksum
+    std::unique_ptr<strategies::TokenPasswordStrategy> createTokenStrategy() const;
+
 private:
     void showUsageImpl() const;
     void showConfigImpl() const;
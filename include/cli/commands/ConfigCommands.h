@@ -38,6 +38,22 @@ public:
     int execute(CommandContext& context) override;
 };
 
+/**
+ * Command to exclude look-alike characters such as 0/O and 1/l/I.
+ */
+class NoAmbiguousCommand : public Command {
+public:
+    int execute(CommandContext& context) override;
+};
+
+/**
+ * Command to forbid the same character twice in a row.
+ */
+class NoAdjacentCommand : public Command {
+public:
+    int execute(CommandContext& context) override;
+};
+
 /**
  * Command to enable pronounceable password generation.
  */
@@ -46,6 +62,30 @@ public:
     int execute(CommandContext& context) override;
 };
 
+/**
+ * Command to enable unique (non-repeating) password generation.
+ */
+class UniqueCommand : public Command {
+public:
+    int execute(CommandContext& context) override;
+};
+
+/**
+ * Command to enable passphrase generation from a word list.
+ */
+class PassphraseCommand : public Command {
+public:
+    int execute(CommandContext& context) override;
+};
+
+/**
+ * Command to enable uniform sampling of policy-compliant passwords.
+ */
+class CompliantCommand : public Command {
+public:
+    int execute(CommandContext& context) override;
+};
+
 /**
  * Command to enable quiet mode.
  */
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "cli/commands/Command.h"
+#include <memory>
+#include <string>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+/**
+ * Command to add a built-in Unicode alphabet to the character sets.
+ */
+class SetAlphabetCommand : public Command {
+private:
+    std::string name;
+public:
+    explicit SetAlphabetCommand(const std::string& alphabet) : name(alphabet) {}
+    int execute(CommandContext& context) override;
+
+    // Static factory method to create and parse alphabet name argument
+    static std::unique_ptr<SetAlphabetCommand> create(CommandContext& context);
+};
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
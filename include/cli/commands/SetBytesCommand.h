@@ -0,0 +1,26 @@
+#pragma once
+
+#include "cli/commands/Command.h"
+#include <memory>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+/**
+ * Command to set the random bytes per token.
+ */
+class SetBytesCommand : public Command {
+private:
+    size_t bytes;
+public:
+    explicit SetBytesCommand(size_t count) : bytes(count) {}
+    int execute(CommandContext& context) override;
+
+    // Static factory method to create and parse byte count argument
+    static std::unique_ptr<SetBytesCommand> create(CommandContext& context);
+};
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "cli/commands/Command.h"
+#include <memory>
+#include <string>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+/**
+ * Command to restrict generation to the characters listed in a file.
+ */
+class SetCharsetFileCommand : public Command {
+private:
+    std::string path;
+public:
+    explicit SetCharsetFileCommand(const std::string& file) : path(file) {}
+    int execute(CommandContext& context) override;
+
+    // Static factory method to create and parse charset file argument
+    static std::unique_ptr<SetCharsetFileCommand> create(CommandContext& context);
+};
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
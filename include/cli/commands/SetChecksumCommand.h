@@ -0,0 +1,27 @@
+#pragma once
+
+#include "cli/commands/Command.h"
+#include "strategies/TokenPasswordStrategy.h"
+#include <memory>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+/**
+ * Command to choose the checksum appended to tokens.
+ */
+class SetChecksumCommand : public Command {
+private:
+    strategies::TokenPasswordStrategy::Checksum checksum;
+public:
+    explicit SetChecksumCommand(strategies::TokenPasswordStrategy::Checksum value) : checksum(value) {}
+    int execute(CommandContext& context) override;
+
+    // Static factory method to create and parse checksum name argument
+    static std::unique_ptr<SetChecksumCommand> create(CommandContext& context);
+};
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
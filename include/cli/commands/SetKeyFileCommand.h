@@ -0,0 +1,27 @@
+#pragma once
+
+#include "cli/commands/Command.h"
+#include <memory>
+#include <string>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+/**
+ * Command to set the key file shared by unique generation shards.
+ */
+class SetKeyFileCommand : public Command {
+private:
+    std::string path;
+public:
+    explicit SetKeyFileCommand(const std::string& file) : path(file) {}
+    int execute(CommandContext& context) override;
+
+    // Static factory method to create and parse key file argument
+    static std::unique_ptr<SetKeyFileCommand> create(CommandContext& context);
+};
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
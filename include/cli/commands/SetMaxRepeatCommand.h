@@ -0,0 +1,26 @@
+#pragma once
+
+#include "cli/commands/Command.h"
+#include <memory>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+/**
+ * Command to cap how often one character may appear in a password.
+ */
+class SetMaxRepeatCommand : public Command {
+private:
+    size_t maxRepeat;
+public:
+    explicit SetMaxRepeatCommand(size_t count) : maxRepeat(count) {}
+    int execute(CommandContext& context) override;
+
+    // Static factory method to create and parse repeat limit argument
+    static std::unique_ptr<SetMaxRepeatCommand> create(CommandContext& context);
+};
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "cli/commands/Command.h"
+#include <memory>
+#include <string>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+/**
+ * Command to set the text placed before each token.
+ */
+class SetPrefixCommand : public Command {
+private:
+    std::string prefix;
+public:
+    explicit SetPrefixCommand(const std::string& text) : prefix(text) {}
+    int execute(CommandContext& context) override;
+
+    // Static factory method to create and parse prefix argument
+    static std::unique_ptr<SetPrefixCommand> create(CommandContext& context);
+};
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "cli/commands/Command.h"
+#include <memory>
+#include <string>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+/**
+ * Command to set the text placed between passphrase words.
+ */
+class SetSeparatorCommand : public Command {
+private:
+    std::string separator;
+public:
+    explicit SetSeparatorCommand(const std::string& text) : separator(text) {}
+    int execute(CommandContext& context) override;
+
+    // Static factory method to create and parse separator argument
+    static std::unique_ptr<SetSeparatorCommand> create(CommandContext& context);
+};
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "cli/commands/Command.h"
+#include <cstdint>
+#include <memory>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+/**
+ * Command to select the counter shard used by unique generation.
+ */
+class SetShardCommand : public Command {
+private:
+    uint64_t index;
+    uint64_t count;
+public:
+    SetShardCommand(uint64_t idx, uint64_t cnt) : index(idx), count(cnt) {}
+    int execute(CommandContext& context) override;
+
+    // Static factory method to create and parse an "i/N" shard argument
+    static std::unique_ptr<SetShardCommand> create(CommandContext& context);
+};
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
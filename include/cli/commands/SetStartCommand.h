@@ -0,0 +1,27 @@
+#pragma once
+
+#include "cli/commands/Command.h"
+#include <cstdint>
+#include <memory>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+/**
+ * Command to set the position unique generation resumes from.
+ */
+class SetStartCommand : public Command {
+private:
+    uint64_t position;
+public:
+    explicit SetStartCommand(uint64_t pos) : position(pos) {}
+    int execute(CommandContext& context) override;
+
+    // Static factory method to create and parse the position argument
+    static std::unique_ptr<SetStartCommand> create(CommandContext& context);
+};
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "cli/commands/Command.h"
+#include <memory>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+/**
+ * Command to set the number of threads used for batches.
+ */
+class SetThreadsCommand : public Command {
+private:
+    size_t threads;
+public:
+    explicit SetThreadsCommand(size_t count) : threads(count) {}
+    int execute(CommandContext& context) override;
+
+    // Static factory method to create and parse thread count argument
+    static std::unique_ptr<SetThreadsCommand> create(CommandContext& context);
+};
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
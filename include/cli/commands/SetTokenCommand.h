@@ -0,0 +1,27 @@
+#pragma once
+
+#include "cli/commands/Command.h"
+#include "utils/TokenEncoding.h"
+#include <memory>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+/**
+ * Command to generate API tokens with the given body encoding.
+ */
+class SetTokenCommand : public Command {
+private:
+    utils::TokenEncoding encoding;
+public:
+    explicit SetTokenCommand(utils::TokenEncoding value) : encoding(value) {}
+    int execute(CommandContext& context) override;
+
+    // Static factory method to create and parse token encoding argument
+    static std::unique_ptr<SetTokenCommand> create(CommandContext& context);
+};
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "cli/commands/Command.h"
+#include <memory>
+#include <string>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+/**
+ * Command to set the relative weight of one character set.
+ */
+class SetWeightCommand : public Command {
+private:
+    std::string set;
+    double weight;
+public:
+    SetWeightCommand(const std::string& setName, double value) : set(setName), weight(value) {}
+    int execute(CommandContext& context) override;
+
+    // Static factory method to create and parse a <set>=<weight> argument
+    static std::unique_ptr<SetWeightCommand> create(CommandContext& context);
+};
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
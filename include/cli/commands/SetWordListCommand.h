@@ -0,0 +1,27 @@
+#pragma once
+
+#include "cli/commands/Command.h"
+#include <memory>
+#include <string>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+/**
+ * Command to set the compiled word list used for passphrases.
+ */
+class SetWordListCommand : public Command {
+private:
+    std::string path;
+public:
+    explicit SetWordListCommand(const std::string& file) : path(file) {}
+    int execute(CommandContext& context) override;
+
+    // Static factory method to create and parse word list argument
+    static std::unique_ptr<SetWordListCommand> create(CommandContext& context);
+};
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
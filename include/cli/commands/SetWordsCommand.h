@@ -0,0 +1,26 @@
+#pragma once
+
+#include "cli/commands/Command.h"
+#include <memory>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+/**
+ * Command to set the number of words in a passphrase.
+ */
+class SetWordsCommand : public Command {
+private:
+    size_t words;
+public:
+    explicit SetWordsCommand(size_t count) : words(count) {}
+    int execute(CommandContext& context) override;
+
+    // Static factory method to create and parse word count argument
+    static std::unique_ptr<SetWordsCommand> create(CommandContext& context);
+};
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
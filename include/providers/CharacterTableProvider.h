@@ -0,0 +1,42 @@
+#ifndef CHARACTER_TABLE_PROVIDER_H
+#define CHARACTER_TABLE_PROVIDER_H
+
+#include "core/interfaces/ICharacterSetProvider.h"
+#include "utils/CharacterTable.h"
+#include <string>
+
+namespace password_generator {
+namespace providers {
+
+/**
+ * @brief Provider that exposes its set as a zero-copy CharacterTable
+ *
+ * getCharacters() still returns a copy for callers of the plain
+ * ICharacterSetProvider contract; table-aware callers use getTable() and
+ * never allocate.
+ */
+class ICharacterTableProvider : public core::interfaces::ICharacterSetProvider {
+public:
+    /**
+     * @brief Characters and membership map, valid while the provider is unchanged
+     */
+    virtual const utils::CharacterTable& getTable() const = 0;
+
+    std::string getCharacters() const override {
+        return std::string(getTable().characters());
+    }
+};
+
+/**
+ * @brief The provider's table, or nullptr if it only implements getCharacters()
+ */
+inline const utils::CharacterTable* characterTableOf(
+    const core::interfaces::ICharacterSetProvider& provider) {
+    auto* tableProvider = dynamic_cast<const ICharacterTableProvider*>(&provider);
+    return tableProvider ? &tableProvider->getTable() : nullptr;
+}
+
+} // namespace providers
+} // namespace password_generator
+
+#endif // CHARACTER_TABLE_PROVIDER_H
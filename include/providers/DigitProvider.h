@@ -1,7 +1,7 @@
 #ifndef DIGIT_PROVIDER_H
 #define DIGIT_PROVIDER_H
 
-#include "core/interfaces/ICharacterSetProvider.h"
+#include "providers/CharacterTableProvider.h"
 
 namespace password_generator {
 namespace providers {
@@ -9,9 +9,9 @@ namespace providers {
 /**
  * @brief Provides digits 0-9
  */
-class DigitProvider : public core::interfaces::ICharacterSetProvider {
+class DigitProvider : public ICharacterTableProvider {
 public:
-    std::string getCharacters() const override;
+    const utils::CharacterTable& getTable() const override;
     std::string getName() const override;
 };
 
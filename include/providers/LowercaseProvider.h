@@ -1,7 +1,7 @@
 #ifndef LOWERCASE_PROVIDER_H
 #define LOWERCASE_PROVIDER_H
 
-#include "core/interfaces/ICharacterSetProvider.h"
+#include "providers/CharacterTableProvider.h"
 
 namespace password_generator {
 namespace providers {
@@ -9,9 +9,9 @@ namespace providers {
 /**
  * @brief Provides lowercase letters a-z
  */
-class LowercaseProvider : public core::interfaces::ICharacterSetProvider {
+class LowercaseProvider : public ICharacterTableProvider {
 public:
-    std::string getCharacters() const override;
+    const utils::CharacterTable& getTable() const override;
     std::string getName() const override;
 };
 
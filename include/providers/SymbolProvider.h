@@ -1,7 +1,7 @@
 #ifndef SYMBOL_PROVIDER_H
 #define SYMBOL_PROVIDER_H
 
-#include "core/interfaces/ICharacterSetProvider.h"
+#include "providers/CharacterTableProvider.h"
 #include <string>
 
 namespace password_generator {
@@ -9,12 +9,17 @@ namespace providers {
 
 /**
  * @brief Provides symbol characters
+ *
+ * The custom set lives in the provider's own string and the table views
+ * it, so the table is rebuilt whenever that storage is replaced.
  */
-class SymbolProvider : public core::interfaces::ICharacterSetProvider {
+class SymbolProvider : public ICharacterTableProvider {
 public:
     explicit SymbolProvider(const std::string& symbols = "!@#$%^&*()_+-=[]{}|;:,.<>?");
+    SymbolProvider(const SymbolProvider& other);
+    SymbolProvider& operator=(const SymbolProvider& other);
     
-    std::string getCharacters() const override;
+    const utils::CharacterTable& getTable() const override;
     std::string getName() const override;
     
     /**
@@ -22,11 +27,17 @@ public:
      */
     void setSymbols(const std::string& symbols);
 
+    /**
+     * @brief Get the current symbol set
+     */
+    const std::string& getSymbols() const;
+
 private:
     std::string symbols_;
+    utils::CharacterTable table_;
 };
 
 } // namespace providers
 } // namespace password_generator
 
-#endif // SYMBOL_PROVIDER_H
\ No newline at end of file
+#endif // SYMBOL_PROVIDER_H
@@ -1,7 +1,7 @@
 #ifndef UPPERCASE_PROVIDER_H
 #define UPPERCASE_PROVIDER_H
 
-#include "core/interfaces/ICharacterSetProvider.h"
+#include "providers/CharacterTableProvider.h"
 
 namespace password_generator {
 namespace providers {
@@ -9,9 +9,9 @@ namespace providers {
 /**
  * @brief Provides uppercase letters A-Z
  */
-class UppercaseProvider : public core::interfaces::ICharacterSetProvider {
+class UppercaseProvider : public ICharacterTableProvider {
 public:
-    std::string getCharacters() const override;
+    const utils::CharacterTable& getTable() const override;
     std::string getName() const override;
 };
 
@@ -0,0 +1,76 @@
+#ifndef BATCH_PASSWORD_STRATEGY_H
+#define BATCH_PASSWORD_STRATEGY_H
+
+#include "core/interfaces/IPasswordStrategy.h"
+#include <cstddef>
+#include <string>
+
+namespace password_generator {
+namespace strategies {
+
+/**
+ * @brief Password strategy that writes into caller buffers
+ *
+ * generateInto() is the primitive: it writes one password without
+ * allocating, and generate() wraps it for callers that want a string.
+ * A batch is count passwords of one length packed back to back in a
+ * caller-provided buffer, password i at out + i * length, with no
+ * separators or terminators. Validation and setup run once per batch and
+ * the random draws of many passwords are fetched together.
+ */
+class IBatchPasswordStrategy : public core::interfaces::IPasswordStrategy {
+public:
+    /**
+     * @brief Draws fetched per random generator call during a batch
+     */
+    static constexpr size_t BATCH_CHUNK_DRAWS = 16384;
+
+    /**
+     * @brief Write one password of the given length into out
+     *
+     * out must hold length bytes; no terminator is written. Nothing is
+     * allocated for lengths whose draws fit a utils::DrawBuffer inline.
+     */
+    virtual void generateInto(char* out, size_t length) = 0;
+
+    /**
+     * @brief generateInto() a new string of the given length
+     */
+    std::string generate(size_t length) override {
+        std::string password(length, '\0');
+        generateInto(&password[0], length);
+        return password;
+    }
+
+    /**
+     * @brief Write count passwords of the given length into out
+     *
+     * out must hold count * length bytes. Each password has the
+     * distribution of one generate(length) call.
+     */
+    virtual void generateBatch(char* out, size_t count, size_t length) = 0;
+
+protected:
+    /**
+     * @brief Passwords per chunk when each one needs drawsPerPassword draws
+     */
+    static size_t batchChunk(size_t drawsPerPassword, size_t count) {
+        size_t chunk = drawsPerPassword > 0 ? BATCH_CHUNK_DRAWS / drawsPerPassword : count;
+        chunk = chunk > 0 ? chunk : 1;
+        return chunk < count ? chunk : count;
+    }
+};
+
+/**
+ * @brief Batch generation against any strategy
+ *
+ * Routes through IBatchPasswordStrategy when the strategy implements it
+ * and falls back to one generate() call per password otherwise.
+ */
+void generateBatch(core::interfaces::IPasswordStrategy& strategy, char* out, size_t count,
+                   size_t length);
+
+} // namespace strategies
+} // namespace password_generator
+
+#endif // BATCH_PASSWORD_STRATEGY_H
@@ -0,0 +1,118 @@
+#ifndef COMPLIANT_PASSWORD_STRATEGY_H
+#define COMPLIANT_PASSWORD_STRATEGY_H
+
+#include "core/interfaces/IPasswordStrategy.h"
+#include "core/interfaces/ICharacterSetProvider.h"
+#include "core/interfaces/IRandomGenerator.h"
+#include "utils/BigUint.h"
+#include "utils/CharacterFilter.h"
+#include "validators/CharacterTypeValidator.h"
+#include <memory>
+#include <string>
+
+namespace password_generator {
+namespace strategies {
+
+/**
+ * @brief Samples uniformly from exactly the passwords a type policy accepts
+ *
+ * Characters are grouped by CharacterTypeValidator::typeOf. The number of
+ * length-k strings over the alphabet that contain every type in a mask m is
+ * counted by inclusion-exclusion over the subsets S of m:
+ *
+ *     f(k, m) = sum over S of (-1)^|S| * (N - |chars of a type in S|)^k
+ *
+ * A password is one random number below the total, decoded character by
+ * character while tracking the types still missing, so there are no
+ * retries, no forced characters and no shuffle. Every accepted password
+ * is equally likely and the entropy is exactly log2 of the count.
+ */
+class CompliantPasswordStrategy : public core::interfaces::IPasswordStrategy {
+public:
+    static constexpr size_t DEFAULT_MIN_LENGTH = 8;
+    static constexpr size_t DEFAULT_MAX_LENGTH = 128;
+
+    explicit CompliantPasswordStrategy(
+        std::unique_ptr<core::interfaces::IRandomGenerator> randomGen = nullptr);
+    ~CompliantPasswordStrategy();
+
+    /**
+     * @brief Add a character set; overlapping sets are deduplicated
+     * @throws std::invalid_argument if the filter removes every character of
+     *         the set; the strategy is then unchanged
+     */
+    void addCharacterSet(std::unique_ptr<core::interfaces::ICharacterSetProvider> provider);
+
+    /**
+     * @brief Clear all character sets
+     */
+    void clearCharacterSets();
+
+    /**
+     * @brief Drop the characters a filter masks out
+     * @throws std::invalid_argument if the filter has sequence rules, which
+     *         the counts cannot express, or removes every character of a set
+     */
+    void setFilter(const utils::CharacterFilter& filter);
+
+    /**
+     * @brief Require the types a validator requires
+     */
+    void setRequirements(const validators::CharacterTypeValidator& validator);
+
+    /**
+     * @brief Require a mask of CharacterTypeValidator::Type bits
+     */
+    void setRequiredTypes(unsigned types);
+
+    /**
+     * @brief Accepted password lengths, inclusive
+     * @throws std::invalid_argument if minLength is 0 or above maxLength
+     */
+    void setLengthRange(size_t minLength, size_t maxLength);
+
+    /**
+     * @brief Exact number of compliant passwords of the given length
+     */
+    utils::BigUint getKeyspace(size_t length);
+
+    /**
+     * @brief Exact number of compliant passwords over the whole length range
+     */
+    utils::BigUint getKeyspace();
+
+    /**
+     * @brief Entropy in bits of a password of the given length
+     */
+    double getEntropyBits(size_t length);
+
+    /**
+     * @brief Entropy in bits of a password from generateInRange()
+     */
+    double getEntropyBits();
+
+    /**
+     * @brief Generate a compliant password of exactly this length
+     * @throws std::invalid_argument if length is outside the range
+     * @throws std::runtime_error if no password of this length complies
+     */
+    std::string generate(size_t length) override;
+
+    /**
+     * @brief Generate a compliant password of any length in the range
+     *
+     * Lengths are weighted by their counts, so the result is uniform over
+     * every compliant password in the range.
+     * @throws std::runtime_error if no password in the range complies
+     */
+    std::string generateInRange();
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pImpl;
+};
+
+} // namespace strategies
+} // namespace password_generator
+
+#endif // COMPLIANT_PASSWORD_STRATEGY_H
@@ -0,0 +1,237 @@
+#ifndef FIXED_ALPHABET_STRATEGY_H
+#define FIXED_ALPHABET_STRATEGY_H
+
+#include "strategies/BatchPasswordStrategy.h"
+#include "utils/IndexSampler.h"
+#include "utils/ThreadLocalRandomGenerator.h"
+#include "validators/CharacterTypeValidator.h"
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace password_generator {
+namespace strategies {
+
+/**
+ * @brief Alphabets for FixedAlphabetStrategy
+ */
+namespace alphabets {
+
+inline constexpr char ALPHANUMERIC[] =
+    "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+
+// The four built-in providers merged, in provider order
+inline constexpr char PRINTABLE[] =
+    "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+    "!@#$%^&*()_+-=[]{}|;:,.<>?";
+
+inline constexpr char HEX[] = "0123456789abcdef";
+inline constexpr char PIN[] = "0123456789";
+
+} // namespace alphabets
+
+namespace detail {
+
+template <size_t N>
+constexpr std::array<uint8_t, N> classifyAlphabet(const char* chars) {
+    std::array<uint8_t, N> types{};
+    for (size_t i = 0; i < N; ++i) {
+        types[i] = static_cast<uint8_t>(validators::CharacterTypeValidator::typeOf(chars[i]));
+    }
+    return types;
+}
+
+constexpr bool isValidAlphabet(const char* chars, size_t size) {
+    uint64_t seen[4] = {0, 0, 0, 0};
+    for (size_t i = 0; i < size; ++i) {
+        const auto byte = static_cast<unsigned char>(chars[i]);
+        if (byte == 0 || (seen[byte >> 6] >> (byte & 63)) & 1) {
+            return false;
+        }
+        seen[byte >> 6] |= uint64_t(1) << (byte & 63);
+    }
+    return true;
+}
+
+// Largest k with base^k below 2^64
+constexpr size_t digitsPerWord(uint64_t base) {
+    size_t digits = 0;
+    for (uint64_t product = 1; product <= UINT64_MAX / base; product *= base) {
+        ++digits;
+    }
+    return digits;
+}
+
+constexpr uint64_t power(uint64_t base, size_t exponent) {
+    uint64_t result = 1;
+    for (size_t i = 0; i < exponent; ++i) {
+        result *= base;
+    }
+    return result;
+}
+
+} // namespace detail
+
+/**
+ * @brief Password strategy for one policy fixed at compile time
+ *
+ * Every password is Length characters drawn uniformly from Alphabet and
+ * containing every character type in Requirements, a mask of
+ * CharacterTypeValidator::Type bits. Passwords missing a type are redrawn
+ * whole, so the result is uniform over the compliant passwords.
+ *
+ * Everything about the policy is a constant: each 64-bit word from Rng
+ * yields CHARACTERS_PER_WORD characters (the mixed-radix draw of
+ * utils::sampleBounded) with its rejection threshold computed at compile
+ * time, and each character's type bit comes from a constexpr table. Rng
+ * is any type with uint64_t next64(), e.g. utils::ChaCha20Drbg, called
+ * directly, so generateFixed() inlines into a loop with no virtual calls,
+ * providers or alphabet assembly.
+ *
+ * The IPasswordStrategy entry points accept only length Length.
+ */
+template <const auto& Alphabet, size_t Length, unsigned Requirements = 0,
+          typename Rng = utils::ThreadLocalWordSource>
+class FixedAlphabetStrategy : public IBatchPasswordStrategy {
+    static_assert(std::is_same_v<std::remove_reference_t<decltype(Alphabet)>,
+                                 const char[sizeof(Alphabet)]>,
+                  "Alphabet must be a constexpr character array");
+
+public:
+    static constexpr size_t ALPHABET_SIZE = sizeof(Alphabet) - 1;
+    static constexpr size_t LENGTH = Length;
+    static constexpr unsigned REQUIRED_TYPES = Requirements;
+    static constexpr size_t CHARACTERS_PER_WORD = detail::digitsPerWord(ALPHABET_SIZE);
+
+    template <typename... Args>
+    explicit FixedAlphabetStrategy(Args&&... args) : rng_(std::forward<Args>(args)...) {}
+
+    FixedAlphabetStrategy(const FixedAlphabetStrategy&) = delete;
+    FixedAlphabetStrategy& operator=(const FixedAlphabetStrategy&) = delete;
+
+    /**
+     * @brief Write one password of LENGTH characters into out
+     */
+    void generateFixed(char* out) {
+        unsigned present;
+        do {
+            present = 0;
+            size_t position = 0;
+            for (size_t i = 0; i < FULL_WORDS; ++i, position += CHARACTERS_PER_WORD) {
+                drawWord<CHARACTERS_PER_WORD>(out + position, present);
+            }
+            if constexpr (TAIL > 0) {
+                drawWord<TAIL>(out + position, present);
+            }
+        } while ((present & Requirements) != Requirements);
+    }
+
+    /**
+     * @throws std::invalid_argument unless length is LENGTH
+     */
+    void generateInto(char* out, size_t length) override {
+        checkLength(length);
+        generateFixed(out);
+    }
+
+    /**
+     * @throws std::invalid_argument unless length is LENGTH
+     */
+    void generateBatch(char* out, size_t count, size_t length) override {
+        checkLength(length);
+        for (size_t i = 0; i < count; ++i) {
+            generateFixed(out + i * Length);
+        }
+    }
+
+    /**
+     * @brief log2 of the number of compliant passwords
+     */
+    static double getEntropyBits() {
+        // Fraction of all strings that comply, by inclusion-exclusion over
+        // the subsets of required types that are missing
+        double compliant = 0.0;
+        for (unsigned missing = Requirements;; missing = (missing - 1) & Requirements) {
+            size_t outside = 0;
+            for (uint8_t type : TYPES) {
+                outside += (type & missing) == 0;
+            }
+            const double term = std::pow(static_cast<double>(outside) / ALPHABET_SIZE,
+                                         static_cast<double>(Length));
+            compliant += __builtin_popcount(missing) & 1 ? -term : term;
+            if (missing == 0) {
+                break;
+            }
+        }
+        return static_cast<double>(Length) * std::log2(static_cast<double>(ALPHABET_SIZE)) +
+               std::log2(compliant);
+    }
+
+private:
+    using Validator = validators::CharacterTypeValidator;
+
+    static constexpr std::array<uint8_t, ALPHABET_SIZE> TYPES =
+        detail::classifyAlphabet<ALPHABET_SIZE>(Alphabet);
+    static constexpr unsigned ALL_TYPES =
+        Validator::UPPERCASE | Validator::LOWERCASE | Validator::DIGIT | Validator::SYMBOL;
+    static constexpr size_t FULL_WORDS = Length / CHARACTERS_PER_WORD;
+    static constexpr size_t TAIL = Length % CHARACTERS_PER_WORD;
+
+    static constexpr unsigned presentTypes() {
+        unsigned present = 0;
+        for (uint8_t type : TYPES) {
+            present |= type;
+        }
+        return present;
+    }
+
+    static_assert(ALPHABET_SIZE >= 2, "Alphabet needs at least two characters");
+    static_assert(detail::isValidAlphabet(Alphabet, ALPHABET_SIZE),
+                  "Alphabet characters must be distinct and non-zero");
+    static_assert(Length > 0, "Length must be positive");
+    static_assert((Requirements & ~ALL_TYPES) == 0,
+                  "Requirements must be CharacterTypeValidator::Type bits");
+    static_assert((Requirements & ~presentTypes()) == 0,
+                  "Alphabet lacks a required character type");
+    static_assert(Length >= static_cast<size_t>(__builtin_popcount(Requirements)),
+                  "Length is too short for the required character types");
+
+    // Lemire's multiply-shift over alphabet^Digits with a constant
+    // threshold; the digits are then peeled off the accepted word by
+    // multiplication, most significant first
+    template <size_t Digits>
+    void drawWord(char* out, unsigned& present) {
+        constexpr uint64_t range = detail::power(ALPHABET_SIZE, Digits);
+        constexpr uint64_t threshold = (0 - range) % range;
+        uint64_t word, hi, lo;
+        do {
+            word = rng_.next64();
+            utils::detail::mul64x64(word, range, hi, lo);
+        } while (lo < threshold);
+        for (size_t i = 0; i < Digits; ++i) {
+            uint64_t digit;
+            utils::detail::mul64x64(word, ALPHABET_SIZE, digit, word);
+            out[i] = Alphabet[digit];
+            present |= TYPES[digit];
+        }
+    }
+
+    static void checkLength(size_t length) {
+        if (length != Length) {
+            throw std::invalid_argument("This strategy generates passwords of length " +
+                                        std::to_string(Length) + " only");
+        }
+    }
+
+    Rng rng_;
+};
+
+} // namespace strategies
+} // namespace password_generator
+
+#endif // FIXED_ALPHABET_STRATEGY_H
@@ -0,0 +1,135 @@
+#ifndef MARKOV_MODEL_H
+#define MARKOV_MODEL_H
+
+#include "utils/MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace password_generator {
+namespace strategies {
+
+/**
+ * @brief Compiled n-gram character model, memory-mapped from disk
+ *
+ * File layout (all integers little-endian):
+ * - header, 32 bytes: magic "DBGMKV1\0", order, symbol count, slot count,
+ *   context count, 8 reserved bytes
+ * - 256 bytes mapping symbol index to character; index 0 is the word
+ *   boundary, used both as start padding and as end of word
+ * - slot count (a power of two) open-addressing slots of {key, offset};
+ *   key is the packed context + 1, 0 marks an empty slot
+ * - per context, at offset: {size, total} then size entries of
+ *   {threshold, weight, symbol, alias, 2 padding bytes}
+ *
+ * A context packs the previous order - 1 symbol indices, one per byte,
+ * newest in the low byte. Each table is an integer alias table: draw a
+ * column below size and u below total; the column's symbol is chosen if
+ * u < threshold, its alias otherwise. Symbol probability is weight/total.
+ *
+ * Only the header and slot count are checked on load; each table is
+ * bounds-checked when it is looked up, so opening a large model does not
+ * touch its pages.
+ */
+class MarkovModel {
+public:
+    static constexpr size_t MIN_ORDER = 2;
+    static constexpr size_t MAX_ORDER = 4;
+    static constexpr uint8_t BOUNDARY = 0;
+
+    static constexpr char MAGIC[8] = {'D', 'B', 'G', 'M', 'K', 'V', '1', '\0'};
+    static constexpr size_t HEADER_SIZE = 32;
+    static constexpr size_t SYMBOL_TABLE_SIZE = 256;
+    static constexpr size_t SLOT_SIZE = 8;
+    static constexpr size_t TABLE_HEADER_SIZE = 8;
+    static constexpr size_t ENTRY_SIZE = 12;
+
+    /**
+     * @brief Alias table for one context
+     */
+    struct Table {
+        uint32_t size = 0;
+        uint32_t total = 0;
+        const uint8_t* entries = nullptr;
+    };
+
+    /**
+     * @brief Outcome of one draw: the symbol and its weight out of the table total
+     */
+    struct Step {
+        uint8_t symbol;
+        uint32_t weight;
+    };
+
+    /**
+     * @brief Map a compiled model
+     * @throws std::runtime_error if the file is missing or not a valid model
+     */
+    static std::shared_ptr<const MarkovModel> load(const std::string& path);
+
+    /**
+     * @brief Slot for a packed context in a table of slotCount slots
+     */
+    static uint32_t slotOf(uint32_t context, uint32_t slotCount) {
+        uint32_t hash = (context + 1) * 0x9E3779B1u;
+        return (hash ^ (hash >> 16)) & (slotCount - 1);
+    }
+
+    size_t order() const { return order_; }
+    size_t symbolCount() const { return symbolCount_; }
+
+    /**
+     * @brief Mask applied to a context after shifting in a symbol
+     */
+    uint32_t contextMask() const { return contextMask_; }
+
+    /**
+     * @brief Character for symbol indices 1..symbolCount()
+     */
+    char symbolChar(uint8_t symbol) const {
+        return static_cast<char>(file_.data()[HEADER_SIZE + symbol]);
+    }
+
+    /**
+     * @brief Symbol index of a character, or -1 if it is not in the model
+     */
+    int symbolOf(char c) const { return symbolOf_[static_cast<unsigned char>(c)]; }
+
+    /**
+     * @brief Find the table for a context
+     * @return false if the context never occurred in training
+     * @throws std::runtime_error if the table lies outside the file
+     */
+    bool lookup(uint32_t context, Table& table) const;
+
+    /**
+     * @brief Resolve a draw (column < size, u < total) against a table
+     * @throws std::runtime_error on a corrupt alias entry
+     */
+    Step sample(const Table& table, uint32_t column, uint32_t u) const;
+
+    /**
+     * @brief -log2 of the model probability of text
+     *
+     * Words in text are split at separator, which stands for the end of
+     * a word. A trailing partial word is allowed.
+     * @return infinity if the model cannot produce text
+     */
+    double surprisalBits(const std::string& text, char separator) const;
+
+private:
+    explicit MarkovModel(utils::MappedFile file);
+
+    utils::MappedFile file_;
+    size_t order_;
+    size_t symbolCount_;
+    uint32_t slotCount_;
+    uint32_t contextMask_;
+    int symbolOf_[256];
+};
+
+} // namespace strategies
+} // namespace password_generator
+
+#endif // MARKOV_MODEL_H
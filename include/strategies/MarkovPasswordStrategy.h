@@ -0,0 +1,96 @@
+#ifndef MARKOV_PASSWORD_STRATEGY_H
+#define MARKOV_PASSWORD_STRATEGY_H
+
+#include "core/interfaces/IPasswordStrategy.h"
+#include "core/interfaces/IRandomGenerator.h"
+#include "strategies/MarkovModel.h"
+#include <memory>
+#include <string>
+
+namespace password_generator {
+namespace strategies {
+
+/**
+ * @brief Pronounceable passwords sampled from an n-gram character model
+ *
+ * Characters are drawn one at a time from the model's alias table for the
+ * preceding order - 1 characters, in O(1) each. When the model ends a word
+ * the separator is emitted and a new word starts, until the password has
+ * the requested length.
+ *
+ * Because the separator marks every word end, each password has exactly
+ * one path through the model, so its surprisal -log2 P(password) under
+ * the model is exact. That is the password's entropy only while nothing
+ * is rejected; see setMinEntropyBits().
+ */
+class MarkovPasswordStrategy : public core::interfaces::IPasswordStrategy {
+public:
+    static constexpr size_t MAX_ATTEMPTS = 1000;
+
+    /**
+     * @brief Load a model written by dbgpass-train
+     * @throws std::runtime_error if the file is missing or invalid
+     */
+    explicit MarkovPasswordStrategy(
+        const std::string& modelPath,
+        std::unique_ptr<core::interfaces::IRandomGenerator> randomGen = nullptr);
+
+    /**
+     * @brief Share an already loaded model
+     */
+    explicit MarkovPasswordStrategy(
+        std::shared_ptr<const MarkovModel> model,
+        std::unique_ptr<core::interfaces::IRandomGenerator> randomGen = nullptr);
+
+    ~MarkovPasswordStrategy();
+
+    /**
+     * @brief Character emitted between words (default '-')
+     * @throws std::invalid_argument if the model also uses it as a letter
+     */
+    void setSeparator(char separator);
+
+    /**
+     * @brief Get the word separator
+     */
+    char getSeparator() const;
+
+    /**
+     * @brief Redraw passwords whose model surprisal is below this many bits
+     *
+     * Output is then drawn from the model conditioned on acceptance, where
+     * each password has probability P(password) / P(accept). Its true
+     * surprisal is lower than the model's by -log2 P(accept), which is not
+     * computed, so getLastEntropyBits() overstates it whenever redraws are
+     * possible.
+     */
+    void setMinEntropyBits(double bits);
+
+    /**
+     * @brief Model surprisal -log2 P(password) of the last password, in bits
+     *
+     * Not the entropy of the output distribution once setMinEntropyBits()
+     * rejects anything.
+     */
+    double getLastEntropyBits() const;
+
+    /**
+     * @brief The loaded model
+     */
+    const MarkovModel& getModel() const;
+
+    /**
+     * @brief Generate a password of exactly length characters
+     * @throws std::runtime_error if MAX_ATTEMPTS draws all miss the entropy minimum
+     */
+    std::string generate(size_t length) override;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pImpl;
+};
+
+} // namespace strategies
+} // namespace password_generator
+
+#endif // MARKOV_PASSWORD_STRATEGY_H
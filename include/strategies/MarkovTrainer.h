@@ -0,0 +1,73 @@
+#ifndef MARKOV_TRAINER_H
+#define MARKOV_TRAINER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace password_generator {
+namespace strategies {
+
+/**
+ * @brief Counts n-grams from a corpus and compiles them into a MarkovModel file
+ *
+ * Each word is padded with order - 1 boundary symbols in front and one
+ * after, so the model learns how words start and end. Any byte other than
+ * NUL and ASCII whitespace may appear in a word; at most 255 distinct
+ * bytes are supported.
+ */
+class MarkovTrainer {
+public:
+    /**
+     * @brief How addText() splits a corpus into words
+     */
+    struct TextOptions {
+        bool lowercase = false;     ///< Fold ASCII letters to lowercase
+        bool lettersOnly = false;   ///< Split at ASCII non-letters (bytes >= 0x80 are kept)
+    };
+
+    /**
+     * @throws std::invalid_argument unless order is 2-4
+     */
+    explicit MarkovTrainer(size_t order);
+    ~MarkovTrainer();
+
+    /**
+     * @brief Count one word
+     * @throws std::invalid_argument if the word contains NUL or whitespace,
+     *         or adds a 256th distinct byte
+     */
+    void addWord(const std::string& word);
+
+    /**
+     * @brief Count every word in a stream
+     */
+    void addText(std::istream& in, const TextOptions& options);
+
+    size_t order() const;
+    size_t wordCount() const;
+    size_t contextCount() const;
+
+    /**
+     * @brief Serialize the model in the MarkovModel file format
+     * @throws std::runtime_error if no words were added
+     */
+    std::vector<uint8_t> compile() const;
+
+    /**
+     * @brief compile() and write the result to a file
+     */
+    void write(const std::string& path) const;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pImpl;
+};
+
+} // namespace strategies
+} // namespace password_generator
+
+#endif // MARKOV_TRAINER_H
@@ -0,0 +1,98 @@
+#ifndef PARALLEL_BATCH_GENERATOR_H
+#define PARALLEL_BATCH_GENERATOR_H
+
+#include "core/interfaces/IPasswordStrategy.h"
+#include "core/interfaces/IRandomGenerator.h"
+#include "utils/ChaCha20Drbg.h"
+#include "utils/PasswordBatch.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace password_generator {
+namespace strategies {
+
+/**
+ * @brief Fills large batches on a pool of threads
+ *
+ * A batch is count passwords of one length back to back, as in
+ * IBatchPasswordStrategy::generateBatch. It is cut into slices of
+ * SLICE_PASSWORDS; slice i always lands at the same offset, so output
+ * order does not depend on which thread fills it.
+ *
+ * Each worker has its own strategy, made by the factory the first time the
+ * worker runs, and its own random generator, so workers share nothing but
+ * the output buffer. Workers start with equal runs of slices and take from
+ * the front of their own run; a worker that runs out steals the back half
+ * of the largest remaining run. Each run is one atomic word on its own
+ * cache line.
+ *
+ * The generator handed to the factory draws from the worker thread's
+ * ThreadLocalRandomGenerator. After setSeed() it instead restarts every
+ * slice from a ChaCha20 stream keyed by the seed and the slice index, so
+ * a seeded batch is the same for any thread count. Strategies that ignore
+ * the generator they are given are not affected by the seed.
+ *
+ * Not thread-safe: one batch at a time per instance.
+ */
+class ParallelBatchGenerator {
+public:
+    /**
+     * @brief Builds one worker's strategy around the generator it should use
+     *
+     * Called from worker threads, possibly concurrently.
+     */
+    using StrategyFactory = std::function<std::unique_ptr<core::interfaces::IPasswordStrategy>(
+        std::unique_ptr<core::interfaces::IRandomGenerator>)>;
+
+    static constexpr size_t SLICE_PASSWORDS = 1024;
+
+    /**
+     * @param threads Workers including the calling thread; 0 for
+     *        utils::availableCpus()
+     */
+    explicit ParallelBatchGenerator(StrategyFactory factory, size_t threads = 0);
+    ~ParallelBatchGenerator();
+
+    ParallelBatchGenerator(const ParallelBatchGenerator&) = delete;
+    ParallelBatchGenerator& operator=(const ParallelBatchGenerator&) = delete;
+
+    size_t threadCount() const;
+
+    /**
+     * @brief Make every later batch a function of the seed alone
+     */
+    void setSeed(const uint8_t (&seed)[utils::ChaCha20Drbg::KEY_SIZE]);
+
+    /**
+     * @brief Draw from the per-thread generators again
+     */
+    void clearSeed();
+
+    /**
+     * @brief Write count passwords of the given length into out
+     *
+     * Threads beyond one per slice are not woken. The calling thread works
+     * as worker 0.
+     * @throws Whatever the factory or a strategy throws, after every
+     *         worker has stopped
+     */
+    void generate(char* out, size_t count, size_t length);
+
+    /**
+     * @brief generate() into a new batch of count passwords
+     */
+    utils::PasswordBatch generate(size_t count, size_t length,
+                                  utils::PasswordBatch::Backing backing =
+                                      utils::PasswordBatch::Backing::Pages);
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pImpl;
+};
+
+} // namespace strategies
+} // namespace password_generator
+
+#endif // PARALLEL_BATCH_GENERATOR_H
@@ -0,0 +1,113 @@
+#ifndef PASSPHRASE_PASSWORD_STRATEGY_H
+#define PASSPHRASE_PASSWORD_STRATEGY_H
+
+#include "core/interfaces/IPasswordStrategy.h"
+#include "core/interfaces/IRandomGenerator.h"
+#include "strategies/WordList.h"
+#include "utils/BigUint.h"
+#include <memory>
+#include <string>
+
+namespace password_generator {
+namespace strategies {
+
+/**
+ * @brief Diceware-style passphrases drawn from a compiled word list
+ *
+ * Words are picked independently and uniformly with unbiased index
+ * sampling; all indices for a passphrase come from one bulk draw. Optional
+ * digits are appended to distinct, uniformly chosen words, so every
+ * configuration has an exact keyspace:
+ *
+ *     size^words * C(words, digits) * 10^digits
+ *
+ * Capitalization upper-cases the first ASCII letter of every word and adds
+ * no entropy.
+ *
+ * The keyspace is only exact if every passphrase has one reading, so
+ * generate() and getKeyspace() reject options under which two choices
+ * print the same: an empty separator or one that occurs in a word,
+ * capitalization when the list holds both "apple" and "Apple", and digits
+ * when a word already ends in one. The list is checked once after each
+ * option change.
+ */
+class PassphrasePasswordStrategy : public core::interfaces::IPasswordStrategy {
+public:
+    static constexpr size_t DEFAULT_WORDS = 6;
+
+    /**
+     * @brief Load a list written by dbgpass-wordlist
+     * @throws std::runtime_error if the file is missing or invalid
+     */
+    explicit PassphrasePasswordStrategy(
+        const std::string& wordListPath,
+        std::unique_ptr<core::interfaces::IRandomGenerator> randomGen = nullptr);
+
+    /**
+     * @brief Share an already loaded list
+     */
+    explicit PassphrasePasswordStrategy(
+        std::shared_ptr<const WordList> wordList,
+        std::unique_ptr<core::interfaces::IRandomGenerator> randomGen = nullptr);
+
+    ~PassphrasePasswordStrategy();
+
+    /**
+     * @brief Number of words per passphrase
+     * @throws std::invalid_argument if zero or fewer than the digit count
+     */
+    void setWordCount(size_t words);
+    size_t getWordCount() const;
+
+    /**
+     * @brief String placed between words (default "-")
+     *
+     * Must be non-empty and occur in no word; see getKeyspace().
+     */
+    void setSeparator(const std::string& separator);
+
+    /**
+     * @brief Upper-case the first letter of each word
+     */
+    void setCapitalize(bool capitalize);
+
+    /**
+     * @brief Append a random digit to this many distinct words
+     * @throws std::invalid_argument if more than the word count
+     */
+    void setDigitCount(size_t digits);
+
+    /**
+     * @brief The loaded word list
+     */
+    const WordList& getWordList() const;
+
+    /**
+     * @brief Exact number of distinct passphrases
+     * @throws std::invalid_argument if the options make two passphrases
+     *         print the same
+     */
+    utils::BigUint getKeyspace() const;
+
+    /**
+     * @brief Entropy in bits of one passphrase
+     */
+    double getEntropyBits() const;
+
+    /**
+     * @brief Generate a passphrase
+     *
+     * The length argument is ignored; the word count sets the size.
+     * @throws std::invalid_argument as getKeyspace()
+     */
+    std::string generate(size_t length) override;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pImpl;
+};
+
+} // namespace strategies
+} // namespace password_generator
+
+#endif // PASSPHRASE_PASSWORD_STRATEGY_H
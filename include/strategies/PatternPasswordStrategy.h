@@ -1,8 +1,10 @@
 #ifndef PATTERN_PASSWORD_STRATEGY_H
 #define PATTERN_PASSWORD_STRATEGY_H
 
-#include "core/interfaces/IPasswordStrategy.h"
+#include "strategies/BatchPasswordStrategy.h"
 #include "core/interfaces/IRandomGenerator.h"
+#include "strategies/PatternProgram.h"
+#include "utils/BigUint.h"
 #include <memory>
 #include <string>
 
@@ -18,8 +20,11 @@ namespace strategies {
  * - 'D' = digit
  * - 'S' = symbol
  * - Other characters are used literally
+ *
+ * Patterns also accept repeat counts, inline classes, escapes and hashcat
+ * masks; see PatternProgram. They are compiled once in setPattern().
  */
-class PatternPasswordStrategy : public core::interfaces::IPasswordStrategy {
+class PatternPasswordStrategy : public IBatchPasswordStrategy {
 public:
     explicit PatternPasswordStrategy(
         const std::string& pattern,
@@ -27,7 +32,8 @@ public:
     ~PatternPasswordStrategy();
     
     /**
-     * @brief Set the password pattern
+     * @brief Set and compile the password pattern
+     * @throws std::invalid_argument on malformed syntax
      */
     void setPattern(const std::string& pattern);
     
@@ -37,9 +43,36 @@ public:
     const std::string& getPattern() const;
     
     /**
-     * @brief Generate password based on pattern
+     * @brief Define hashcat custom charset ?1 to ?4, e.g. "?l?d" or "abc"
      */
-    std::string generate(size_t length) override;
+    void setCustomCharset(int index, const std::string& definition);
+    
+    /**
+     * @brief The compiled pattern
+     */
+    const PatternProgram& getProgram() const;
+    
+    /**
+     * @brief Exact number of distinct passwords of the given length
+     */
+    utils::BigUint getKeyspace(size_t length) const;
+    
+    /**
+     * @brief Entropy in bits of a password of the given length
+     */
+    double getEntropyBits(size_t length) const;
+    
+    /**
+     * @brief Generate password based on pattern into out, which must hold length bytes
+     */
+    void generateInto(char* out, size_t length) override;
+    
+    /**
+     * @brief Generate count passwords into out, back to back
+     *
+     * Uses the same draws as count generate() calls.
+     */
+    void generateBatch(char* out, size_t count, size_t length) override;
 
 private:
     class Impl;
@@ -0,0 +1,91 @@
+#ifndef PATTERN_PROGRAM_H
+#define PATTERN_PROGRAM_H
+
+#include "utils/BigUint.h"
+#include "utils/CharacterTable.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace password_generator {
+namespace strategies {
+
+/**
+ * @brief A password pattern compiled into a flat list of ops
+ *
+ * Pattern syntax:
+ * - `L` `U` `D` `S`: lowercase, uppercase, digit, symbol
+ * - `?l` `?u` `?d` `?s` `?a` `?h` `?H`: hashcat masks (lower, upper,
+ *   digit, hashcat symbols, all printable, lower hex, upper hex)
+ * - `?1` to `?4`: custom charsets; `??` is a literal `?`
+ * - `[a-f0-9]`: inline class with ranges; `\` escapes inside brackets
+ * - `{n}`: repeat the previous token n times
+ * - `\x`: literal x, e.g. `\L` for a literal L
+ * - Anything else is a literal
+ *
+ * Adjacent literals become one run and adjacent uses of one class become
+ * one op, so executing the program is a handful of memcpys and one bulk
+ * draw per class op.
+ */
+class PatternProgram {
+public:
+    static constexpr size_t MAX_REPEAT = 4096;
+    static constexpr int CUSTOM_CHARSETS = 4;
+
+    using CustomCharsets = std::array<std::string, CUSTOM_CHARSETS>;
+
+    struct Op {
+        enum class Kind { Literal, Class };
+        Kind kind;
+        uint32_t count;   ///< Output positions covered
+        uint32_t index;   ///< Literal: offset into literals(); Class: class index
+    };
+
+    PatternProgram() = default;
+    PatternProgram(PatternProgram&&) = default;
+    PatternProgram& operator=(PatternProgram&&) = default;
+    PatternProgram(const PatternProgram&) = delete;
+    PatternProgram& operator=(const PatternProgram&) = delete;
+
+    /**
+     * @brief Compile a pattern
+     * @throws std::invalid_argument on malformed syntax
+     */
+    static PatternProgram compile(const std::string& pattern, const CustomCharsets& custom = {});
+
+    const std::vector<Op>& ops() const { return ops_; }
+    const char* literals() const { return literals_.data(); }
+    const utils::CharacterTable& characterClass(uint32_t index) const { return classes_[index]; }
+
+    /**
+     * @brief Output positions in one pass of the pattern
+     */
+    size_t length() const { return length_; }
+    bool empty() const { return length_ == 0; }
+
+    /**
+     * @brief Exact number of distinct outputs for `outputLength` characters
+     *
+     * Patterns shorter than outputLength repeat, as in generation.
+     */
+    utils::BigUint keyspace(size_t outputLength) const;
+
+    /**
+     * @brief log2 of keyspace(outputLength)
+     */
+    double entropyBits(size_t outputLength) const;
+
+private:
+    std::vector<Op> ops_;
+    std::vector<char> literals_;
+    std::vector<char> classPool_;
+    std::vector<utils::CharacterTable> classes_;
+    size_t length_ = 0;
+};
+
+} // namespace strategies
+} // namespace password_generator
+
+#endif // PATTERN_PROGRAM_H
@@ -1,7 +1,7 @@
 #ifndef PRONOUNCEABLE_PASSWORD_STRATEGY_H
 #define PRONOUNCEABLE_PASSWORD_STRATEGY_H
 
-#include "core/interfaces/IPasswordStrategy.h"
+#include "strategies/BatchPasswordStrategy.h"
 #include "core/interfaces/IRandomGenerator.h"
 #include <memory>
 
@@ -11,16 +11,21 @@ namespace strategies {
 /**
  * @brief Generates pronounceable passwords using syllables
  */
-class PronounceablePasswordStrategy : public core::interfaces::IPasswordStrategy {
+class PronounceablePasswordStrategy : public IBatchPasswordStrategy {
 public:
     explicit PronounceablePasswordStrategy(
         std::unique_ptr<core::interfaces::IRandomGenerator> randomGen = nullptr);
     ~PronounceablePasswordStrategy();
     
     /**
-     * @brief Generate pronounceable password
+     * @brief Generate pronounceable password into out, which must hold length bytes
      */
-    std::string generate(size_t length) override;
+    void generateInto(char* out, size_t length) override;
+    
+    /**
+     * @brief Generate count pronounceable passwords into out, back to back
+     */
+    void generateBatch(char* out, size_t count, size_t length) override;
     
     /**
      * @brief Set whether to include numbers
@@ -0,0 +1,77 @@
+#ifndef REGEX_DFA_H
+#define REGEX_DFA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace password_generator {
+namespace strategies {
+
+/**
+ * @brief Deterministic automaton for a restricted regular expression
+ *
+ * Supported syntax, matched against the whole password over printable
+ * ASCII (0x20-0x7E):
+ * - literals, `.`, `\d` `\w` `\s`, `\x` for a literal x
+ * - classes `[a-z0-9_]` and negated classes `[^...]`
+ * - groups `(...)` / `(?:...)`, alternation `|`
+ * - quantifiers `?` `*` `+` `{n}` `{n,}` `{n,m}`
+ * - an optional leading `^` and trailing `$`
+ *
+ * Characters that the expression never distinguishes are merged into one
+ * equivalence class, so transitions are indexed by class, not by byte.
+ * Compiled automata are immutable and can be shared between threads.
+ */
+class RegexDfa {
+public:
+    static constexpr size_t MAX_STATES = 4096;
+    static constexpr size_t MAX_REPEAT = 1000;
+
+    /**
+     * @brief Compile an expression
+     * @throws std::invalid_argument on unsupported or malformed syntax
+     */
+    static std::shared_ptr<const RegexDfa> compile(const std::string& pattern);
+
+    /**
+     * @brief Compile through a process-wide cache keyed by the expression
+     */
+    static std::shared_ptr<const RegexDfa> compileCached(const std::string& pattern);
+
+    size_t stateCount() const { return accepting_.size(); }
+    size_t classCount() const { return classes_.size(); }
+    int startState() const { return 0; }
+
+    bool isAccepting(int state) const { return accepting_[state]; }
+
+    /**
+     * @brief Target of state on class, or -1 for the dead state
+     */
+    int transition(int state, size_t cls) const {
+        return transitions_[static_cast<size_t>(state) * classes_.size() + cls];
+    }
+
+    /**
+     * @brief Characters in an equivalence class
+     */
+    const std::string& classMembers(size_t cls) const { return classes_[cls]; }
+
+    /**
+     * @brief True if the whole string is matched
+     */
+    bool matches(const std::string& text) const;
+
+private:
+    std::vector<std::string> classes_;
+    std::vector<uint8_t> classOf_;          // byte -> class, 0xff if outside alphabet
+    std::vector<int> transitions_;
+    std::vector<bool> accepting_;
+};
+
+} // namespace strategies
+} // namespace password_generator
+
+#endif // REGEX_DFA_H
@@ -0,0 +1,70 @@
+#ifndef REGEX_PASSWORD_STRATEGY_H
+#define REGEX_PASSWORD_STRATEGY_H
+
+#include "core/interfaces/IPasswordStrategy.h"
+#include "core/interfaces/IRandomGenerator.h"
+#include "strategies/RegexDfa.h"
+#include "utils/BigUint.h"
+#include <memory>
+#include <string>
+
+namespace password_generator {
+namespace strategies {
+
+/**
+ * @brief Samples uniformly from the strings of a given length that match a regex
+ *
+ * The expression is compiled to a RegexDfa (see there for the syntax) and
+ * shared through the process-wide cache. For each remaining length the
+ * strategy counts accepted completions from every state; a password is then
+ * one random number below the total, decoded state by state in a single
+ * pass. Counts are built lazily up to the longest length requested.
+ */
+class RegexPasswordStrategy : public core::interfaces::IPasswordStrategy {
+public:
+    explicit RegexPasswordStrategy(
+        const std::string& regex,
+        std::unique_ptr<core::interfaces::IRandomGenerator> randomGen = nullptr);
+    ~RegexPasswordStrategy();
+
+    /**
+     * @brief Replace the expression
+     * @throws std::invalid_argument on malformed syntax; the old one is kept
+     */
+    void setRegex(const std::string& regex);
+
+    /**
+     * @brief Get the current expression
+     */
+    const std::string& getRegex() const;
+
+    /**
+     * @brief The compiled automaton
+     */
+    const RegexDfa& getDfa() const;
+
+    /**
+     * @brief Exact number of matching passwords of the given length
+     */
+    utils::BigUint getKeyspace(size_t length);
+
+    /**
+     * @brief Entropy in bits of a password of the given length
+     */
+    double getEntropyBits(size_t length);
+
+    /**
+     * @brief Generate a matching password
+     * @throws std::runtime_error if no string of this length matches
+     */
+    std::string generate(size_t length) override;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pImpl;
+};
+
+} // namespace strategies
+} // namespace password_generator
+
+#endif // REGEX_PASSWORD_STRATEGY_H
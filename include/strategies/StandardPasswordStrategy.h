@@ -1,9 +1,10 @@
 #ifndef STANDARD_PASSWORD_STRATEGY_H
 #define STANDARD_PASSWORD_STRATEGY_H
 
-#include "core/interfaces/IPasswordStrategy.h"
+#include "strategies/BatchPasswordStrategy.h"
 #include "core/interfaces/ICharacterSetProvider.h"
 #include "core/interfaces/IRandomGenerator.h"
+#include "utils/CharacterFilter.h"
 #include <memory>
 #include <vector>
 
@@ -13,7 +14,7 @@ namespace strategies {
 /**
  * @brief Standard password generation strategy using character sets
  */
-class StandardPasswordStrategy : public core::interfaces::IPasswordStrategy {
+class StandardPasswordStrategy : public IBatchPasswordStrategy {
 public:
     explicit StandardPasswordStrategy(
         std::unique_ptr<core::interfaces::IRandomGenerator> randomGen = nullptr);
@@ -21,8 +22,16 @@ public:
     
     /**
      * @brief Add a character set to use for generation
+     *
+     * Characters of the set are drawn with relative weight `weight`
+     * (a character shared by several sets takes the first set's weight).
+     * With unequal weights, free positions are sampled through an alias
+     * table; the one guaranteed character per set stays uniform.
+     * @throws std::invalid_argument if weight is not positive and finite, or
+     *         the filter removes every character of the set
      */
-    void addCharacterSet(std::unique_ptr<core::interfaces::ICharacterSetProvider> provider);
+    void addCharacterSet(std::unique_ptr<core::interfaces::ICharacterSetProvider> provider,
+                         double weight = 1.0);
     
     /**
      * @brief Clear all character sets
@@ -30,9 +39,37 @@ public:
     void clearCharacterSets();
     
     /**
-     * @brief Generate password
+     * @brief Restrict the characters and sequences that may be generated
+     *
+     * The filter's mask is applied to every set when the alphabet is
+     * compiled. Sequence rules are checked as characters are placed; a
+     * rejected character is redrawn from the same set, never the password.
+     * @throws std::invalid_argument if the mask removes every character of a
+     *         set, whose guaranteed character could then not be placed; the
+     *         previous filter is kept
      */
-    std::string generate(size_t length) override;
+    void setFilter(const utils::CharacterFilter& filter);
+    
+    /**
+     * @brief Shannon entropy of length characters drawn from the weighted alphabet
+     *
+     * Filter sequence rules are not accounted for, so with them this is an
+     * upper bound.
+     */
+    double getEntropyBits(size_t length) const;
+    
+    /**
+     * @brief Generate password into out, which must hold length bytes
+     */
+    void generateInto(char* out, size_t length) override;
+    
+    /**
+     * @brief Generate count passwords into out, back to back
+     *
+     * Draws are fetched a chunk of passwords at a time; without sequence
+     * rules they are the same draws as count generate() calls.
+     */
+    void generateBatch(char* out, size_t count, size_t length) override;
 
 private:
     class Impl;
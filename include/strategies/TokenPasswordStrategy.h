@@ -0,0 +1,138 @@
+#ifndef TOKEN_PASSWORD_STRATEGY_H
+#define TOKEN_PASSWORD_STRATEGY_H
+
+#include "core/interfaces/IRandomGenerator.h"
+#include "strategies/BatchPasswordStrategy.h"
+#include "utils/TokenEncoding.h"
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace password_generator {
+namespace strategies {
+
+/**
+ * @brief API keys and secrets: prefix, encoded random bytes, checksum
+ *
+ * A token is the prefix, then the body, then an optional checksum. The
+ * body encodes getBytes() random bytes fetched in one bulk draw (a batch
+ * fetches many tokens' bytes per call) with the SIMD encoders of
+ * utils/TokenEncoding.h; base58 bodies are drawn directly as base58
+ * characters with a utils::AlphabetKernel, which is uniform and avoids
+ * big-number conversion.
+ *
+ * The checksum is the CRC-32 or CRC-32C of the body, written as fixed
+ * width digits of the body's encoding, as in GitHub's token format, so
+ * secret scanners can tell real tokens from random strings offline.
+ *
+ * Every token of one configuration has tokenLength() characters, and the
+ * IPasswordStrategy entry points accept only that length.
+ */
+class TokenPasswordStrategy : public IBatchPasswordStrategy {
+public:
+    enum class Checksum {
+        None,
+        Crc32,
+        Crc32c
+    };
+
+    static constexpr size_t DEFAULT_BYTES = 32;
+    static constexpr size_t MIN_BYTES = 16;
+    static constexpr size_t MAX_BYTES = size_t(1) << 20;
+    static constexpr size_t MAX_PREFIX = 64;
+
+    explicit TokenPasswordStrategy(
+        std::unique_ptr<core::interfaces::IRandomGenerator> randomGen = nullptr);
+    ~TokenPasswordStrategy();
+
+    /**
+     * @brief Body encoding (default hex)
+     */
+    void setEncoding(utils::TokenEncoding encoding);
+    utils::TokenEncoding getEncoding() const;
+
+    /**
+     * @brief Random bytes per token (default DEFAULT_BYTES)
+     * @throws std::invalid_argument unless between MIN_BYTES and MAX_BYTES
+     */
+    void setBytes(size_t bytes);
+    size_t getBytes() const;
+
+    /**
+     * @brief Text placed before the body, e.g. "xyz_"
+     * @throws std::invalid_argument if longer than MAX_PREFIX or not
+     *         printable ASCII without spaces
+     */
+    void setPrefix(const std::string& prefix);
+    const std::string& getPrefix() const;
+
+    /**
+     * @brief Checksum appended to the body (default Checksum::Crc32)
+     */
+    void setChecksum(Checksum checksum);
+    Checksum getChecksum() const;
+
+    /**
+     * @brief Parse "hex", "base32", "base58" or "base64url"
+     * @throws std::invalid_argument for any other name
+     */
+    static utils::TokenEncoding parseEncoding(const std::string& name);
+
+    /**
+     * @brief Parse "crc32", "crc32c" or "none"
+     * @throws std::invalid_argument for any other name
+     */
+    static Checksum parseChecksum(const std::string& name);
+
+    /**
+     * @brief Characters in the body alone
+     */
+    size_t bodyLength() const;
+
+    /**
+     * @brief Characters in the checksum, 0 without one
+     */
+    size_t checksumLength() const;
+
+    /**
+     * @brief Characters in a whole token
+     */
+    size_t tokenLength() const;
+
+    /**
+     * @brief Entropy in bits of one token; only the body is random
+     */
+    double getEntropyBits() const;
+
+    /**
+     * @brief True if token has this configuration's prefix, length and
+     *        alphabet and its checksum matches its body
+     *
+     * Always false when no checksum is configured.
+     */
+    bool verifyChecksum(std::string_view token) const;
+
+    /**
+     * @brief generateInto() a new string of tokenLength() characters
+     */
+    std::string generateToken();
+
+    /**
+     * @throws std::invalid_argument unless length is tokenLength()
+     */
+    void generateInto(char* out, size_t length) override;
+
+    /**
+     * @throws std::invalid_argument unless length is tokenLength()
+     */
+    void generateBatch(char* out, size_t count, size_t length) override;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pImpl;
+};
+
+} // namespace strategies
+} // namespace password_generator
+
+#endif // TOKEN_PASSWORD_STRATEGY_H
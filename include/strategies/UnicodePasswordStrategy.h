@@ -0,0 +1,80 @@
+#ifndef UNICODE_PASSWORD_STRATEGY_H
+#define UNICODE_PASSWORD_STRATEGY_H
+
+#include "core/interfaces/IPasswordStrategy.h"
+#include "core/interfaces/ICharacterSetProvider.h"
+#include "core/interfaces/IRandomGenerator.h"
+#include "utils/Utf8Alphabet.h"
+#include "validators/CharacterTypeValidator.h"
+#include <memory>
+#include <string>
+
+namespace password_generator {
+namespace strategies {
+
+/**
+ * @brief Draws passwords uniformly from an alphabet of Unicode code points
+ *
+ * Lengths are in code points. All indices for a password come from one
+ * bulk draw, and each character is a fixed-size copy of its pre-encoded
+ * UTF-8 bytes from a utils::Utf8Alphabet.
+ *
+ * Required character types are met the way StandardPasswordStrategy meets
+ * its sets: one code point of each required type, by
+ * CharacterTypeValidator::typeOf(char32_t), the rest from the whole
+ * alphabet, then a shuffle so the guaranteed ones can land anywhere.
+ */
+class UnicodePasswordStrategy : public core::interfaces::IPasswordStrategy {
+public:
+    explicit UnicodePasswordStrategy(
+        std::unique_ptr<core::interfaces::IRandomGenerator> randomGen = nullptr);
+    ~UnicodePasswordStrategy();
+
+    /**
+     * @brief Add code points to the alphabet; duplicates are merged
+     */
+    void addAlphabet(const utils::Utf8Alphabet& alphabet);
+
+    /**
+     * @brief Add a provider's characters, read as UTF-8
+     * @throws std::invalid_argument if they are malformed or invisible
+     */
+    void addCharacterSet(std::unique_ptr<core::interfaces::ICharacterSetProvider> provider);
+
+    /**
+     * @brief Require the types a validator requires, one code point each
+     */
+    void setRequirements(const validators::CharacterTypeValidator& validator);
+
+    /**
+     * @brief Remove every code point
+     */
+    void clearAlphabet();
+
+    /**
+     * @brief The merged alphabet
+     */
+    const utils::Utf8Alphabet& getAlphabet() const;
+
+    /**
+     * @brief Entropy in bits of a password of length code points
+     */
+    double getEntropyBits(size_t length) const;
+
+    /**
+     * @brief Generate a password of length code points
+     * @throws std::runtime_error if the alphabet is empty
+     * @throws std::invalid_argument if the alphabet has no code point of a
+     *         required type, or length is shorter than the required types
+     */
+    std::string generate(size_t length) override;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pImpl;
+};
+
+} // namespace strategies
+} // namespace password_generator
+
+#endif // UNICODE_PASSWORD_STRATEGY_H
@@ -0,0 +1,74 @@
+#ifndef UNIQUE_PASSWORD_STRATEGY_H
+#define UNIQUE_PASSWORD_STRATEGY_H
+
+#include "core/interfaces/IPasswordStrategy.h"
+#include "core/interfaces/ICharacterSetProvider.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace password_generator {
+namespace strategies {
+
+/**
+ * @brief Passwords that never repeat under one key, in O(1) memory
+ *
+ * Each password is a counter encrypted with a keyed format-preserving
+ * permutation (utils::FeistelPermutation) over alphabet^length, so
+ * distinct counters always give distinct passwords. When alphabet^length
+ * exceeds 2^128 the permutation covers the leading positions and the rest
+ * are filled from a keyed ChaCha20 stream.
+ *
+ * Shard i of N uses counters i, i + N, i + 2N, ..., so independent
+ * processes sharing one key emit disjoint sets without coordinating.
+ */
+class UniquePasswordStrategy : public core::interfaces::IPasswordStrategy {
+public:
+    /**
+     * @param keyMaterial Secret shared by all shards; empty selects a
+     *        random key, unique to this instance
+     */
+    explicit UniquePasswordStrategy(const std::string& keyMaterial = "");
+    ~UniquePasswordStrategy();
+
+    /**
+     * @brief Add a character set to use for generation
+     */
+    void addCharacterSet(std::unique_ptr<core::interfaces::ICharacterSetProvider> provider);
+
+    /**
+     * @brief Clear all character sets
+     */
+    void clearCharacterSets();
+
+    /**
+     * @brief Emit only shard index of count and restart at its first counter
+     */
+    void setShard(uint64_t index, uint64_t count);
+
+    /**
+     * @brief Number of counters consumed within the shard
+     */
+    uint64_t getPosition() const;
+    void setPosition(uint64_t position);
+
+    /**
+     * @brief Skip counters whose password lacks a configured set (default on)
+     */
+    void setRequireAllSets(bool require);
+
+    /**
+     * @brief Generate the password for the next counter
+     * @throws std::runtime_error when the shard's password space is exhausted
+     */
+    std::string generate(size_t length) override;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pImpl;
+};
+
+} // namespace strategies
+} // namespace password_generator
+
+#endif // UNIQUE_PASSWORD_STRATEGY_H
@@ -0,0 +1,110 @@
+#ifndef WORD_LIST_H
+#define WORD_LIST_H
+
+#include "utils/MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace password_generator {
+namespace strategies {
+
+/**
+ * @brief Compiled word list, memory-mapped from disk
+ *
+ * File layout (all integers little-endian):
+ * - header, 64 bytes: magic "DBGWRD2\0", word count, longest word length,
+ *   blob size (64-bit), flags (32-bit), 4 reserved bytes, then a 256-bit
+ *   map of the bytes that occur in any word
+ * - word count + 1 offsets (32-bit) into the blob; word i spans
+ *   [offset i, offset i+1)
+ * - the blob: all words back to back, sorted, without separators
+ *
+ * compile() sorts and deduplicates, so every index names a distinct word.
+ * It also records the facts PassphrasePasswordStrategy needs to rule out
+ * ambiguous passphrases, so they are answered from the header instead of
+ * by a scan of the list. load() checks only the header and file size, so
+ * opening a list with millions of entries costs the same as opening a
+ * short one; each word's offsets are checked when it is read.
+ */
+class WordList {
+public:
+    static constexpr char MAGIC[8] = {'D', 'B', 'G', 'W', 'R', 'D', '2', '\0'};
+    static constexpr size_t HEADER_SIZE = 64;
+    static constexpr size_t MIN_WORDS = 2;
+
+    // Header flags
+    static constexpr uint32_t ENDS_IN_DIGIT = 1;       // some word ends in 0-9
+    static constexpr uint32_t CAPITAL_COLLISION = 2;   // capitalizing a word gives another
+
+    /**
+     * @brief Serialize words in the file format
+     *
+     * Duplicates are dropped.
+     * @throws std::invalid_argument on an empty word, a word containing
+     *         NUL or ASCII whitespace, or fewer than MIN_WORDS distinct words
+     */
+    static std::vector<uint8_t> compile(std::vector<std::string> words);
+
+    /**
+     * @brief compile() and write the result to a file
+     */
+    static void write(std::vector<std::string> words, const std::string& path);
+
+    /**
+     * @brief Map a compiled list
+     * @throws std::runtime_error if the file is missing or not a valid list
+     */
+    static std::shared_ptr<const WordList> load(const std::string& path);
+
+    /**
+     * @brief Whether word is in the list, by binary search
+     * @throws std::runtime_error if the stored offsets are corrupt
+     */
+    bool contains(std::string_view word) const;
+
+    size_t size() const { return wordCount_; }
+    size_t maxWordLength() const { return maxWordLength_; }
+
+    /**
+     * @brief Whether byte c occurs in any word
+     */
+    bool usesByte(unsigned char c) const { return (byteMap_[c >> 3] >> (c & 7)) & 1; }
+
+    /**
+     * @brief Whether some word ends in an ASCII digit
+     */
+    bool hasWordEndingInDigit() const { return flags_ & ENDS_IN_DIGIT; }
+
+    /**
+     * @brief Whether upper-casing some word's first letter gives another
+     *        word of the list, as "apple" and "Apple"
+     */
+    bool hasCapitalCollision() const { return flags_ & CAPITAL_COLLISION; }
+
+    /**
+     * @brief Word at index (< size())
+     * @throws std::runtime_error if the stored offsets are corrupt
+     */
+    std::string_view operator[](size_t index) const;
+
+private:
+    explicit WordList(utils::MappedFile file);
+
+    utils::MappedFile file_;
+    size_t wordCount_;
+    size_t maxWordLength_;
+    const uint8_t* offsets_;
+    const char* blob_;
+    uint64_t blobSize_;
+    uint32_t flags_;
+    const uint8_t* byteMap_;
+};
+
+} // namespace strategies
+} // namespace password_generator
+
+#endif // WORD_LIST_H
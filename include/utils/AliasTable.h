@@ -0,0 +1,71 @@
+#ifndef ALIAS_TABLE_H
+#define ALIAS_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief Walker/Vose alias table for O(1) weighted index draws
+ *
+ * Weights are quantized to integers summing to a power of two, unit(),
+ * per column, and the table is built with exact integer arithmetic. One
+ * uniform draw below drawBound() then selects index i with probability
+ * exactly quantizedWeight(i) / unit(), with no rejection step:
+ *
+ *     column = draw >> shift, u = draw & (unit - 1)
+ *     index  = u < threshold[column] ? column : alias[column]
+ *
+ * Immutable after build(), so one table can be shared across threads.
+ */
+class AliasTable {
+public:
+    /**
+     * @brief Build from positive, finite weights (at most 2^16 entries)
+     * @throws std::invalid_argument otherwise
+     */
+    explicit AliasTable(const std::vector<double>& weights);
+
+    size_t size() const { return threshold_.size(); }
+
+    /**
+     * @brief Exclusive bound for the uniform draw passed to sample()
+     */
+    uint32_t drawBound() const { return static_cast<uint32_t>(size()) << shift_; }
+
+    /**
+     * @brief Map a uniform draw below drawBound() to an index
+     */
+    uint32_t sample(uint32_t draw) const {
+        const uint32_t column = draw >> shift_;
+        const uint32_t u = draw & (unit() - 1);
+        return u < threshold_[column] ? column : alias_[column];
+    }
+
+    /**
+     * @brief Total of the quantized weights
+     */
+    uint32_t unit() const { return uint32_t(1) << shift_; }
+
+    uint32_t quantizedWeight(size_t i) const { return weight_[i]; }
+    double probability(size_t i) const { return static_cast<double>(weight_[i]) / unit(); }
+
+    /**
+     * @brief Shannon entropy of one draw, in bits
+     */
+    double entropyBits() const;
+
+private:
+    uint32_t shift_;
+    std::vector<uint32_t> threshold_;
+    std::vector<uint32_t> alias_;
+    std::vector<uint32_t> weight_;
+};
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // ALIAS_TABLE_H
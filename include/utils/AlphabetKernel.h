@@ -0,0 +1,89 @@
+#ifndef ALPHABET_KERNEL_H
+#define ALPHABET_KERNEL_H
+
+#include "core/interfaces/IRandomGenerator.h"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief Maps blocks of random bytes to characters of a small alphabet
+ *
+ * A byte b is masked to the next power of two above the alphabet size;
+ * it is accepted when b & mask is below the size and becomes that
+ * character, otherwise it is skipped. At least half of all bytes are
+ * accepted, and accepted characters are uniform.
+ *
+ * The scalar loop is the reference. The SSE4.1 and AVX2 kernels handle
+ * 16 or 32 bytes per step: a compare finds the accepted lanes, pshufb
+ * lookups over 16-character slices of the alphabet map them, and a
+ * shuffle table left-packs the accepted lanes into the output. Given the
+ * same bytes every kernel writes the same characters and consumes the
+ * same number of bytes.
+ */
+class AlphabetKernel {
+public:
+    static constexpr size_t MAX_ALPHABET = 128;
+
+    enum class Isa {
+        Scalar,
+        Sse41,
+        Avx2
+    };
+
+    /**
+     * @throws std::invalid_argument if the alphabet is empty, longer than
+     *         MAX_ALPHABET, or repeats a character
+     */
+    explicit AlphabetKernel(std::string_view alphabet);
+
+    size_t size() const { return size_; }
+
+    /**
+     * @brief Map bytes in order until out holds outCount characters
+     * @param consumed Set to the bytes read, up to and including the last
+     *        accepted one when out fills up
+     * @return Characters written; out beyond them may be overwritten
+     */
+    size_t map(const uint8_t* bytes, size_t byteCount, char* out, size_t outCount,
+               size_t& consumed) const;
+
+    /**
+     * @brief map() with a specific kernel
+     * @throws std::invalid_argument if the CPU does not support it
+     */
+    size_t map(Isa isa, const uint8_t* bytes, size_t byteCount, char* out, size_t outCount,
+               size_t& consumed) const;
+
+    /**
+     * @brief Fill out with count uniform characters
+     *
+     * Random bytes are fetched in blocks with utils::fillBytes; bytes left
+     * over once out is full are wiped and discarded. Passwords laid out
+     * back to back are filled in one pass.
+     */
+    void fill(core::interfaces::IRandomGenerator& rng, char* out, size_t count) const;
+
+    /**
+     * @brief Widest kernel the CPU supports
+     */
+    static Isa bestIsa();
+
+    static bool isSupported(Isa isa);
+
+private:
+    size_t size_;
+    uint8_t mask_;
+    Isa isa_;
+
+    // The alphabet padded to a multiple of 16 for the pshufb slices
+    alignas(32) uint8_t table_[MAX_ALPHABET];
+};
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // ALPHABET_KERNEL_H
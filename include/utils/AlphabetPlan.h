@@ -0,0 +1,78 @@
+#ifndef ALPHABET_PLAN_H
+#define ALPHABET_PLAN_H
+
+#include "core/interfaces/ICharacterSetProvider.h"
+#include "utils/CharacterFilter.h"
+#include "utils/CharacterTable.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief Character sets compiled into one contiguous table
+ *
+ * Built once when the configured sets change, so generation reads
+ * characters straight from the table without calling providers or
+ * allocating. The table holds the deduplicated union of all sets followed
+ * by each non-empty set in order:
+ *
+ *     [merged][set 0][set 1]...
+ *
+ * Deduplicating the union keeps every distinct character equally likely
+ * when sets overlap, e.g. a custom symbol set that repeats a letter.
+ * Each range is exposed as a CharacterTable for O(1) membership tests.
+ * An optional CharacterFilter's mask is applied to every set first. A
+ * provider that was empty to begin with is dropped, but a mask that
+ * empties a set is rejected: each set stands for characters the caller
+ * asked for, and dropping it would quietly drop that requirement.
+ */
+class AlphabetPlan {
+public:
+    AlphabetPlan() = default;
+    AlphabetPlan(const AlphabetPlan&) = delete;
+    AlphabetPlan& operator=(const AlphabetPlan&) = delete;
+
+    /**
+     * @brief Compile the sets, replacing any previous plan
+     * @throws std::invalid_argument naming the first set the filter empties;
+     *         the previous plan is then kept
+     */
+    void build(const std::vector<std::unique_ptr<core::interfaces::ICharacterSetProvider>>& providers,
+               const CharacterFilter* filter = nullptr);
+    void clear();
+
+    bool empty() const { return merged_.empty(); }
+
+    /**
+     * @brief Deduplicated union of all sets
+     */
+    const CharacterTable& merged() const { return merged_; }
+    uint32_t mergedSize() const { return static_cast<uint32_t>(merged_.size()); }
+
+    /**
+     * @brief Index of the provider that first contributed merged character i
+     */
+    size_t mergedOrigin(size_t i) const { return origin_[i]; }
+
+    /**
+     * @brief Non-empty sets, in the order they were added
+     */
+    size_t setCount() const { return sets_.size(); }
+    const CharacterTable& set(size_t i) const { return sets_[i]; }
+    uint32_t setSize(size_t i) const { return static_cast<uint32_t>(sets_[i].size()); }
+
+private:
+    std::vector<char> table_;
+    CharacterTable merged_;
+    std::vector<size_t> origin_;
+    std::vector<CharacterTable> sets_;
+};
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // ALPHABET_PLAN_H
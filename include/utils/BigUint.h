@@ -0,0 +1,86 @@
+#ifndef BIG_UINT_H
+#define BIG_UINT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief Arbitrary-precision unsigned integer for exact keyspace counts
+ *
+ * Keyspaces such as 94^64 overflow every built-in type; this keeps them
+ * exact so they can be compared, summed and reported without rounding.
+ */
+class BigUint {
+public:
+    BigUint() = default;
+    BigUint(uint64_t value);
+
+    static BigUint pow(const BigUint& base, size_t exponent);
+
+    /**
+     * @brief Value of a big-endian byte string
+     */
+    static BigUint fromBytes(const uint8_t* bytes, size_t length);
+
+    bool isZero() const { return limbs_.empty(); }
+
+    /**
+     * @brief Number of significant bits; 0 for zero
+     */
+    size_t bitLength() const;
+
+    BigUint& operator+=(const BigUint& other);
+    BigUint& operator-=(const BigUint& other);
+    BigUint& operator*=(const BigUint& other);
+    BigUint& operator*=(uint32_t factor);
+
+    friend BigUint operator+(BigUint a, const BigUint& b) { return a += b; }
+    friend BigUint operator-(BigUint a, const BigUint& b) { return a -= b; }
+    friend BigUint operator*(BigUint a, const BigUint& b) { return a *= b; }
+
+    friend bool operator==(const BigUint& a, const BigUint& b) { return a.limbs_ == b.limbs_; }
+    friend bool operator!=(const BigUint& a, const BigUint& b) { return !(a == b); }
+    friend bool operator<(const BigUint& a, const BigUint& b) { return compare(a, b) < 0; }
+    friend bool operator<=(const BigUint& a, const BigUint& b) { return compare(a, b) <= 0; }
+    friend bool operator>(const BigUint& a, const BigUint& b) { return compare(a, b) > 0; }
+    friend bool operator>=(const BigUint& a, const BigUint& b) { return compare(a, b) >= 0; }
+
+    /**
+     * @brief Divide in place by a small divisor and return the remainder
+     */
+    uint32_t divideSmall(uint32_t divisor);
+
+    /**
+     * @brief Base-2 logarithm, accurate to double precision; 0 for zero
+     */
+    double log2() const;
+
+    /**
+     * @brief Low 64 bits of the value
+     */
+    uint64_t low64() const;
+
+    /**
+     * @brief True if the value fits in 64 bits
+     */
+    bool fitsUint64() const { return limbs_.size() <= 2; }
+
+    std::string toString() const;
+
+private:
+    static int compare(const BigUint& a, const BigUint& b);
+    void trim();
+
+    // Little-endian base 2^32 limbs with no leading zero limb
+    std::vector<uint32_t> limbs_;
+};
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // BIG_UINT_H
@@ -0,0 +1,86 @@
+#ifndef BULK_RANDOM_GENERATOR_H
+#define BULK_RANDOM_GENERATOR_H
+
+#include "core/interfaces/IRandomGenerator.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief Random generator that serves many draws per virtual call
+ *
+ * Strategies describe every draw a password needs up front and fetch them
+ * in one call instead of calling generate() once per character.
+ */
+class IBulkRandomGenerator : public core::interfaces::IRandomGenerator {
+public:
+    /**
+     * @brief Replace each bound with a uniform value in [0, bound)
+     *
+     * Every bound must be at least 1.
+     */
+    virtual void generateBounded(uint32_t* values, size_t count) = 0;
+
+    /**
+     * @brief Fill out with uniform indices in [0, bound)
+     */
+    virtual void generateIndices(uint32_t* out, size_t count, uint32_t bound) = 0;
+
+    /**
+     * @brief Fill a buffer with uniform random bytes
+     */
+    virtual void fillBytes(void* out, size_t length) = 0;
+};
+
+/**
+ * @brief Bulk draws against any generator
+ *
+ * These route through IBulkRandomGenerator when the generator implements
+ * it and fall back to one generate() call per value otherwise.
+ */
+void generateBounded(core::interfaces::IRandomGenerator& rng, uint32_t* values, size_t count);
+void generateIndices(core::interfaces::IRandomGenerator& rng, uint32_t* out, size_t count,
+                     uint32_t bound);
+void fillBytes(core::interfaces::IRandomGenerator& rng, void* out, size_t length);
+
+/**
+ * @brief Scratch space for one batch of bounded draws
+ *
+ * Batches up to INLINE_CAPACITY draws stay on the stack. Drawn values are
+ * wiped on destruction since they determine the password.
+ */
+class DrawBuffer {
+public:
+    static constexpr size_t INLINE_CAPACITY = 320;
+
+    explicit DrawBuffer(size_t count);
+    ~DrawBuffer();
+
+    DrawBuffer(const DrawBuffer&) = delete;
+    DrawBuffer& operator=(const DrawBuffer&) = delete;
+
+    uint32_t& operator[](size_t i) { return data_[i]; }
+    uint32_t* data() { return data_; }
+    size_t size() const { return size_; }
+
+    /**
+     * @brief Replace every stored bound with its draw in a single call
+     */
+    void draw(core::interfaces::IRandomGenerator& rng) {
+        generateBounded(rng, data_, size_);
+    }
+
+private:
+    uint32_t inline_[INLINE_CAPACITY];
+    std::vector<uint32_t> heap_;
+    uint32_t* data_;
+    size_t size_;
+};
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // BULK_RANDOM_GENERATOR_H
@@ -0,0 +1,104 @@
+#ifndef CHACHA20_DRBG_H
+#define CHACHA20_DRBG_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief Buffered ChaCha20 deterministic random bit generator
+ *
+ * Serves draws from a multi-block keystream buffer. Every refill uses the
+ * first 32 bytes of fresh keystream as the next key ("fast key erasure"),
+ * so a state compromise never reveals earlier output, and consumed
+ * keystream is zeroed as it is handed out.
+ *
+ * The default constructor seeds from the operating system and mixes in
+ * fresh system entropy every RESEED_INTERVAL bytes. The keyed constructor
+ * produces a reproducible stream and never reseeds on its own.
+ *
+ * Not thread-safe; use one instance per thread.
+ */
+class ChaCha20Drbg {
+public:
+    static constexpr size_t KEY_SIZE = 32;
+    static constexpr size_t BLOCK_SIZE = 64;
+    static constexpr size_t BUFFER_BLOCKS = 16;
+    static constexpr size_t BUFFER_SIZE = BLOCK_SIZE * BUFFER_BLOCKS;
+    static constexpr uint64_t RESEED_INTERVAL = uint64_t(1) << 20;
+
+    /**
+     * @brief Create a generator seeded from the system entropy source
+     */
+    ChaCha20Drbg();
+
+    /**
+     * @brief Create a generator producing the stream for a fixed key
+     */
+    explicit ChaCha20Drbg(const uint8_t (&key)[KEY_SIZE]);
+
+    ~ChaCha20Drbg();
+
+    ChaCha20Drbg(const ChaCha20Drbg&) = delete;
+    ChaCha20Drbg& operator=(const ChaCha20Drbg&) = delete;
+
+    uint32_t next32() {
+        uint32_t value;
+        take(&value, sizeof(value));
+        return value;
+    }
+
+    uint64_t next64() {
+        uint64_t value;
+        take(&value, sizeof(value));
+        return value;
+    }
+
+    /**
+     * @brief Fill a buffer with keystream
+     */
+    void fill(void* out, size_t length);
+
+    /**
+     * @brief Mix fresh system entropy into the key and discard buffered output
+     */
+    void reseed();
+
+    /**
+     * @brief Replace the key, discarding buffered output
+     */
+    void rekey(const uint8_t (&key)[KEY_SIZE]);
+
+    /**
+     * @brief ChaCha20 block function (RFC 8439, section 2.3)
+     */
+    static void block(const uint32_t key[8], uint32_t counter,
+                      const uint32_t nonce[3], uint8_t out[BLOCK_SIZE]);
+
+private:
+    void take(void* out, size_t length) {
+        if (BUFFER_SIZE - position_ < length) {
+            refill();
+        }
+        std::memcpy(out, buffer_ + position_, length);
+        std::memset(buffer_ + position_, 0, length);
+        position_ += length;
+    }
+
+    void refill();
+    void discardBuffer();
+
+    alignas(64) uint8_t buffer_[BUFFER_SIZE];
+    uint32_t key_[8];
+    size_t position_;
+    uint64_t bytesSinceReseed_;
+    bool autoReseed_;
+};
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // CHACHA20_DRBG_H
@@ -0,0 +1,160 @@
+#ifndef CHARACTER_FILTER_H
+#define CHARACTER_FILTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief Character restrictions compiled ahead of generation
+ *
+ * Per-character rules (look-alikes, excluded characters, an allowed
+ * charset) compile into a 256-bit allow mask that is applied once to the
+ * alphabet, so filtered characters are never drawn. Sequence rules (a cap
+ * on repeats of one character, no adjacent duplicates) are enforced while
+ * drawing by a Tracker, one O(1) check per character, whether the
+ * password is drawn left to right or position by position.
+ */
+class CharacterFilter {
+public:
+    /**
+     * @brief Characters commonly confused with one another
+     */
+    static constexpr std::string_view AMBIGUOUS = "0O1lI|";
+
+    CharacterFilter();
+
+    /**
+     * @brief Drop the AMBIGUOUS characters
+     */
+    void excludeAmbiguous();
+
+    /**
+     * @brief Drop the given characters
+     */
+    void exclude(std::string_view chars);
+
+    /**
+     * @brief Keep only characters that are also in chars
+     */
+    void allowOnly(std::string_view chars);
+
+    /**
+     * @brief allowOnly() the characters listed in a file
+     *
+     * Every byte other than whitespace is a character of the set.
+     * @throws std::runtime_error if the file cannot be read
+     * @throws std::invalid_argument if it lists no character or a
+     *         non-printable or non-ASCII byte
+     */
+    void loadCharsetFile(const std::string& path);
+
+    /**
+     * @brief Allow each character at most k times per password; 0 lifts the cap
+     */
+    void setMaxRepeat(size_t k) { maxRepeat_ = k; }
+    size_t getMaxRepeat() const { return maxRepeat_; }
+
+    /**
+     * @brief Forbid the same character twice in a row
+     */
+    void setNoAdjacentRepeat(bool enabled) { noAdjacentRepeat_ = enabled; }
+    bool getNoAdjacentRepeat() const { return noAdjacentRepeat_; }
+
+    bool allows(char c) const {
+        auto byte = static_cast<unsigned char>(c);
+        return (allow_[byte >> 6] >> (byte & 63)) & 1;
+    }
+
+    /**
+     * @brief Characters of chars that pass the mask, in order
+     */
+    std::string apply(std::string_view chars) const;
+
+    /**
+     * @brief True if some character is masked out
+     */
+    bool hasMask() const;
+
+    /**
+     * @brief True if sequence rules must be tracked while drawing
+     */
+    bool hasSequenceRules() const { return maxRepeat_ > 0 || noAdjacentRepeat_; }
+
+    /**
+     * @brief True if the filter changes nothing
+     */
+    bool isEmpty() const { return !hasMask() && !hasSequenceRules(); }
+
+    /**
+     * @brief Sequence state of one password as it is drawn left to right
+     */
+    class Tracker {
+    public:
+        explicit Tracker(const CharacterFilter& filter);
+        ~Tracker();
+
+        Tracker(const Tracker&) = delete;
+        Tracker& operator=(const Tracker&) = delete;
+
+        /**
+         * @brief True if c may be appended
+         */
+        bool allows(char c) const {
+            auto byte = static_cast<unsigned char>(c);
+            return !(noAdjacentRepeat_ && started_ && byte == last_) &&
+                   (maxRepeat_ == 0 || counts_[byte] < maxRepeat_);
+        }
+
+        void push(char c) {
+            auto byte = static_cast<unsigned char>(c);
+            ++counts_[byte];
+            last_ = byte;
+            started_ = true;
+        }
+
+        /**
+         * @brief True if c may be written at out[position]
+         *
+         * For passwords filled out of order: positions not yet written
+         * hold '\0', and c must differ from both written neighbours.
+         */
+        bool allowsAt(const char* out, size_t length, size_t position, char c) const {
+            auto byte = static_cast<unsigned char>(c);
+            if (maxRepeat_ != 0 && counts_[byte] >= maxRepeat_) {
+                return false;
+            }
+            return !noAdjacentRepeat_ ||
+                   ((position == 0 || out[position - 1] != c) &&
+                    (position + 1 == length || out[position + 1] != c));
+        }
+
+        /**
+         * @brief Count c, written at any position
+         */
+        void place(char c) {
+            ++counts_[static_cast<unsigned char>(c)];
+        }
+
+    private:
+        size_t maxRepeat_;
+        bool noAdjacentRepeat_;
+        bool started_ = false;
+        unsigned char last_ = 0;
+        uint32_t counts_[256];
+    };
+
+private:
+    uint64_t allow_[4];
+    size_t maxRepeat_ = 0;
+    bool noAdjacentRepeat_ = false;
+};
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // CHARACTER_FILTER_H
@@ -0,0 +1,59 @@
+#ifndef CHARACTER_TABLE_H
+#define CHARACTER_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief Read-only view of a character set with a 256-bit membership map
+ *
+ * The table does not own its characters. Built-in sets view string
+ * literals and are constructed at compile time; owners of mutable sets
+ * must rebuild the table whenever their storage changes.
+ */
+class CharacterTable {
+public:
+    constexpr CharacterTable() = default;
+
+    constexpr explicit CharacterTable(std::string_view chars) : chars_(chars) {
+        for (char c : chars) {
+            auto byte = static_cast<unsigned char>(c);
+            mask_[byte >> 6] |= uint64_t(1) << (byte & 63);
+        }
+    }
+
+    constexpr std::string_view characters() const { return chars_; }
+    constexpr size_t size() const { return chars_.size(); }
+    constexpr bool empty() const { return chars_.empty(); }
+    constexpr char operator[](size_t i) const { return chars_[i]; }
+
+    constexpr bool contains(char c) const {
+        auto byte = static_cast<unsigned char>(c);
+        return (mask_[byte >> 6] >> (byte & 63)) & 1;
+    }
+
+private:
+    std::string_view chars_;
+    uint64_t mask_[4] = {0, 0, 0, 0};
+};
+
+/**
+ * @brief Built-in character sets shared by providers, strategies and validators
+ */
+namespace tables {
+
+inline constexpr CharacterTable LOWERCASE{"abcdefghijklmnopqrstuvwxyz"};
+inline constexpr CharacterTable UPPERCASE{"ABCDEFGHIJKLMNOPQRSTUVWXYZ"};
+inline constexpr CharacterTable DIGITS{"0123456789"};
+inline constexpr CharacterTable SYMBOLS{"!@#$%^&*()_+-=[]{}|;:,.<>?"};
+
+} // namespace tables
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // CHARACTER_TABLE_H
@@ -0,0 +1,35 @@
+#ifndef CPU_QUOTA_H
+#define CPU_QUOTA_H
+
+#include <cstddef>
+#include <string_view>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief CPUs this process may actually use
+ *
+ * The smallest of the scheduler affinity mask, the cgroup v2 cpu.max
+ * quota and the cgroup v1 cfs quota of the process's own cgroup, with
+ * quotas rounded up to whole CPUs. At least 1. Off Linux this is
+ * std::thread::hardware_concurrency().
+ */
+size_t availableCpus();
+
+/**
+ * @brief CPUs granted by a cgroup v2 cpu.max line ("quota period")
+ * @return 0 for "max" or a line that does not parse
+ */
+size_t cpusFromCgroupV2(std::string_view cpuMax);
+
+/**
+ * @brief CPUs granted by cgroup v1 cpu.cfs_quota_us and cpu.cfs_period_us
+ * @return 0 for an unlimited (negative) quota or a zero period
+ */
+size_t cpusFromCgroupV1(long long quotaMicros, long long periodMicros);
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // CPU_QUOTA_H
@@ -0,0 +1,26 @@
+#ifndef CRC32_H
+#define CRC32_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief CRC-32 (ISO-HDLC, as in zlib and PNG), slicing by 8
+ *
+ * Pass a previous result as crc to continue a running checksum.
+ */
+uint32_t crc32(const void* data, size_t length, uint32_t crc = 0);
+
+/**
+ * @brief CRC-32C (Castagnoli), using the SSE4.2 crc32 instruction when
+ *        the CPU has it and slicing by 8 otherwise
+ */
+uint32_t crc32c(const void* data, size_t length, uint32_t crc = 0);
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // CRC32_H
@@ -0,0 +1,58 @@
+#ifndef ENTROPY_HEALTH_TESTS_H
+#define ENTROPY_HEALTH_TESTS_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief SP 800-90B continuous health tests over a byte-sample stream
+ *
+ * Runs the repetition count test (section 4.4.1) and the adaptive
+ * proportion test (section 4.4.2) incrementally. Cutoffs assume full
+ * entropy per byte (H = 8) and a false positive probability of 2^-40.
+ * Samples are compared eight at a time as one 64-bit word; a word that
+ * might fire either test is replayed sample by sample, so the counters
+ * match a byte-at-a-time run exactly.
+ */
+class EntropyHealthTests {
+public:
+    static constexpr uint32_t RCT_CUTOFF = 6;     // 1 + ceil(40 / H)
+    static constexpr uint32_t APT_WINDOW = 512;
+    static constexpr uint32_t APT_CUTOFF = 19;    // 1 + CRITBINOM(512, 2^-8, 1 - 2^-40)
+
+    struct Counters {
+        uint64_t samples = 0;
+        uint64_t rctFailures = 0;
+        uint64_t aptFailures = 0;
+    };
+
+    /**
+     * @brief Feed samples through both tests
+     * @return false if either test fired while processing this block
+     */
+    bool process(const uint8_t* samples, size_t count);
+
+    const Counters& getCounters() const { return counters_; }
+
+private:
+    bool step(uint8_t sample);
+
+    Counters counters_;
+
+    // Repetition count test state
+    uint8_t rctLast_ = 0;
+    uint32_t rctRun_ = 0;
+
+    // Adaptive proportion test state
+    uint8_t aptReference_ = 0;
+    uint32_t aptMatches_ = 0;
+    uint32_t aptPosition_ = 0;
+};
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // ENTROPY_HEALTH_TESTS_H
@@ -0,0 +1,61 @@
+#ifndef FEISTEL_PERMUTATION_H
+#define FEISTEL_PERMUTATION_H
+
+#include "utils/ChaCha20Drbg.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief Keyed format-preserving permutation of radix^digits
+ *
+ * A balanced Feistel network with ChaCha20 round functions permutes the
+ * smallest even-width bit domain covering radix^digits. Cycle walking
+ * (re-encrypting until the value falls back inside the domain) restricts
+ * it to exactly radix^digits values. Because the width is rounded up by
+ * at most two bits, fewer than four walks are needed on average.
+ *
+ * Domains wider than 128 bits are truncated to the largest digit count
+ * that fits; see permutedDigits().
+ */
+class FeistelPermutation {
+public:
+    static constexpr int ROUNDS = 10;
+
+    FeistelPermutation(const uint8_t (&key)[ChaCha20Drbg::KEY_SIZE],
+                       uint32_t radix, size_t digits);
+    ~FeistelPermutation();
+
+    /**
+     * @brief Number of digits covered by the permutation
+     */
+    size_t permutedDigits() const { return digits_; }
+
+    /**
+     * @brief True if counter lies inside the permuted domain
+     */
+    bool contains(uint64_t counter) const;
+
+    /**
+     * @brief Map counter to permutedDigits() digits, least significant first
+     */
+    void permute(uint64_t counter, uint32_t* digits) const;
+
+private:
+    void encrypt(uint64_t& hi, uint64_t& lo) const;
+    uint64_t round(int index, uint64_t half) const;
+
+    uint32_t key_[8];
+    uint32_t radix_;
+    size_t digits_;
+    uint64_t domainHi_;
+    uint64_t domainLo_;
+    unsigned halfBits_;
+};
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // FEISTEL_PERMUTATION_H
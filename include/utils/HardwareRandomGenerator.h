@@ -0,0 +1,81 @@
+#ifndef HARDWARE_RANDOM_GENERATOR_H
+#define HARDWARE_RANDOM_GENERATOR_H
+
+#include "utils/BulkRandomGenerator.h"
+#include "utils/IndexSampler.h"
+#include <cstdint>
+#include <memory>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief Random generator backed by the CPU's RDSEED/RDRAND instructions
+ *
+ * Instruction support is detected at runtime via CPUID. Draws are fetched in
+ * blocks of one health-test window, checked inline with the SP 800-90B
+ * repetition count and adaptive proportion tests, and discarded if either
+ * test fires. When the instructions are missing, or keep failing after the
+ * architectural retry budget, blocks come from getrandom(2) instead.
+ *
+ * @throws std::runtime_error if the source fails its health tests on
+ *         several consecutive blocks
+ */
+class HardwareRandomGenerator : public IBulkRandomGenerator {
+public:
+    enum class Source {
+        RdSeed,
+        RdRand,
+        System
+    };
+
+    struct Statistics {
+        uint64_t wordsDrawn = 0;       // 64-bit words served from the source
+        uint64_t retries = 0;          // Carry-flag failures that were retried
+        uint64_t fallbackBlocks = 0;   // Blocks served by getrandom after retries ran out
+        uint64_t samplesTested = 0;    // Bytes checked by the health tests
+        uint64_t rctFailures = 0;      // Repetition count test alarms
+        uint64_t aptFailures = 0;      // Adaptive proportion test alarms
+        uint64_t discardedBlocks = 0;  // Blocks dropped after an alarm
+    };
+
+    /**
+     * @brief Create a generator using the best available source
+     * @param preferred Strongest source to consider; RdSeed falls back to
+     *        RdRand, and either falls back to System when unsupported
+     */
+    explicit HardwareRandomGenerator(Source preferred = Source::RdRand);
+    ~HardwareRandomGenerator();
+
+    int generate(int min, int max) override;
+    void generateBounded(uint32_t* values, size_t count) override;
+    void generateIndices(uint32_t* out, size_t count, uint32_t bound) override;
+    void fillBytes(void* out, size_t length) override;
+
+    /**
+     * @brief Get the source selected at construction
+     */
+    Source getSource() const;
+
+    /**
+     * @brief Get draw and health test counters
+     */
+    Statistics getStatistics() const;
+
+    /**
+     * @brief Random words consumed versus indices produced so far
+     */
+    SamplerStats getSamplerStats() const;
+
+    static bool hasRdRand();
+    static bool hasRdSeed();
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pImpl;
+};
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // HARDWARE_RANDOM_GENERATOR_H
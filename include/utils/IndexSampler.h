@@ -0,0 +1,159 @@
+#ifndef INDEX_SAMPLER_H
+#define INDEX_SAMPLER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief Random-bit accounting for an index sampler
+ */
+struct SamplerStats {
+    uint64_t wordsDrawn = 0;        // 64-bit words pulled from the source
+    uint64_t indicesProduced = 0;   // Uniform indices handed out
+
+    double bitsPerIndex() const {
+        return indicesProduced == 0 ? 0.0
+            : 64.0 * static_cast<double>(wordsDrawn) / static_cast<double>(indicesProduced);
+    }
+};
+
+namespace detail {
+
+inline void mul64x64(uint64_t a, uint64_t b, uint64_t& hi, uint64_t& lo) {
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128;
+    uint128 product = static_cast<uint128>(a) * b;
+    hi = static_cast<uint64_t>(product >> 64);
+    lo = static_cast<uint64_t>(product);
+#else
+    const uint64_t aLo = a & 0xFFFFFFFF, aHi = a >> 32;
+    const uint64_t bLo = b & 0xFFFFFFFF, bHi = b >> 32;
+    const uint64_t ll = aLo * bLo, lh = aLo * bHi, hl = aHi * bLo, hh = aHi * bHi;
+    const uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+    hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    lo = (mid << 32) | (ll & 0xFFFFFFFF);
+#endif
+}
+
+/**
+ * Draw a word x such that floor(x * range / 2^64) is uniform in [0, range)
+ * (Lemire's multiply-shift); a word is rejected only when it falls in the
+ * biased tail.
+ */
+template <typename NextWord>
+uint64_t acceptWord(NextWord& next, uint64_t range, SamplerStats& stats) {
+    uint64_t x, hi, lo;
+    ++stats.wordsDrawn;
+    x = next();
+    mul64x64(x, range, hi, lo);
+    if (lo < range) {
+        const uint64_t threshold = (0 - range) % range;
+        while (lo < threshold) {
+            ++stats.wordsDrawn;
+            x = next();
+            mul64x64(x, range, hi, lo);
+        }
+    }
+    return x;
+}
+
+inline bool isPowerOfTwo(uint32_t value) {
+    return (value & (value - 1)) == 0;
+}
+
+inline unsigned log2Exact(uint32_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctz(value));
+#else
+    unsigned bits = 0;
+    while (value > 1) {
+        value >>= 1;
+        ++bits;
+    }
+    return bits;
+#endif
+}
+
+} // namespace detail
+
+/**
+ * @brief Replace each bound with a uniform value in [0, bound)
+ *
+ * Packs several draws into each 64-bit word from next(). Consecutive
+ * power-of-two bounds are served by slicing bits; anything else is drawn
+ * as one mixed-radix value in [0, b1 * b2 * ... * bk) whose digits are
+ * peeled off by multiplication, most significant first, so no division
+ * is needed. A 94-symbol alphabet costs about 7.1 random bits per
+ * character instead of a 32-bit word.
+ *
+ * @param next Callable returning uniform 64-bit words
+ */
+template <typename NextWord>
+void sampleBounded(NextWord& next, uint32_t* values, size_t count, SamplerStats& stats) {
+    size_t i = 0;
+    while (i < count) {
+        if (values[i] == 0) {
+            throw std::invalid_argument("bound must be positive");
+        }
+
+        if (detail::isPowerOfTwo(values[i])) {
+            // Bit slicing: take powers of two while they fit in one word
+            size_t j = i;
+            unsigned bits = 0;
+            while (j < count && values[j] != 0 && detail::isPowerOfTwo(values[j]) &&
+                   bits + detail::log2Exact(values[j]) <= 64) {
+                bits += detail::log2Exact(values[j]);
+                ++j;
+            }
+            uint64_t word = 0;
+            if (bits > 0) {
+                word = next();
+                ++stats.wordsDrawn;
+            }
+            for (; i < j; ++i) {
+                const unsigned width = detail::log2Exact(values[i]);
+                values[i] = static_cast<uint32_t>(word & (uint64_t(values[i]) - 1));
+                word = width < 64 ? word >> width : 0;
+            }
+            continue;
+        }
+
+        // Mixed radix: multiply bounds while the product fits in 64 bits
+        size_t j = i;
+        uint64_t product = 1;
+        while (j < count && values[j] != 0 && product <= UINT64_MAX / values[j]) {
+            product *= values[j];
+            ++j;
+        }
+        // floor(x * product / 2^64) is uniform; its digits are the successive
+        // integer parts of the fraction x / 2^64 scaled by each radix
+        uint64_t fraction = detail::acceptWord(next, product, stats);
+        for (; i < j; ++i) {
+            uint64_t digit;
+            detail::mul64x64(fraction, values[i], digit, fraction);
+            values[i] = static_cast<uint32_t>(digit);
+        }
+    }
+    stats.indicesProduced += count;
+}
+
+/**
+ * @brief Fill out with uniform indices in [0, bound)
+ */
+template <typename NextWord>
+void sampleIndices(NextWord& next, uint32_t* out, size_t count, uint32_t bound,
+                   SamplerStats& stats) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = bound;
+    }
+    sampleBounded(next, out, count, stats);
+}
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // INDEX_SAMPLER_H
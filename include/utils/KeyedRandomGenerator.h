@@ -0,0 +1,40 @@
+#ifndef KEYED_RANDOM_GENERATOR_H
+#define KEYED_RANDOM_GENERATOR_H
+
+#include "utils/BulkRandomGenerator.h"
+#include "utils/ChaCha20Drbg.h"
+#include "utils/IndexSampler.h"
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief Deterministic generator expanding a 256-bit key with ChaCha20
+ *
+ * The same key always yields the same sequence of draws, which is what
+ * derived passwords rely on. Never reseeds from the system.
+ */
+class KeyedRandomGenerator : public IBulkRandomGenerator {
+public:
+    explicit KeyedRandomGenerator(const uint8_t (&key)[ChaCha20Drbg::KEY_SIZE]);
+    ~KeyedRandomGenerator();
+
+    int generate(int min, int max) override;
+    void generateBounded(uint32_t* values, size_t count) override;
+    void generateIndices(uint32_t* out, size_t count, uint32_t bound) override;
+    void fillBytes(void* out, size_t length) override;
+
+    /**
+     * @brief Restart the stream from a new key
+     */
+    void rekey(const uint8_t (&key)[ChaCha20Drbg::KEY_SIZE]);
+
+private:
+    ChaCha20Drbg drbg_;
+    SamplerStats stats_;
+};
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // KEYED_RANDOM_GENERATOR_H
@@ -0,0 +1,44 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief Read-only memory mapping of a whole file
+ *
+ * Pages are loaded on first access, so opening a large file costs only
+ * the mapping itself. Move-only; the mapping is released on destruction.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Map a file
+     * @throws std::runtime_error if the file cannot be opened, is empty or cannot be mapped
+     */
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const uint8_t* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    void release() noexcept;
+
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // MAPPED_FILE_H
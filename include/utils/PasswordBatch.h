@@ -0,0 +1,220 @@
+#ifndef PASSWORD_BATCH_H
+#define PASSWORD_BATCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief Passwords stored back to back in one arena
+ *
+ * A batch owns a single buffer holding every password, with no
+ * separators. While all passwords have the same length they are found by
+ * index times length; the first password of a different length adds a
+ * table of end offsets, one word per password. Passwords are read as
+ * string_views into the arena, so validating, writing and wiping a batch
+ * are each one linear sweep.
+ *
+ * Arenas of ARENA_MAP_THRESHOLD bytes or more are anonymous mappings
+ * excluded from core dumps where the platform allows; Backing::HugePages
+ * rounds them to whole 2 MiB pages and asks for transparent huge pages,
+ * silently keeping normal pages when the kernel declines.
+ * Growing the arena copies it and wipes the old one.
+ *
+ * The destructor wipes the arena in one secureWipe() call. Move-only.
+ */
+class PasswordBatch {
+public:
+    static constexpr size_t ARENA_MAP_THRESHOLD = size_t(1) << 20;
+
+    enum class Backing {
+        Pages,
+        HugePages
+    };
+
+    class const_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = std::string_view;
+
+        const_iterator() = default;
+
+        std::string_view operator*() const { return (*batch_)[index_]; }
+        std::string_view operator[](difference_type n) const { return (*batch_)[index_ + n]; }
+        const_iterator& operator++() { ++index_; return *this; }
+        const_iterator operator++(int) { const_iterator old = *this; ++index_; return old; }
+        const_iterator& operator--() { --index_; return *this; }
+        const_iterator operator--(int) { const_iterator old = *this; --index_; return old; }
+        const_iterator& operator+=(difference_type n) { index_ += n; return *this; }
+        const_iterator& operator-=(difference_type n) { index_ -= n; return *this; }
+        const_iterator operator+(difference_type n) const { return {batch_, index_ + n}; }
+        const_iterator operator-(difference_type n) const { return {batch_, index_ - n}; }
+        difference_type operator-(const const_iterator& other) const {
+            return static_cast<difference_type>(index_ - other.index_);
+        }
+        bool operator==(const const_iterator& other) const { return index_ == other.index_; }
+        bool operator!=(const const_iterator& other) const { return index_ != other.index_; }
+        bool operator<(const const_iterator& other) const { return index_ < other.index_; }
+
+    private:
+        friend class PasswordBatch;
+        const_iterator(const PasswordBatch* batch, size_t index) : batch_(batch), index_(index) {}
+
+        const PasswordBatch* batch_ = nullptr;
+        size_t index_ = 0;
+    };
+
+    PasswordBatch() = default;
+
+    /**
+     * @brief Empty batch whose arenas will use the given backing
+     */
+    explicit PasswordBatch(Backing backing) : backing_(backing) {}
+
+    /**
+     * @brief count passwords of one length, to be written through data()
+     *
+     * The arena starts zeroed.
+     * @throws std::bad_alloc if the arena cannot be allocated
+     */
+    PasswordBatch(size_t count, size_t length, Backing backing = Backing::Pages);
+    ~PasswordBatch();
+
+    PasswordBatch(PasswordBatch&& other) noexcept;
+    PasswordBatch& operator=(PasswordBatch&& other) noexcept;
+    PasswordBatch(const PasswordBatch&) = delete;
+    PasswordBatch& operator=(const PasswordBatch&) = delete;
+
+    /**
+     * @brief Make room for count more passwords totalling bytes characters
+     * @throws std::bad_alloc if the arena cannot be allocated
+     */
+    void reserve(size_t count, size_t bytes);
+
+    /**
+     * @brief Add a password of the given length and return where to write it
+     *
+     * The pointer is valid until the next append or reserve.
+     * @throws std::bad_alloc if the arena cannot grow
+     */
+    char* append(size_t length);
+
+    void append(std::string_view password);
+
+    /**
+     * @brief Add count passwords of one length and return where to write
+     *        them back to back
+     *
+     * Costs no offset table while the batch's lengths stay uniform. The
+     * pointer is valid until the next append or reserve.
+     * @throws std::bad_alloc if the arena cannot grow
+     */
+    char* appendUniform(size_t count, size_t length);
+
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+
+    /**
+     * @brief Length shared by every password, or 0 once lengths differ
+     */
+    size_t uniformLength() const { return offsets_.empty() ? length_ : 0; }
+
+    std::string_view operator[](size_t index) const {
+        if (offsets_.empty()) {
+            return {arena_ + index * length_, length_};
+        }
+        const size_t begin = index == 0 ? 0 : offsets_[index - 1];
+        return {arena_ + begin, static_cast<size_t>(offsets_[index] - begin)};
+    }
+
+    const_iterator begin() const { return {this, 0}; }
+    const_iterator end() const { return {this, count_}; }
+
+    /**
+     * @brief The passwords back to back, bytes() characters
+     */
+    char* data() { return arena_; }
+    const char* data() const { return arena_; }
+    size_t bytes() const { return used_; }
+
+    /**
+     * @brief Whether the kernel accepted the arena for huge pages
+     */
+    bool hugePages() const { return hugePages_; }
+
+    /**
+     * @brief Indices of the passwords the validator rejects, in order
+     *
+     * Validator is any type with bool validate(const char*, size_t) const,
+     * such as the validators in password_generator::validators.
+     */
+    template <typename Validator>
+    std::vector<size_t> findInvalid(const Validator& validator) const {
+        std::vector<size_t> invalid;
+        if (offsets_.empty()) {
+            for (size_t i = 0; i < count_; ++i) {
+                if (!validator.validate(arena_ + i * length_, length_)) {
+                    invalid.push_back(i);
+                }
+            }
+            return invalid;
+        }
+        for (size_t i = 0; i < count_; ++i) {
+            const std::string_view password = (*this)[i];
+            if (!validator.validate(password.data(), password.size())) {
+                invalid.push_back(i);
+            }
+        }
+        return invalid;
+    }
+
+    /**
+     * @brief Write every password followed by separator
+     *
+     * Lines are staged in a fixed buffer, wiped afterwards, and written in
+     * large blocks.
+     */
+    void writeLines(std::ostream& out, char separator = '\n') const;
+
+    /**
+     * @brief Zero every password in place; size and lengths are kept
+     */
+    void wipe() noexcept;
+
+    /**
+     * @brief Wipe and drop every password, keeping the arena for reuse
+     */
+    void clear() noexcept;
+
+private:
+    void grow(size_t bytes);
+    void ensureRoom(size_t bytes);
+    void release() noexcept;
+
+    char* arena_ = nullptr;
+    size_t capacity_ = 0;
+    size_t used_ = 0;
+    size_t count_ = 0;
+    size_t length_ = 0;
+    size_t reservedCount_ = 0;
+    Backing backing_ = Backing::Pages;
+    bool mapped_ = false;
+    bool hugePages_ = false;
+
+    // End offset of each password; empty while every length is length_
+    std::vector<uint64_t> offsets_;
+};
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // PASSWORD_BATCH_H
@@ -0,0 +1,19 @@
+#ifndef SECURE_MEMORY_H
+#define SECURE_MEMORY_H
+
+#include <cstddef>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief Zero memory holding secret material
+ *
+ * Unlike memset, the store is never elided by the optimizer.
+ */
+void secureWipe(void* data, size_t length) noexcept;
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // SECURE_MEMORY_H
@@ -1,7 +1,8 @@
 #ifndef SECURE_RANDOM_GENERATOR_H
 #define SECURE_RANDOM_GENERATOR_H
 
-#include "core/interfaces/IRandomGenerator.h"
+#include "utils/BulkRandomGenerator.h"
+#include "utils/IndexSampler.h"
 #include <memory>
 #include <random>
 
@@ -11,18 +12,49 @@ namespace utils {
 /**
  * @brief Cryptographically secure random number generator
  */
-class SecureRandomGenerator : public core::interfaces::IRandomGenerator {
+class SecureRandomGenerator : public IBulkRandomGenerator {
 public:
-    SecureRandomGenerator();
+    /**
+     * @brief Source of random words
+     *
+     * ChaCha20 serves draws from a buffered DRBG seeded by getrandom(2).
+     * Hardware reads RDRAND through HardwareRandomGenerator with inline
+     * health tests. HardwareSeed reads RDSEED instead, for callers that
+     * want conditioned entropy rather than DRBG output; it is about 18
+     * times slower. RandomDevice calls std::random_device for every draw
+     * and is kept for comparison.
+     */
+    enum class Backend {
+        ChaCha20,
+        Hardware,
+        HardwareSeed,
+        RandomDevice
+    };
+
+    explicit SecureRandomGenerator(Backend backend = Backend::ChaCha20);
     virtual ~SecureRandomGenerator();
     
     int generate(int min, int max) override;
     
+    void generateBounded(uint32_t* values, size_t count) override;
+    void generateIndices(uint32_t* out, size_t count, uint32_t bound) override;
+    void fillBytes(void* out, size_t length) override;
+    
     /**
      * @brief Re-seed the generator
      */
     void reseed();
 
+    /**
+     * @brief Get the active backend
+     */
+    Backend getBackend() const;
+
+    /**
+     * @brief Random words consumed versus indices produced so far
+     */
+    SamplerStats getSamplerStats() const;
+
 private:
     class Impl;
     std::unique_ptr<Impl> pImpl;
@@ -31,4 +63,4 @@ private:
 } // namespace utils
 } // namespace password_generator
 
-#endif // SECURE_RANDOM_GENERATOR_H
\ No newline at end of file
+#endif // SECURE_RANDOM_GENERATOR_H
@@ -0,0 +1,54 @@
+#ifndef SHA256_H
+#define SHA256_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief SHA-256 message digest (FIPS 180-4)
+ */
+class Sha256 {
+public:
+    static constexpr size_t DIGEST_SIZE = 32;
+    static constexpr size_t BLOCK_SIZE = 64;
+
+    using Digest = std::array<uint8_t, DIGEST_SIZE>;
+
+    Sha256();
+    ~Sha256();
+
+    void update(const void* data, size_t length);
+    Digest finish();
+
+    static Digest hash(const void* data, size_t length);
+
+private:
+    void compress(const uint8_t* block);
+
+    uint32_t state_[8];
+    uint8_t buffer_[BLOCK_SIZE];
+    size_t buffered_;
+    uint64_t totalLength_;
+};
+
+/**
+ * @brief HMAC-SHA-256 (RFC 2104)
+ */
+Sha256::Digest hmacSha256(const void* key, size_t keyLength,
+                          const void* data, size_t dataLength);
+
+/**
+ * @brief PBKDF2 with HMAC-SHA-256 as the PRF (RFC 8018)
+ */
+void pbkdf2HmacSha256(const void* password, size_t passwordLength,
+                      const void* salt, size_t saltLength,
+                      uint32_t iterations, uint8_t* out, size_t outLength);
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // SHA256_H
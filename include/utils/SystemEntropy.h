@@ -0,0 +1,22 @@
+#ifndef SYSTEM_ENTROPY_H
+#define SYSTEM_ENTROPY_H
+
+#include <cstddef>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief Fill a buffer with entropy from the operating system
+ *
+ * Uses getrandom(2) on Linux and getentropy(3) on macOS, falling back to
+ * std::random_device elsewhere. Blocks until the kernel pool is initialized.
+ *
+ * @throws std::runtime_error if the system entropy source fails
+ */
+void fillSystemEntropy(void* buffer, size_t length);
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // SYSTEM_ENTROPY_H
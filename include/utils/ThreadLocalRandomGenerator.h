@@ -0,0 +1,64 @@
+#ifndef THREAD_LOCAL_RANDOM_GENERATOR_H
+#define THREAD_LOCAL_RANDOM_GENERATOR_H
+
+#include "utils/BulkRandomGenerator.h"
+#include "utils/ChaCha20Drbg.h"
+#include "utils/IndexSampler.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief Handle to the calling thread's own ChaCha20 generator
+ *
+ * The handle itself holds no state. Each thread that draws through it gets
+ * a private ChaCha20Drbg, created lazily on first use and wiped when the
+ * thread exits, so one handle can be shared by any number of threads
+ * without locking.
+ *
+ * Per-thread state lives in pages marked MADV_WIPEONFORK where the kernel
+ * supports it, and a pthread_atfork generation counter covers the rest.
+ * Either way a forked child reseeds before its first draw, so parent and
+ * child never share keystream.
+ */
+class ThreadLocalRandomGenerator : public IBulkRandomGenerator {
+public:
+    int generate(int min, int max) override;
+    void generateBounded(uint32_t* values, size_t count) override;
+    void generateIndices(uint32_t* out, size_t count, uint32_t bound) override;
+    void fillBytes(void* out, size_t length) override;
+
+    /**
+     * @brief The calling thread's generator, created on first use
+     */
+    static ChaCha20Drbg& current();
+
+    /**
+     * @brief Random words consumed versus indices produced on the calling thread
+     */
+    static SamplerStats samplerStats();
+
+    /**
+     * @brief Number of threads currently holding generator state
+     */
+    static size_t liveStates();
+};
+
+/**
+ * @brief Raw 64-bit words from the calling thread's generator
+ *
+ * For code that takes its generator as a template parameter and samples
+ * from words itself; no virtual call is involved.
+ */
+struct ThreadLocalWordSource {
+    uint64_t next64() {
+        return ThreadLocalRandomGenerator::current().next64();
+    }
+};
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // THREAD_LOCAL_RANDOM_GENERATOR_H
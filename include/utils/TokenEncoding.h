@@ -0,0 +1,86 @@
+#ifndef TOKEN_ENCODING_H
+#define TOKEN_ENCODING_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief Text encodings for random token bodies
+ *
+ * Base32 is RFC 4648 (A-Z2-7) and base64url is RFC 4648 section 5, both
+ * unpadded. Base58 is the Bitcoin alphabet, which drops 0OIl.
+ */
+enum class TokenEncoding {
+    Hex,
+    Base32,
+    Base58,
+    Base64Url
+};
+
+/**
+ * @brief The encoding's digits in order of value
+ */
+const char* tokenAlphabet(TokenEncoding encoding);
+
+/**
+ * @brief Characters needed to carry byteCount bytes of entropy
+ *
+ * For base58 this is the smallest length whose 58^n values cover
+ * 256^byteCount, since base58 bodies are drawn directly (see
+ * AlphabetKernel) rather than converted from bytes.
+ */
+size_t encodedLength(TokenEncoding encoding, size_t byteCount);
+
+/**
+ * @brief Lowercase hex; writes 2 * count characters
+ *
+ * The bulk of the input goes through a pshufb nibble lookup, 16 bytes
+ * per step with SSSE3 and 32 with AVX2, and the rest byte by byte.
+ */
+void encodeHex(const uint8_t* bytes, size_t count, char* out);
+
+/**
+ * @brief Unpadded base32; writes encodedLength(Base32, count) characters
+ *
+ * Each 5-byte group becomes 8 characters. The SIMD path gathers every
+ * character's two source bytes into a 16-bit lane with pshufb, shifts
+ * them into place with one multiply by a per-lane power of two, and maps
+ * the 5-bit values to A-Z2-7 with a compare and add.
+ */
+void encodeBase32(const uint8_t* bytes, size_t count, char* out);
+
+/**
+ * @brief Unpadded base64url; writes encodedLength(Base64Url, count) characters
+ *
+ * The SIMD path is Mula and Lemire's: pshufb spreads each 3-byte group
+ * over a 32-bit lane, multiplies split out the four 6-bit fields, and a
+ * 16-entry pshufb table adds each field's range offset.
+ */
+void encodeBase64Url(const uint8_t* bytes, size_t count, char* out);
+
+/**
+ * @brief Same output as the functions above with the SIMD paths disabled
+ */
+void encodeHexScalar(const uint8_t* bytes, size_t count, char* out);
+void encodeBase32Scalar(const uint8_t* bytes, size_t count, char* out);
+void encodeBase64UrlScalar(const uint8_t* bytes, size_t count, char* out);
+
+/**
+ * @brief Write value as exactly width digits of the encoding, most
+ *        significant first
+ */
+void encodeFixedWidth(TokenEncoding encoding, uint64_t value, size_t width, char* out);
+
+/**
+ * @brief Inverse of encodeFixedWidth
+ * @return False if a character is not a digit of the encoding
+ */
+bool decodeFixedWidth(TokenEncoding encoding, const char* digits, size_t width, uint64_t& value);
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // TOKEN_ENCODING_H
@@ -0,0 +1,36 @@
+#ifndef UNICODE_CATEGORY_H
+#define UNICODE_CATEGORY_H
+
+#include <cstdint>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief Password-relevant category of a code point
+ *
+ * OTHER covers controls, spaces, format characters, surrogates and
+ * noncharacters: code points that must never appear in a generated
+ * password.
+ */
+enum class UnicodeCategory : uint8_t {
+    UPPERCASE,
+    LOWERCASE,
+    DIGIT,
+    SYMBOL,
+    OTHER
+};
+
+/**
+ * @brief Category of a code point, independent of the C locale
+ *
+ * A binary search over a compact, sorted range table. Letters are
+ * classified for ASCII, Latin-1, Latin Extended-A, Greek and Cyrillic;
+ * every other printable code point is a SYMBOL.
+ */
+UnicodeCategory unicodeCategory(char32_t codePoint);
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // UNICODE_CATEGORY_H
@@ -0,0 +1,31 @@
+#ifndef UNIFORM_RANK_H
+#define UNIFORM_RANK_H
+
+#include "core/interfaces/IRandomGenerator.h"
+#include "utils/BigUint.h"
+#include <cstdint>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief Uniform value in [0, bound)
+ *
+ * Draws bound's bit length in bytes, masks the top byte and rejects values
+ * at or above bound, so fewer than two draws are needed on average.
+ * @param bound Must be nonzero
+ */
+BigUint drawBelow(core::interfaces::IRandomGenerator& rng, const BigUint& bound);
+
+/**
+ * @brief Largest q < limit with unit * q <= rank
+ *
+ * Used to split a rank into (member, suffix rank) when unit counts the
+ * suffixes that follow each member; limit must be at least 1.
+ */
+uint32_t quotientBelow(const BigUint& rank, const BigUint& unit, uint32_t limit);
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // UNIFORM_RANK_H
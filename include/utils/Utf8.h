@@ -0,0 +1,34 @@
+#ifndef UTF8_H
+#define UTF8_H
+
+#include <cstddef>
+#include <string_view>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief Decode the code point starting at text[pos] and advance pos past it
+ *
+ * Overlong forms, surrogates and values above U+10FFFF are malformed; a
+ * malformed byte decodes as itself and advances pos by one, so every byte
+ * of any input is consumed exactly once.
+ * @return false if the sequence was malformed
+ */
+bool decodeUtf8(std::string_view text, size_t& pos, char32_t& codePoint);
+
+/**
+ * @brief Encode a code point into out (at least 4 bytes)
+ * @return Bytes written, or 0 if the code point is not encodable
+ */
+size_t encodeUtf8(char32_t codePoint, char* out);
+
+/**
+ * @brief Number of code points in text; malformed bytes count one each
+ */
+size_t utf8Length(std::string_view text);
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // UTF8_H
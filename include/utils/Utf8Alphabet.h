@@ -0,0 +1,112 @@
+#ifndef UTF8_ALPHABET_H
+#define UTF8_ALPHABET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace password_generator {
+namespace utils {
+
+/**
+ * @brief Alphabet of code points stored as pre-encoded UTF-8
+ *
+ * Each code point is encoded once, when the alphabet is built, into a
+ * fixed 4-byte slot. Writing a character is then a 4-byte copy followed
+ * by advancing the output by its encoded length, with no per-character
+ * encoding and no branch on the length. When every entry has the same
+ * length, stride() reports it and callers can size output exactly.
+ *
+ * Code points are kept in ascending order without duplicates. Controls,
+ * spaces and other invisible code points (UnicodeCategory::OTHER) are
+ * rejected.
+ */
+class Utf8Alphabet {
+public:
+    Utf8Alphabet() = default;
+
+    /**
+     * @brief Code points of a UTF-8 string
+     * @throws std::invalid_argument on malformed UTF-8 or invisible code points
+     */
+    static Utf8Alphabet fromString(std::string_view utf8);
+
+    /**
+     * @brief Code points first..last that are not invisible
+     * @throws std::invalid_argument if first > last or last is above U+10FFFF
+     */
+    static Utf8Alphabet fromRange(char32_t first, char32_t last);
+
+    /**
+     * @brief Built-in alphabet: "latin1", "latin-ext", "greek", "cyrillic" or "symbols"
+     *
+     * Letters of Latin-1 (accented Latin), Latin Extended-A, the Greek and
+     * Russian alphabets, and the printable Latin-1 signs. None contains
+     * emoji or combining marks.
+     * @throws std::invalid_argument for an unknown name
+     */
+    static Utf8Alphabet named(const std::string& name);
+
+    /**
+     * @brief Names accepted by named()
+     */
+    static const std::vector<std::string>& names();
+
+    /**
+     * @brief Add every code point of other
+     */
+    void merge(const Utf8Alphabet& other);
+
+    bool empty() const { return codePoints_.empty(); }
+    size_t size() const { return codePoints_.size(); }
+
+    char32_t codePoint(size_t i) const { return codePoints_[i]; }
+    size_t encodedLength(size_t i) const { return lengths_[i]; }
+
+    /**
+     * @brief Longest encoded length, 0 when empty
+     */
+    size_t maxEncodedLength() const { return maxLength_; }
+
+    /**
+     * @brief Common encoded length of every entry, or 0 if lengths differ
+     */
+    size_t stride() const { return stride_; }
+
+    /**
+     * @brief Copy entry i to out and return its length
+     *
+     * Always writes 4 bytes; bytes past the returned length are scratch
+     * that the next copy overwrites.
+     */
+    size_t copyTo(size_t i, char* out) const {
+        std::memcpy(out, slots_[i].bytes, sizeof(slots_[i].bytes));
+        return lengths_[i];
+    }
+
+    /**
+     * @brief The alphabet as one UTF-8 string
+     */
+    std::string toString() const;
+
+private:
+    struct Slot {
+        char bytes[4];
+    };
+
+    void rebuild();
+
+    std::vector<char32_t> codePoints_;
+    std::vector<Slot> slots_;
+    std::vector<uint8_t> lengths_;
+    size_t maxLength_ = 0;
+    size_t stride_ = 0;
+};
+
+} // namespace utils
+} // namespace password_generator
+
+#endif // UTF8_ALPHABET_H
@@ -2,25 +2,67 @@
 #define CHARACTER_TYPE_VALIDATOR_H
 
 #include "core/interfaces/IPasswordValidator.h"
+#include "utils/CharacterTable.h"
+#include <cstddef>
 
 namespace password_generator {
 namespace validators {
 
 /**
  * @brief Validates presence of required character types
+ *
+ * Passwords are read as UTF-8 and classified per code point; a malformed
+ * byte counts as a symbol.
  */
 class CharacterTypeValidator : public core::interfaces::IPasswordValidator {
 public:
+    /**
+     * @brief Character type bits; every character has exactly one type
+     */
+    enum Type : unsigned {
+        UPPERCASE = 1u << 0,
+        LOWERCASE = 1u << 1,
+        DIGIT = 1u << 2,
+        SYMBOL = 1u << 3
+    };
+
     CharacterTypeValidator(bool requireUpper = true, bool requireLower = true,
                           bool requireDigit = true, bool requireSymbol = false);
     
     bool validate(const std::string& password) const override;
+    
+    /**
+     * @brief Validate length bytes at password without allocating
+     */
+    bool validate(const char* password, size_t length) const;
     std::string getErrorMessage() const override;
     
     void setRequireUppercase(bool require);
     void setRequireLowercase(bool require);
     void setRequireDigit(bool require);
     void setRequireSymbol(bool require);
+    
+    /**
+     * @brief Type of a character; anything outside A-Z, a-z and 0-9 is a symbol
+     */
+    static constexpr Type typeOf(char c) {
+        // Same tables the providers draw from, independent of the C locale
+        return utils::tables::UPPERCASE.contains(c) ? UPPERCASE
+             : utils::tables::LOWERCASE.contains(c) ? LOWERCASE
+             : utils::tables::DIGITS.contains(c) ? DIGIT
+             : SYMBOL;
+    }
+    
+    /**
+     * @brief Type of a code point from the utils::unicodeCategory table;
+     *        letters without case and invisible code points are symbols
+     */
+    static Type typeOf(char32_t codePoint);
+    
+    /**
+     * @brief Required types as a mask of Type bits
+     */
+    unsigned getRequiredTypes() const;
 
 private:
     bool requireUpper_;
@@ -3,6 +3,7 @@
 
 #include "core/interfaces/IPasswordValidator.h"
 #include <cstddef>
+#include <string_view>
 
 namespace password_generator {
 namespace validators {
@@ -15,13 +16,18 @@ public:
     explicit EntropyValidator(double minEntropy);
     
     bool validate(const std::string& password) const override;
+    
+    /**
+     * @brief Validate length bytes at password without allocating
+     */
+    bool validate(const char* password, size_t length) const;
     std::string getErrorMessage() const override;
     
     void setMinEntropy(double entropy);
     double getMinEntropy() const;
 
 private:
-    double calculateEntropy(const std::string& password) const;
+    double calculateEntropy(std::string_view password) const;
     
     double minEntropy_;
 };
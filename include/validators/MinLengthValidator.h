@@ -15,6 +15,11 @@ public:
     explicit MinLengthValidator(size_t minLength);
     
     bool validate(const std::string& password) const override;
+    
+    /**
+     * @brief Validate length bytes at password without allocating
+     */
+    bool validate(const char* password, size_t length) const;
     std::string getErrorMessage() const override;
     
     void setMinLength(size_t length);
@@ -149,6 +149,9 @@ if [[ ! -f "$TEST_EXECUTABLE" ]]; then
     exit 1
 fi
 
+# Allocation tests replace operator new, so they live in their own binary
+ALLOCATION_EXECUTABLE="$BUILD_DIR/tests/password_generator_allocation_tests"
+
 # Run tests
 print_status "Running tests..."
 
@@ -171,7 +174,7 @@ fi
 print_status "Executing: $TEST_CMD"
 echo "----------------------------------------"
 
-if eval "$TEST_CMD"; then
+if eval "$TEST_CMD" && { [[ ! -f "$ALLOCATION_EXECUTABLE" ]] || "$ALLOCATION_EXECUTABLE"; }; then
     echo "----------------------------------------"
     print_success "All tests passed! ✅"
     
@@ -1,13 +1,101 @@
 #include "cli/commands/ActionCommands.h"
 #include "cli/commands/CommandContext.h"
+#include "strategies/ParallelBatchGenerator.h"
+#include "utils/PasswordBatch.h"
+#include "utils/SecureMemory.h"
+#include <algorithm>
+#include <functional>
+#include <future>
 #include <iostream>
 #include <iomanip>
 #include <memory>
+#include <string>
 
 namespace password_generator {
 namespace cli {
 namespace commands {
 
+namespace {
+
+using StrategyPtr = std::unique_ptr<core::interfaces::IPasswordStrategy>;
+using RandomPtr = std::unique_ptr<core::interfaces::IRandomGenerator>;
+
+// The configured core generator, validation and retries included, as a
+// strategy; each worker gets its own
+class ConfiguredGeneratorStrategy : public core::interfaces::IPasswordStrategy {
+public:
+    explicit ConfiguredGeneratorStrategy(const core::config::PasswordGeneratorConfig& config)
+        : generator(config) {}
+
+    std::string generate(size_t) override {
+        return generator.generate();
+    }
+
+private:
+    core::PasswordGenerator generator;
+};
+
+// Upper bound on the passwords in one chunk; larger batches are generated
+// and written one chunk at a time through two alternating arenas
+constexpr size_t CHUNK_BYTES = size_t(32) << 20;
+
+size_t chunkPasswords(size_t length) {
+    const size_t slice = strategies::ParallelBatchGenerator::SLICE_PASSWORDS;
+    const size_t chunk = length > 0 ? CHUNK_BYTES / length : CHUNK_BYTES;
+    // Whole slices keep every worker busy until the chunk's last slice
+    return chunk >= slice ? chunk / slice * slice : (chunk > 0 ? chunk : 1);
+}
+
+// Fills the batch with the next count passwords
+using ChunkSource = std::function<void(size_t count, utils::PasswordBatch& batch)>;
+
+// Passwords of one length, one strategy per worker thread; the pool lives
+// as long as the source
+ChunkSource parallelSource(const CommandContext& context,
+                           strategies::ParallelBatchGenerator::StrategyFactory factory,
+                           size_t length) {
+    auto generator = std::make_shared<strategies::ParallelBatchGenerator>(std::move(factory),
+                                                                          context.threads);
+    return [generator, length](size_t count, utils::PasswordBatch& batch) {
+        generator->generate(batch.appendUniform(count, length), count, length);
+    };
+}
+
+// Passwords from a strategy that returns strings, each wiped once it is
+// copied into the batch
+ChunkSource serialSource(std::shared_ptr<core::interfaces::IPasswordStrategy> strategy,
+                         size_t length) {
+    return [strategy, length](size_t count, utils::PasswordBatch& batch) {
+        batch.reserve(count, count * length);
+        for (size_t i = 0; i < count; ++i) {
+            std::string password = strategy->generate(length);
+            batch.append(password);
+            if (!password.empty()) {
+                utils::secureWipe(&password[0], password.size());
+            }
+        }
+    };
+}
+
+// Passwords first+1 onwards of a batch of total, one per line with -q or
+// in the numbered box otherwise
+void writeChunk(const CommandContext& context, const utils::PasswordBatch& batch, size_t first,
+                size_t total) {
+    if (context.quietMode) {
+        batch.writeLines(std::cout);
+        return;
+    }
+    if (first == 0) {
+        std::cout << "\n┌─ Generated " << total << " Passwords ────────────\n";
+    }
+    for (size_t i = 0; i < batch.size(); ++i) {
+        std::cout << "│ " << std::setw(3) << std::right << (first + i + 1) << ". "
+                  << std::setw(30) << std::left << batch[i] << "\n";
+    }
+}
+
+} // namespace
+
 std::unique_ptr<BatchCommand> BatchCommand::create(CommandContext& context) {
     if (!context.hasNextArg()) {
         std::cerr << "Error: --batch requires a count argument\n";
@@ -17,8 +105,8 @@ std::unique_ptr<BatchCommand> BatchCommand::create(CommandContext& context) {
     try {
         const std::string& countStr = context.getNextArg();
         size_t batchCount = std::stoul(countStr);
-        if (batchCount == 0 || batchCount > 100) {
-            std::cerr << "Error: Batch count must be between 1 and 100\n";
+        if (batchCount == 0 || batchCount > MAX_BATCH) {
+            std::cerr << "Error: Batch count must be between 1 and " << MAX_BATCH << "\n";
             return nullptr;
         }
         return std::make_unique<BatchCommand>(batchCount);
@@ -30,25 +118,103 @@ std::unique_ptr<BatchCommand> BatchCommand::create(CommandContext& context) {
 
 int BatchCommand::execute(CommandContext& context) {
     // Validate configuration
-    if (!context.config.includeLowercase && !context.config.includeUppercase &&
+    try {
+        context.checkModeOptions();
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    if (!context.tokenMode && !context.passphraseMode && context.unicodeAlphabets.empty() &&
+        !context.config.includeLowercase && !context.config.includeUppercase &&
         !context.config.includeDigits && !context.config.includeSymbols) {
         std::cerr << "Error: At least one character type must be enabled\n";
         return 1;
     }
 
-    context.generator.setConfig(context.config);
-    auto passwords = context.generator.generateBatch(batchCount);
+    // Fixed-length strategies fill the batch on every worker thread; the
+    // others return one string per password, copied in as they come
+    ChunkSource source;
+    std::shared_ptr<strategies::UniquePasswordStrategy> unique;
+    size_t length = context.config.length;
+    try {
+        if (context.tokenMode) {
+            length = context.createTokenStrategy()->tokenLength();
+            source = parallelSource(context, [&context](RandomPtr) -> StrategyPtr {
+                return context.createTokenStrategy();
+            }, length);
+        } else if (context.passphraseMode) {
+            source = serialSource(context.createPassphraseStrategy(), length);
+        } else if (context.uniqueMode) {
+            unique = context.createUniqueStrategy();
+            source = serialSource(unique, length);
+        } else if (context.compliantMode) {
+            // Built once here so configuration errors surface before any worker runs
+            context.createCompliantStrategy();
+            source = parallelSource(context, [&context](RandomPtr) -> StrategyPtr {
+                return context.createCompliantStrategy();
+            }, length);
+        } else if (!context.unicodeAlphabets.empty()) {
+            source = serialSource(context.createUnicodeStrategy(), length);
+        } else if (context.hasWeights() || context.hasFilters()) {
+            // Built once here so configuration errors surface before any worker runs
+            context.createStandardStrategy();
+            source = parallelSource(context, [&context](RandomPtr) -> StrategyPtr {
+                return context.createStandardStrategy();
+            }, length);
+        } else {
+            source = parallelSource(context, [&context](RandomPtr) -> StrategyPtr {
+                return std::make_unique<ConfiguredGeneratorStrategy>(context.config);
+            }, length);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
 
-    if (!context.quietMode) {
-        std::cout << "\n┌─ Generated " << batchCount << " Passwords ────────────\n";
-        for (size_t i = 0; i < passwords.size(); ++i) {
-            std::cout << "│ " << std::setw(3) << std::right << (i + 1) << ". "
-                      << std::setw(30) << std::left << passwords[i] << "\n";
+    // Two arenas take turns: while one chunk is written on a helper thread
+    // the next is generated into the other, so output does not stall the
+    // workers. Memory stays bounded by 2 * CHUNK_BYTES however large the batch
+    utils::PasswordBatch batches[2] = {
+        utils::PasswordBatch(utils::PasswordBatch::Backing::HugePages),
+        utils::PasswordBatch(utils::PasswordBatch::Backing::HugePages)};
+    std::future<void> writing;
+    const size_t chunk = chunkPasswords(length);
+    size_t done = 0;
+    for (size_t turn = 0; done < batchCount; turn ^= 1) {
+        // This arena's last write was waited for before the other one started
+        utils::PasswordBatch& batch = batches[turn];
+        batch.clear();
+        try {
+            source(std::min(chunk, batchCount - done), batch);
+        } catch (const std::exception& e) {
+            // Earlier chunks are already out; say how many, and where a
+            // unique run resumes, so a retry neither repeats nor skips them
+            if (writing.valid()) {
+                writing.get();
+            }
+            std::cerr << "Error: " << e.what() << "\n";
+            if (done > 0) {
+                std::cerr << done << " of " << batchCount << " passwords were written\n";
+            }
+            if (unique) {
+                context.reportUniquePosition(*unique);
+            }
+            return 1;
         }
-    } else {
-        for (const auto& password : passwords) {
-            std::cout << password << "\n";
+
+        if (writing.valid()) {
+            writing.get();
         }
+        writing = std::async(std::launch::async, [&context, &batch, total = batchCount, done]() {
+            writeChunk(context, batch, done, total);
+        });
+        done += batch.size();
+    }
+    if (writing.valid()) {
+        writing.get();
+    }
+    if (unique) {
+        context.reportUniquePosition(*unique);
     }
 
     return 0;
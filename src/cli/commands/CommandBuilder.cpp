@@ -4,6 +4,21 @@
 #include "cli/commands/SetLengthCommand.h"
 #include "cli/commands/ConfigCommands.h"
 #include "cli/commands/SetSymbolsCommand.h"
+#include "cli/commands/SetShardCommand.h"
+#include "cli/commands/SetStartCommand.h"
+#include "cli/commands/SetWeightCommand.h"
+#include "cli/commands/SetKeyFileCommand.h"
+#include "cli/commands/SetWordsCommand.h"
+#include "cli/commands/SetWordListCommand.h"
+#include "cli/commands/SetSeparatorCommand.h"
+#include "cli/commands/SetMaxRepeatCommand.h"
+#include "cli/commands/SetCharsetFileCommand.h"
+#include "cli/commands/SetAlphabetCommand.h"
+#include "cli/commands/SetTokenCommand.h"
+#include "cli/commands/SetBytesCommand.h"
+#include "cli/commands/SetPrefixCommand.h"
+#include "cli/commands/SetChecksumCommand.h"
+#include "cli/commands/SetThreadsCommand.h"
 #include "cli/commands/ActionCommands.h"
 
 namespace password_generator {
@@ -98,11 +113,111 @@ void CommandBuilder::initializeRegistry() {
             return SetSymbolsCommand::create(context);
         });
 
+    registerCommand({"--weight"},
+        [](CommandContext& context) -> std::unique_ptr<Command> {
+            return SetWeightCommand::create(context);
+        });
+
+    registerCommand({"--no-ambiguous"},
+        [](CommandContext&) -> std::unique_ptr<Command> {
+            return std::make_unique<NoAmbiguousCommand>();
+        });
+
+    registerCommand({"--no-adjacent"},
+        [](CommandContext&) -> std::unique_ptr<Command> {
+            return std::make_unique<NoAdjacentCommand>();
+        });
+
+    registerCommand({"--max-repeat"},
+        [](CommandContext& context) -> std::unique_ptr<Command> {
+            return SetMaxRepeatCommand::create(context);
+        });
+
+    registerCommand({"--charset-file"},
+        [](CommandContext& context) -> std::unique_ptr<Command> {
+            return SetCharsetFileCommand::create(context);
+        });
+
+    registerCommand({"--alphabet"},
+        [](CommandContext& context) -> std::unique_ptr<Command> {
+            return SetAlphabetCommand::create(context);
+        });
+
     registerCommand({"-p", "--pronounceable"},
         [](CommandContext&) -> std::unique_ptr<Command> {
             return std::make_unique<PronounceableCommand>();
         });
 
+    registerCommand({"-u", "--unique"},
+        [](CommandContext&) -> std::unique_ptr<Command> {
+            return std::make_unique<UniqueCommand>();
+        });
+
+    registerCommand({"--shard"},
+        [](CommandContext& context) -> std::unique_ptr<Command> {
+            return SetShardCommand::create(context);
+        });
+
+    registerCommand({"--start"},
+        [](CommandContext& context) -> std::unique_ptr<Command> {
+            return SetStartCommand::create(context);
+        });
+
+    registerCommand({"--key-file"},
+        [](CommandContext& context) -> std::unique_ptr<Command> {
+            return SetKeyFileCommand::create(context);
+        });
+
+    registerCommand({"--compliant"},
+        [](CommandContext&) -> std::unique_ptr<Command> {
+            return std::make_unique<CompliantCommand>();
+        });
+
+    registerCommand({"--passphrase"},
+        [](CommandContext&) -> std::unique_ptr<Command> {
+            return std::make_unique<PassphraseCommand>();
+        });
+
+    registerCommand({"--words"},
+        [](CommandContext& context) -> std::unique_ptr<Command> {
+            return SetWordsCommand::create(context);
+        });
+
+    registerCommand({"--wordlist"},
+        [](CommandContext& context) -> std::unique_ptr<Command> {
+            return SetWordListCommand::create(context);
+        });
+
+    registerCommand({"--separator"},
+        [](CommandContext& context) -> std::unique_ptr<Command> {
+            return SetSeparatorCommand::create(context);
+        });
+
+    registerCommand({"--token"},
+        [](CommandContext& context) -> std::unique_ptr<Command> {
+            return SetTokenCommand::create(context);
+        });
+
+    registerCommand({"--bytes"},
+        [](CommandContext& context) -> std::unique_ptr<Command> {
+            return SetBytesCommand::create(context);
+        });
+
+    registerCommand({"--prefix"},
+        [](CommandContext& context) -> std::unique_ptr<Command> {
+            return SetPrefixCommand::create(context);
+        });
+
+    registerCommand({"--checksum"},
+        [](CommandContext& context) -> std::unique_ptr<Command> {
+            return SetChecksumCommand::create(context);
+        });
+
+    registerCommand({"-j", "--threads"},
+        [](CommandContext& context) -> std::unique_ptr<Command> {
+            return SetThreadsCommand::create(context);
+        });
+
     registerCommand({"-q", "--quiet"},
         [](CommandContext&) -> std::unique_ptr<Command> {
             return std::make_unique<QuietCommand>();
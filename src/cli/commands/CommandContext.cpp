@@ -1,12 +1,32 @@
 #include "cli/commands/CommandContext.h"
+#include "providers/LowercaseProvider.h"
+#include "providers/UppercaseProvider.h"
+#include "providers/DigitProvider.h"
+#include "providers/SymbolProvider.h"
+#include "utils/SecureMemory.h"
 #include <iostream>
 #include <iomanip>
 #include <cmath>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
 
 namespace password_generator {
 namespace cli {
 namespace commands {
 
+namespace {
+
+// An optional set the filters empty is left out. A required one is still
+// added, so the strategy rejects it with the set's name instead of
+// quietly generating passwords without it
+bool keepsSet(const utils::CharacterFilter& filter,
+              const core::interfaces::ICharacterSetProvider& provider, bool required) {
+    return required || !filter.hasMask() || !filter.apply(provider.getCharacters()).empty();
+}
+
+} // namespace
+
 CommandContext::CommandContext(const std::string& programName)
     : programName(programName) {}
 
@@ -42,6 +62,237 @@ void CommandContext::showConfig() const {
     showConfigImpl();
 }
 
+std::unique_ptr<strategies::UniquePasswordStrategy> CommandContext::createUniqueStrategy() const {
+    if (hasWeights()) {
+        throw std::runtime_error("--weight cannot be combined with --unique");
+    }
+    if (compliantMode) {
+        throw std::runtime_error("--compliant cannot be combined with --unique");
+    }
+    if (hasFilters()) {
+        throw std::runtime_error("Character filters cannot be combined with --unique");
+    }
+    if (!unicodeAlphabets.empty()) {
+        throw std::runtime_error("--alphabet cannot be combined with --unique");
+    }
+    if (config.pronounceable) {
+        throw std::runtime_error("--pronounceable cannot be combined with --unique");
+    }
+    std::string keyMaterial;
+    if (!keyFile.empty()) {
+        std::ifstream in(keyFile, std::ios::binary);
+        if (!in) {
+            throw std::runtime_error("Cannot read key file '" + keyFile + "'");
+        }
+        keyMaterial.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        if (keyMaterial.size() < 16) {
+            utils::secureWipe(&keyMaterial[0], keyMaterial.size());
+            throw std::runtime_error("Key file must contain at least 16 bytes");
+        }
+    } else if (shardCount > 1) {
+        throw std::runtime_error("--shard requires --key-file so shards share one key");
+    }
+
+    auto strategy = std::make_unique<strategies::UniquePasswordStrategy>(keyMaterial);
+    if (!keyMaterial.empty()) {
+        utils::secureWipe(&keyMaterial[0], keyMaterial.size());
+    }
+
+    if (config.includeLowercase) {
+        strategy->addCharacterSet(std::make_unique<providers::LowercaseProvider>());
+    }
+    if (config.includeUppercase) {
+        strategy->addCharacterSet(std::make_unique<providers::UppercaseProvider>());
+    }
+    if (config.includeDigits) {
+        strategy->addCharacterSet(std::make_unique<providers::DigitProvider>());
+    }
+    if (config.includeSymbols) {
+        strategy->addCharacterSet(std::make_unique<providers::SymbolProvider>(config.customSymbols));
+    }
+    strategy->setShard(shardIndex, shardCount);
+    strategy->setPosition(uniqueStart);
+    return strategy;
+}
+
+void CommandContext::reportUniquePosition(const strategies::UniquePasswordStrategy& strategy) const {
+    // Without --key-file each run draws a fresh key, so no position carries over
+    if (keyFile.empty()) {
+        return;
+    }
+    // Stderr keeps the note out of piped password output
+    std::cerr << "Next unique position: " << strategy.getPosition()
+              << " (continue with --start " << strategy.getPosition() << ")\n";
+}
+
+bool CommandContext::hasWeights() const {
+    return lowercaseWeight != uppercaseWeight || lowercaseWeight != digitWeight ||
+           lowercaseWeight != symbolWeight;
+}
+
+bool CommandContext::hasFilters() const {
+    return !filter.isEmpty();
+}
+
+std::unique_ptr<strategies::StandardPasswordStrategy> CommandContext::createStandardStrategy() const {
+    if (config.pronounceable) {
+        throw std::runtime_error("--weight and character filters cannot be combined with --pronounceable");
+    }
+    auto strategy = std::make_unique<strategies::StandardPasswordStrategy>();
+    strategy->setFilter(filter);
+    auto add = [&](std::unique_ptr<core::interfaces::ICharacterSetProvider> provider,
+                   double weight, bool required) {
+        if (keepsSet(filter, *provider, required)) {
+            strategy->addCharacterSet(std::move(provider), weight);
+        }
+    };
+    if (config.includeLowercase) {
+        add(std::make_unique<providers::LowercaseProvider>(), lowercaseWeight, config.requireMixedCase);
+    }
+    if (config.includeUppercase) {
+        add(std::make_unique<providers::UppercaseProvider>(), uppercaseWeight, config.requireMixedCase);
+    }
+    if (config.includeDigits) {
+        add(std::make_unique<providers::DigitProvider>(), digitWeight, config.requireDigits);
+    }
+    if (config.includeSymbols) {
+        add(std::make_unique<providers::SymbolProvider>(config.customSymbols), symbolWeight,
+            config.requireSymbols);
+    }
+    return strategy;
+}
+
+std::unique_ptr<strategies::CompliantPasswordStrategy> CommandContext::createCompliantStrategy() const {
+    if (hasWeights()) {
+        throw std::runtime_error("--weight cannot be combined with --compliant");
+    }
+    if (!unicodeAlphabets.empty()) {
+        throw std::runtime_error("--alphabet cannot be combined with --compliant");
+    }
+    if (config.pronounceable) {
+        throw std::runtime_error("--pronounceable cannot be combined with --compliant");
+    }
+    auto strategy = std::make_unique<strategies::CompliantPasswordStrategy>();
+    strategy->setFilter(filter);
+    auto add = [&](std::unique_ptr<core::interfaces::ICharacterSetProvider> provider, bool required) {
+        if (keepsSet(filter, *provider, required)) {
+            strategy->addCharacterSet(std::move(provider));
+        }
+    };
+    if (config.includeLowercase) {
+        add(std::make_unique<providers::LowercaseProvider>(), config.requireMixedCase);
+    }
+    if (config.includeUppercase) {
+        add(std::make_unique<providers::UppercaseProvider>(), config.requireMixedCase);
+    }
+    if (config.includeDigits) {
+        add(std::make_unique<providers::DigitProvider>(), config.requireDigits);
+    }
+    if (config.includeSymbols) {
+        add(std::make_unique<providers::SymbolProvider>(config.customSymbols), config.requireSymbols);
+    }
+
+    // Requirements apply to the enabled sets only, as --no-digits overrides requireDigits
+    using validators::CharacterTypeValidator;
+    strategy->setRequirements(CharacterTypeValidator(
+        config.requireMixedCase && config.includeUppercase,
+        config.requireMixedCase && config.includeLowercase,
+        config.requireDigits && config.includeDigits,
+        config.requireSymbols && config.includeSymbols));
+    strategy->setLengthRange(config.minLength, config.maxLength);
+    return strategy;
+}
+
+std::unique_ptr<strategies::UnicodePasswordStrategy> CommandContext::createUnicodeStrategy() const {
+    if (hasWeights() || hasFilters()) {
+        throw std::runtime_error("--weight and character filters cannot be combined with --alphabet");
+    }
+    if (config.pronounceable) {
+        throw std::runtime_error("--pronounceable cannot be combined with --alphabet");
+    }
+    auto strategy = std::make_unique<strategies::UnicodePasswordStrategy>();
+    if (config.includeLowercase) {
+        strategy->addCharacterSet(std::make_unique<providers::LowercaseProvider>());
+    }
+    if (config.includeUppercase) {
+        strategy->addCharacterSet(std::make_unique<providers::UppercaseProvider>());
+    }
+    if (config.includeDigits) {
+        strategy->addCharacterSet(std::make_unique<providers::DigitProvider>());
+    }
+    if (config.includeSymbols) {
+        strategy->addCharacterSet(std::make_unique<providers::SymbolProvider>(config.customSymbols));
+    }
+    for (const std::string& name : unicodeAlphabets) {
+        strategy->addAlphabet(utils::Utf8Alphabet::named(name));
+    }
+
+    // The same checks PasswordGenerator's validators make, with lengths in
+    // code points; requirements apply to the enabled sets only
+    if (config.length < config.minLength || config.length > config.maxLength) {
+        throw std::runtime_error("Length " + std::to_string(config.length) +
+                                 " is outside the allowed range " +
+                                 std::to_string(config.minLength) + "-" +
+                                 std::to_string(config.maxLength));
+    }
+    using validators::CharacterTypeValidator;
+    strategy->setRequirements(CharacterTypeValidator(
+        config.requireMixedCase && config.includeUppercase,
+        config.requireMixedCase && config.includeLowercase,
+        config.requireDigits && config.includeDigits,
+        config.requireSymbols && config.includeSymbols));
+    return strategy;
+}
+
+std::unique_ptr<strategies::PassphrasePasswordStrategy> CommandContext::createPassphraseStrategy() const {
+    if (wordListFile.empty()) {
+        throw std::runtime_error("--passphrase requires --wordlist <file>");
+    }
+    if (uniqueMode) {
+        throw std::runtime_error("--passphrase cannot be combined with --unique");
+    }
+    if (hasWeights()) {
+        throw std::runtime_error("--weight cannot be combined with --passphrase");
+    }
+    if (hasFilters()) {
+        throw std::runtime_error("Character filters cannot be combined with --passphrase");
+    }
+    if (config.pronounceable) {
+        throw std::runtime_error("--pronounceable cannot be combined with --passphrase");
+    }
+    if (!unicodeAlphabets.empty()) {
+        throw std::runtime_error("--alphabet cannot be combined with --passphrase");
+    }
+    auto strategy = std::make_unique<strategies::PassphrasePasswordStrategy>(wordListFile);
+    strategy->setWordCount(passphraseWords);
+    strategy->setSeparator(passphraseSeparator);
+    return strategy;
+}
+
+void CommandContext::checkModeOptions() const {
+    if (passphraseOptions && !passphraseMode) {
+        throw std::runtime_error("--words, --wordlist and --separator require --passphrase");
+    }
+}
+
+std::unique_ptr<strategies::TokenPasswordStrategy> CommandContext::createTokenStrategy() const {
+    if (passphraseMode || uniqueMode || compliantMode) {
+        throw std::runtime_error("--token cannot be combined with --passphrase, --unique or --compliant");
+    }
+    if (hasWeights() || hasFilters() || !unicodeAlphabets.empty()) {
+        throw std::runtime_error("--weight, character filters and --alphabet cannot be combined with --token");
+    }
+    if (config.pronounceable) {
+        throw std::runtime_error("--pronounceable cannot be combined with --token");
+    }
+    auto strategy = std::make_unique<strategies::TokenPasswordStrategy>();
+    strategy->setEncoding(tokenEncoding);
+    strategy->setBytes(tokenBytes);
+    strategy->setPrefix(tokenPrefix);
+    strategy->setChecksum(tokenChecksum);
+    return strategy;
+}
+
 void CommandContext::showUsageImpl() const {
     std::cout << "dbgpass v1.0.0 - Debug Industries Pass\n";
     std::cout << "Usage: " << programName << " [options]\n\n";
@@ -49,16 +300,40 @@ void CommandContext::showUsageImpl() const {
     std::cout << "  -h, --help              Show this help message\n";
     std::cout << "      --version           Show version information\n";
     std::cout << "  -g, --generate          Generate a single password\n";
-    std::cout << "  -b, --batch <count>     Generate multiple passwords\n";
+    std::cout << "  -b, --batch <count>     Generate multiple passwords (up to 100000000)\n";
+    std::cout << "  -j, --threads <n>       Batch threads (default: CPUs allowed by the cgroup quota)\n";
     std::cout << "  -l, --length <n>        Set password length (8-128)\n";
     std::cout << "      --no-lowercase      Exclude lowercase characters\n";
     std::cout << "      --no-uppercase      Exclude uppercase characters\n";
     std::cout << "      --no-digits         Exclude digit characters\n";
     std::cout << "      --no-symbols        Exclude symbol characters\n";
     std::cout << "  -s, --symbols <chars>   Set custom symbol set\n";
+    std::cout << "      --weight <set>=<w>  Relative weight of lower, upper, digits or symbols\n";
+    std::cout << "      --no-ambiguous      Exclude look-alike characters (0O1lI|)\n";
+    std::cout << "      --max-repeat <k>    Use no character more than k times\n";
+    std::cout << "      --no-adjacent       Never repeat a character twice in a row\n";
+    std::cout << "      --charset-file <p>  Only use characters listed in a file\n";
+    std::cout << "      --alphabet <name>   Add latin1, latin-ext, greek, cyrillic or symbols\n";
     std::cout << "  -p, --pronounceable     Generate pronounceable password\n";
     std::cout << "  -c, --config            Show current configuration\n";
     std::cout << "  -v, --validate <pass>   Validate a password\n";
+    std::cout << "  -u, --unique            Never repeat a password under one key\n";
+    std::cout << "      --shard <i/N>       Emit shard i of N in unique mode\n";
+    std::cout << "      --key-file <path>   Key shared by unique-mode shards\n";
+    std::cout << "      --start <n>         Unique-mode position to resume from (default 0);\n";
+    std::cout << "                          passwords are unique only within one key, shard\n";
+    std::cout << "                          and position range, so resume where the last run\n";
+    std::cout << "                          reported it stopped\n";
+    std::cout << "      --compliant         Sample uniformly from passwords meeting the requirements\n";
+    std::cout << "      --passphrase        Generate a passphrase from a word list\n";
+    std::cout << "      --words <n>         Words per passphrase (1-64, default 6)\n";
+    std::cout << "      --wordlist <path>   Compiled word list (see dbgpass-wordlist)\n";
+    std::cout << "      --separator <text>  Text between passphrase words (default -); must\n";
+    std::cout << "                          not occur in any word\n";
+    std::cout << "      --token <enc>       Generate API tokens: hex, base32, base58 or base64url\n";
+    std::cout << "      --bytes <n>         Random bytes per token (16-1048576, default 32)\n";
+    std::cout << "      --prefix <text>     Text placed before each token, e.g. xyz_\n";
+    std::cout << "      --checksum <name>   Token checksum: crc32 (default), crc32c or none\n";
     std::cout << "  -q, --quiet             Suppress prompts and decorations\n\n";
     std::cout << "Examples:\n";
     std::cout << "  " << programName << " -g                 # Generate one password\n";
@@ -66,6 +341,15 @@ void CommandContext::showUsageImpl() const {
     std::cout << "  " << programName << " -b 5               # Generate 5 passwords\n";
     std::cout << "  " << programName << " -g --no-symbols    # No symbols\n";
     std::cout << "  " << programName << " -p -l 12           # Pronounceable 12-char password\n";
+    std::cout << "  " << programName << " --weight symbols=0.5 -g  # Half as many symbols\n";
+    std::cout << "  " << programName << " --no-ambiguous --no-adjacent -g  # Easy to read aloud\n";
+    std::cout << "  " << programName << " --alphabet cyrillic -l 12 -g  # Unicode, length in characters\n";
+    std::cout << "  " << programName << " -u -b 50 --key-file k --shard 0/4  # Unique, shard 0 of 4\n";
+    std::cout << "  " << programName << " -u -b 50 --key-file k --start 50  # Resume after a run\n";
+    std::cout << "  " << programName << " --compliant -l 8 -g  # Every required type, no retries\n";
+    std::cout << "  " << programName << " --passphrase --words 5 --wordlist eff.wl -g  # Passphrase\n";
+    std::cout << "  " << programName << " --token base58 --prefix xyz_ -q -g  # API key with checksum\n";
+    std::cout << "  " << programName << " -q -b 10000000 -j 8 > passwords.txt  # Parallel batch\n";
 }
 
 void CommandContext::showConfigImpl() const {
@@ -25,11 +25,36 @@ int NoSymbolsCommand::execute(CommandContext& context) {
     return 0;
 }
 
+int NoAmbiguousCommand::execute(CommandContext& context) {
+    context.filter.excludeAmbiguous();
+    return 0;
+}
+
+int NoAdjacentCommand::execute(CommandContext& context) {
+    context.filter.setNoAdjacentRepeat(true);
+    return 0;
+}
+
 int PronounceableCommand::execute(CommandContext& context) {
     context.config.pronounceable = true;
     return 0;
 }
 
+int UniqueCommand::execute(CommandContext& context) {
+    context.uniqueMode = true;
+    return 0;
+}
+
+int PassphraseCommand::execute(CommandContext& context) {
+    context.passphraseMode = true;
+    return 0;
+}
+
+int CompliantCommand::execute(CommandContext& context) {
+    context.compliantMode = true;
+    return 0;
+}
+
 int QuietCommand::execute(CommandContext& context) {
     context.quietMode = true;
     return 0;
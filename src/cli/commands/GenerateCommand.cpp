@@ -1,5 +1,6 @@
 #include "cli/commands/ActionCommands.h"
 #include "cli/commands/CommandContext.h"
+#include "utils/Utf8.h"
 #include <iostream>
 #include <iomanip>
 #include <cmath>
@@ -10,31 +11,105 @@ namespace commands {
 
 int GenerateCommand::execute(CommandContext& context) {
     // Validate configuration
-    if (!context.config.includeLowercase && !context.config.includeUppercase &&
+    try {
+        context.checkModeOptions();
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    if (!context.tokenMode && !context.passphraseMode && context.unicodeAlphabets.empty() &&
+        !context.config.includeLowercase && !context.config.includeUppercase &&
         !context.config.includeDigits && !context.config.includeSymbols) {
         std::cerr << "Error: At least one character type must be enabled\n";
         return 1;
     }
 
-    context.generator.setConfig(context.config);
-    std::string password = context.generator.generate();
+    // Strategies that know their own entropy report it here; otherwise
+    // each character is assumed uniform over the enabled sets
+    std::string password;
+    double entropy = -1.0;
+    if (context.tokenMode) {
+        try {
+            auto strategy = context.createTokenStrategy();
+            password = strategy->generateToken();
+            entropy = strategy->getEntropyBits();
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << "\n";
+            return 1;
+        }
+    } else if (context.passphraseMode) {
+        try {
+            auto strategy = context.createPassphraseStrategy();
+            password = strategy->generate(context.config.length);
+            entropy = strategy->getEntropyBits();
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << "\n";
+            return 1;
+        }
+    } else if (context.uniqueMode) {
+        try {
+            auto strategy = context.createUniqueStrategy();
+            password = strategy->generate(context.config.length);
+            context.reportUniquePosition(*strategy);
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << "\n";
+            return 1;
+        }
+    } else if (context.compliantMode) {
+        try {
+            auto strategy = context.createCompliantStrategy();
+            password = strategy->generate(context.config.length);
+            entropy = strategy->getEntropyBits(password.length());
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << "\n";
+            return 1;
+        }
+    } else if (!context.unicodeAlphabets.empty()) {
+        try {
+            auto strategy = context.createUnicodeStrategy();
+            password = strategy->generate(context.config.length);
+            entropy = strategy->getEntropyBits(context.config.length);
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << "\n";
+            return 1;
+        }
+    } else if (context.hasWeights() || context.hasFilters()) {
+        try {
+            auto strategy = context.createStandardStrategy();
+            password = strategy->generate(context.config.length);
+            entropy = strategy->getEntropyBits(password.length());
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << "\n";
+            return 1;
+        }
+    } else {
+        context.generator.setConfig(context.config);
+        password = context.generator.generate();
+    }
 
     if (!context.quietMode) {
+        // Width and length are in code points; setw would count bytes
+        const size_t characters = utils::utf8Length(password);
         std::cout << "\n┌─ Generated Password ─────────────────┐\n";
-        std::cout << "│ " << std::setw(36) << std::left << password << " │\n";
+        std::cout << "│ " << password << std::string(characters < 36 ? 36 - characters : 0, ' ')
+                  << " │\n";
         std::cout << "├──────────────────────────────────────┤\n";
         std::cout << "│ Length: " << std::setw(28) << std::left
-                  << (std::to_string(password.length()) + " characters") << " │\n";
+                  << (std::to_string(characters) + " characters") << " │\n";
 
         // Calculate entropy
-        size_t charSpace = 0;
-        if (context.config.includeLowercase) charSpace += 26;
-        if (context.config.includeUppercase) charSpace += 26;
-        if (context.config.includeDigits) charSpace += 10;
-        if (context.config.includeSymbols) charSpace += context.config.customSymbols.length();
-
-        if (charSpace > 0) {
-            double entropy = password.length() * std::log2(charSpace);
+        if (entropy < 0.0) {
+            size_t charSpace = 0;
+            if (context.config.includeLowercase) charSpace += 26;
+            if (context.config.includeUppercase) charSpace += 26;
+            if (context.config.includeDigits) charSpace += 10;
+            if (context.config.includeSymbols) charSpace += context.config.customSymbols.length();
+            if (charSpace > 0) {
+                entropy = password.length() * std::log2(charSpace);
+            }
+        }
+
+        if (entropy >= 0.0) {
             std::cout << "│ Entropy: " << std::setw(28) << std::left
                       << (std::to_string(static_cast<int>(entropy)) + " bits") << " │\n";
         }
@@ -0,0 +1,38 @@
+#include "cli/commands/SetAlphabetCommand.h"
+#include "cli/commands/CommandContext.h"
+#include "utils/Utf8Alphabet.h"
+#include <algorithm>
+#include <iostream>
+#include <memory>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+std::unique_ptr<SetAlphabetCommand> SetAlphabetCommand::create(CommandContext& context) {
+    if (!context.hasNextArg()) {
+        std::cerr << "Error: --alphabet requires a name\n";
+        return nullptr;
+    }
+
+    const std::string& name = context.getNextArg();
+    const auto& names = utils::Utf8Alphabet::names();
+    if (std::find(names.begin(), names.end(), name) == names.end()) {
+        std::cerr << "Error: Unknown alphabet '" << name << "' (expected";
+        for (const auto& known : names) {
+            std::cerr << " " << known;
+        }
+        std::cerr << ")\n";
+        return nullptr;
+    }
+    return std::make_unique<SetAlphabetCommand>(name);
+}
+
+int SetAlphabetCommand::execute(CommandContext& context) {
+    context.unicodeAlphabets.push_back(name);
+    return 0;
+}
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
@@ -0,0 +1,42 @@
+#include "cli/commands/SetBytesCommand.h"
+#include "cli/commands/CommandContext.h"
+#include "strategies/TokenPasswordStrategy.h"
+#include <iostream>
+#include <stdexcept>
+#include <memory>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+std::unique_ptr<SetBytesCommand> SetBytesCommand::create(CommandContext& context) {
+    if (!context.hasNextArg()) {
+        std::cerr << "Error: --bytes requires a value\n";
+        return nullptr;
+    }
+
+    using strategies::TokenPasswordStrategy;
+    try {
+        const std::string& bytesStr = context.getNextArg();
+        size_t bytes = std::stoul(bytesStr);
+        if (bytes >= TokenPasswordStrategy::MIN_BYTES && bytes <= TokenPasswordStrategy::MAX_BYTES) {
+            return std::make_unique<SetBytesCommand>(bytes);
+        } else {
+            std::cerr << "Error: Token size must be between " << TokenPasswordStrategy::MIN_BYTES
+                      << " and " << TokenPasswordStrategy::MAX_BYTES << " bytes\n";
+            return nullptr;
+        }
+    } catch (const std::exception&) {
+        std::cerr << "Error: Invalid byte count\n";
+        return nullptr;
+    }
+}
+
+int SetBytesCommand::execute(CommandContext& context) {
+    context.tokenBytes = bytes;
+    return 0;
+}
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
@@ -0,0 +1,31 @@
+#include "cli/commands/SetCharsetFileCommand.h"
+#include "cli/commands/CommandContext.h"
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+std::unique_ptr<SetCharsetFileCommand> SetCharsetFileCommand::create(CommandContext& context) {
+    if (!context.hasNextArg()) {
+        std::cerr << "Error: --charset-file requires a path\n";
+        return nullptr;
+    }
+    return std::make_unique<SetCharsetFileCommand>(context.getNextArg());
+}
+
+int SetCharsetFileCommand::execute(CommandContext& context) {
+    try {
+        context.filter.loadCharsetFile(path);
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
@@ -0,0 +1,33 @@
+#include "cli/commands/SetChecksumCommand.h"
+#include "cli/commands/CommandContext.h"
+#include <iostream>
+#include <stdexcept>
+#include <memory>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+std::unique_ptr<SetChecksumCommand> SetChecksumCommand::create(CommandContext& context) {
+    if (!context.hasNextArg()) {
+        std::cerr << "Error: --checksum requires a value (crc32, crc32c or none)\n";
+        return nullptr;
+    }
+
+    try {
+        return std::make_unique<SetChecksumCommand>(
+            strategies::TokenPasswordStrategy::parseChecksum(context.getNextArg()));
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return nullptr;
+    }
+}
+
+int SetChecksumCommand::execute(CommandContext& context) {
+    context.tokenChecksum = checksum;
+    return 0;
+}
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
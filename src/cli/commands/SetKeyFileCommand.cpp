@@ -0,0 +1,25 @@
+#include "cli/commands/SetKeyFileCommand.h"
+#include "cli/commands/CommandContext.h"
+#include <iostream>
+#include <memory>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+std::unique_ptr<SetKeyFileCommand> SetKeyFileCommand::create(CommandContext& context) {
+    if (!context.hasNextArg()) {
+        std::cerr << "Error: --key-file requires a path\n";
+        return nullptr;
+    }
+    return std::make_unique<SetKeyFileCommand>(context.getNextArg());
+}
+
+int SetKeyFileCommand::execute(CommandContext& context) {
+    context.keyFile = path;
+    return 0;
+}
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
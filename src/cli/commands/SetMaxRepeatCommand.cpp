@@ -0,0 +1,39 @@
+#include "cli/commands/SetMaxRepeatCommand.h"
+#include "cli/commands/CommandContext.h"
+#include <iostream>
+#include <stdexcept>
+#include <memory>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+std::unique_ptr<SetMaxRepeatCommand> SetMaxRepeatCommand::create(CommandContext& context) {
+    if (!context.hasNextArg()) {
+        std::cerr << "Error: --max-repeat requires a value\n";
+        return nullptr;
+    }
+
+    try {
+        const std::string& repeatStr = context.getNextArg();
+        size_t maxRepeat = std::stoul(repeatStr);
+        if (maxRepeat >= 1 && maxRepeat <= 128) {
+            return std::make_unique<SetMaxRepeatCommand>(maxRepeat);
+        } else {
+            std::cerr << "Error: Repeat limit must be between 1 and 128\n";
+            return nullptr;
+        }
+    } catch (const std::exception&) {
+        std::cerr << "Error: Invalid repeat limit\n";
+        return nullptr;
+    }
+}
+
+int SetMaxRepeatCommand::execute(CommandContext& context) {
+    context.filter.setMaxRepeat(maxRepeat);
+    return 0;
+}
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
@@ -0,0 +1,25 @@
+#include "cli/commands/SetPrefixCommand.h"
+#include "cli/commands/CommandContext.h"
+#include <iostream>
+#include <memory>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+std::unique_ptr<SetPrefixCommand> SetPrefixCommand::create(CommandContext& context) {
+    if (!context.hasNextArg()) {
+        std::cerr << "Error: --prefix requires a value\n";
+        return nullptr;
+    }
+    return std::make_unique<SetPrefixCommand>(context.getNextArg());
+}
+
+int SetPrefixCommand::execute(CommandContext& context) {
+    context.tokenPrefix = prefix;
+    return 0;
+}
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
@@ -0,0 +1,31 @@
+#include "cli/commands/SetSeparatorCommand.h"
+#include "cli/commands/CommandContext.h"
+#include <iostream>
+#include <memory>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+std::unique_ptr<SetSeparatorCommand> SetSeparatorCommand::create(CommandContext& context) {
+    if (!context.hasNextArg()) {
+        std::cerr << "Error: --separator requires a value\n";
+        return nullptr;
+    }
+    const std::string& separator = context.getNextArg();
+    if (separator.empty()) {
+        std::cerr << "Error: Separator must not be empty\n";
+        return nullptr;
+    }
+    return std::make_unique<SetSeparatorCommand>(separator);
+}
+
+int SetSeparatorCommand::execute(CommandContext& context) {
+    context.passphraseSeparator = separator;
+    context.passphraseOptions = true;
+    return 0;
+}
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
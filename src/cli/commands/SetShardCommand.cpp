@@ -0,0 +1,55 @@
+#include "cli/commands/SetShardCommand.h"
+#include "cli/commands/CommandContext.h"
+#include <iostream>
+#include <stdexcept>
+#include <memory>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+std::unique_ptr<SetShardCommand> SetShardCommand::create(CommandContext& context) {
+    if (!context.hasNextArg()) {
+        std::cerr << "Error: --shard requires a value of the form i/N\n";
+        return nullptr;
+    }
+
+    const std::string& shardStr = context.getNextArg();
+    size_t slash = shardStr.find('/');
+    if (slash == std::string::npos || slash == 0 || slash + 1 == shardStr.size() ||
+        shardStr[0] == '-' || shardStr[slash + 1] == '-') {
+        std::cerr << "Error: Shard must be of the form i/N\n";
+        return nullptr;
+    }
+
+    try {
+        size_t used = 0;
+        uint64_t index = std::stoull(shardStr.substr(0, slash), &used);
+        if (used != slash) {
+            throw std::invalid_argument("shard index");
+        }
+        std::string countStr = shardStr.substr(slash + 1);
+        uint64_t count = std::stoull(countStr, &used);
+        if (used != countStr.size()) {
+            throw std::invalid_argument("shard count");
+        }
+        if (count == 0 || index >= count) {
+            std::cerr << "Error: Shard index must be less than shard count\n";
+            return nullptr;
+        }
+        return std::make_unique<SetShardCommand>(index, count);
+    } catch (const std::exception&) {
+        std::cerr << "Error: Invalid shard value\n";
+        return nullptr;
+    }
+}
+
+int SetShardCommand::execute(CommandContext& context) {
+    context.shardIndex = index;
+    context.shardCount = count;
+    return 0;
+}
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
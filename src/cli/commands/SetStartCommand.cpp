@@ -0,0 +1,41 @@
+#include "cli/commands/SetStartCommand.h"
+#include "cli/commands/CommandContext.h"
+#include <iostream>
+#include <stdexcept>
+#include <memory>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+std::unique_ptr<SetStartCommand> SetStartCommand::create(CommandContext& context) {
+    if (!context.hasNextArg()) {
+        std::cerr << "Error: --start requires a position\n";
+        return nullptr;
+    }
+
+    const std::string& positionStr = context.getNextArg();
+    try {
+        size_t used = 0;
+        if (positionStr.empty() || positionStr[0] == '-') {
+            throw std::invalid_argument("start position");
+        }
+        uint64_t position = std::stoull(positionStr, &used);
+        if (used != positionStr.size()) {
+            throw std::invalid_argument("start position");
+        }
+        return std::make_unique<SetStartCommand>(position);
+    } catch (const std::exception&) {
+        std::cerr << "Error: Invalid start position\n";
+        return nullptr;
+    }
+}
+
+int SetStartCommand::execute(CommandContext& context) {
+    context.uniqueStart = position;
+    return 0;
+}
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
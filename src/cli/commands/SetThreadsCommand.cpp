@@ -0,0 +1,46 @@
+#include "cli/commands/SetThreadsCommand.h"
+#include "cli/commands/CommandContext.h"
+#include "utils/CpuQuota.h"
+#include <iostream>
+#include <stdexcept>
+#include <memory>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+std::unique_ptr<SetThreadsCommand> SetThreadsCommand::create(CommandContext& context) {
+    if (!context.hasNextArg()) {
+        std::cerr << "Error: --threads requires a value\n";
+        return nullptr;
+    }
+
+    try {
+        const std::string& threadsStr = context.getNextArg();
+        size_t threads = std::stoul(threadsStr);
+        if (threads >= 1 && threads <= 1024) {
+            return std::make_unique<SetThreadsCommand>(threads);
+        } else {
+            std::cerr << "Error: Thread count must be between 1 and 1024\n";
+            return nullptr;
+        }
+    } catch (const std::exception&) {
+        std::cerr << "Error: Invalid thread count\n";
+        return nullptr;
+    }
+}
+
+int SetThreadsCommand::execute(CommandContext& context) {
+    // More threads than the CPU quota allows only adds contention
+    const size_t available = utils::availableCpus();
+    if (threads > available && !context.quietMode) {
+        std::cerr << "Warning: " << threads << " threads requested but only " << available
+                  << " CPUs are available\n";
+    }
+    context.threads = threads;
+    return 0;
+}
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
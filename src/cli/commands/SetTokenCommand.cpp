@@ -0,0 +1,35 @@
+#include "cli/commands/SetTokenCommand.h"
+#include "cli/commands/CommandContext.h"
+#include "strategies/TokenPasswordStrategy.h"
+#include <iostream>
+#include <stdexcept>
+#include <memory>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+std::unique_ptr<SetTokenCommand> SetTokenCommand::create(CommandContext& context) {
+    if (!context.hasNextArg()) {
+        std::cerr << "Error: --token requires an encoding (hex, base32, base58 or base64url)\n";
+        return nullptr;
+    }
+
+    try {
+        return std::make_unique<SetTokenCommand>(
+            strategies::TokenPasswordStrategy::parseEncoding(context.getNextArg()));
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return nullptr;
+    }
+}
+
+int SetTokenCommand::execute(CommandContext& context) {
+    context.tokenMode = true;
+    context.tokenEncoding = encoding;
+    return 0;
+}
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
@@ -0,0 +1,57 @@
+#include "cli/commands/SetWeightCommand.h"
+#include "cli/commands/CommandContext.h"
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+std::unique_ptr<SetWeightCommand> SetWeightCommand::create(CommandContext& context) {
+    if (!context.hasNextArg()) {
+        std::cerr << "Error: --weight requires <set>=<weight>\n";
+        return nullptr;
+    }
+
+    const std::string& spec = context.getNextArg();
+    const size_t equals = spec.find('=');
+    const std::string set = spec.substr(0, equals);
+    if (equals == std::string::npos ||
+        (set != "lower" && set != "upper" && set != "digits" && set != "symbols")) {
+        std::cerr << "Error: --weight expects lower, upper, digits or symbols, e.g. symbols=2\n";
+        return nullptr;
+    }
+
+    try {
+        size_t parsed = 0;
+        const std::string value = spec.substr(equals + 1);
+        double weight = std::stod(value, &parsed);
+        if (parsed != value.size() || !(weight > 0.0) || !std::isfinite(weight)) {
+            std::cerr << "Error: Weight must be a positive number\n";
+            return nullptr;
+        }
+        return std::make_unique<SetWeightCommand>(set, weight);
+    } catch (const std::exception&) {
+        std::cerr << "Error: Invalid weight value\n";
+        return nullptr;
+    }
+}
+
+int SetWeightCommand::execute(CommandContext& context) {
+    if (set == "lower") {
+        context.lowercaseWeight = weight;
+    } else if (set == "upper") {
+        context.uppercaseWeight = weight;
+    } else if (set == "digits") {
+        context.digitWeight = weight;
+    } else {
+        context.symbolWeight = weight;
+    }
+    return 0;
+}
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
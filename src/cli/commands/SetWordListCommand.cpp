@@ -0,0 +1,26 @@
+#include "cli/commands/SetWordListCommand.h"
+#include "cli/commands/CommandContext.h"
+#include <iostream>
+#include <memory>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+std::unique_ptr<SetWordListCommand> SetWordListCommand::create(CommandContext& context) {
+    if (!context.hasNextArg()) {
+        std::cerr << "Error: --wordlist requires a path\n";
+        return nullptr;
+    }
+    return std::make_unique<SetWordListCommand>(context.getNextArg());
+}
+
+int SetWordListCommand::execute(CommandContext& context) {
+    context.wordListFile = path;
+    context.passphraseOptions = true;
+    return 0;
+}
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
@@ -0,0 +1,40 @@
+#include "cli/commands/SetWordsCommand.h"
+#include "cli/commands/CommandContext.h"
+#include <iostream>
+#include <stdexcept>
+#include <memory>
+
+namespace password_generator {
+namespace cli {
+namespace commands {
+
+std::unique_ptr<SetWordsCommand> SetWordsCommand::create(CommandContext& context) {
+    if (!context.hasNextArg()) {
+        std::cerr << "Error: --words requires a value\n";
+        return nullptr;
+    }
+
+    try {
+        const std::string& wordsStr = context.getNextArg();
+        size_t words = std::stoul(wordsStr);
+        if (words >= 1 && words <= 64) {
+            return std::make_unique<SetWordsCommand>(words);
+        } else {
+            std::cerr << "Error: Word count must be between 1 and 64\n";
+            return nullptr;
+        }
+    } catch (const std::exception&) {
+        std::cerr << "Error: Invalid word count\n";
+        return nullptr;
+    }
+}
+
+int SetWordsCommand::execute(CommandContext& context) {
+    context.passphraseWords = words;
+    context.passphraseOptions = true;
+    return 0;
+}
+
+} // namespace commands
+} // namespace cli
+} // namespace password_generator
@@ -3,8 +3,8 @@
 namespace password_generator {
 namespace providers {
 
-std::string DigitProvider::getCharacters() const {
-    return "0123456789";
+const utils::CharacterTable& DigitProvider::getTable() const {
+    return utils::tables::DIGITS;
 }
 
 std::string DigitProvider::getName() const {
@@ -3,8 +3,8 @@
 namespace password_generator {
 namespace providers {
 
-std::string LowercaseProvider::getCharacters() const {
-    return "abcdefghijklmnopqrstuvwxyz";
+const utils::CharacterTable& LowercaseProvider::getTable() const {
+    return utils::tables::LOWERCASE;
 }
 
 std::string LowercaseProvider::getName() const {
@@ -4,10 +4,20 @@ namespace password_generator {
 namespace providers {
 
 SymbolProvider::SymbolProvider(const std::string& symbols)
-    : symbols_(symbols) {}
+    : symbols_(symbols), table_(symbols_) {}
 
-std::string SymbolProvider::getCharacters() const {
-    return symbols_;
+SymbolProvider::SymbolProvider(const SymbolProvider& other)
+    : ICharacterTableProvider(other), symbols_(other.symbols_), table_(symbols_) {}
+
+SymbolProvider& SymbolProvider::operator=(const SymbolProvider& other) {
+    if (this != &other) {
+        setSymbols(other.symbols_);
+    }
+    return *this;
+}
+
+const utils::CharacterTable& SymbolProvider::getTable() const {
+    return table_;
 }
 
 std::string SymbolProvider::getName() const {
@@ -16,7 +26,12 @@ std::string SymbolProvider::getName() const {
 
 void SymbolProvider::setSymbols(const std::string& symbols) {
     symbols_ = symbols;
+    table_ = utils::CharacterTable(symbols_);
+}
+
+const std::string& SymbolProvider::getSymbols() const {
+    return symbols_;
 }
 
 } // namespace providers
-} // namespace password_generator
\ No newline at end of file
+} // namespace password_generator
@@ -3,8 +3,8 @@
 namespace password_generator {
 namespace providers {
 
-std::string UppercaseProvider::getCharacters() const {
-    return "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+const utils::CharacterTable& UppercaseProvider::getTable() const {
+    return utils::tables::UPPERCASE;
 }
 
 std::string UppercaseProvider::getName() const {
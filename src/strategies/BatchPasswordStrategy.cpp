@@ -0,0 +1,30 @@
+#include "strategies/BatchPasswordStrategy.h"
+#include "utils/SecureMemory.h"
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace password_generator {
+namespace strategies {
+
+void generateBatch(core::interfaces::IPasswordStrategy& strategy, char* out, size_t count,
+                   size_t length) {
+    if (auto* batch = dynamic_cast<IBatchPasswordStrategy*>(&strategy)) {
+        batch->generateBatch(out, count, length);
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        std::string password = strategy.generate(length);
+        if (password.size() != length) {
+            utils::secureWipe(&password[0], password.size());
+            throw std::runtime_error("Strategy returned a password of length " +
+                                     std::to_string(password.size()) + ", expected " +
+                                     std::to_string(length));
+        }
+        std::memcpy(out + i * length, password.data(), length);
+        utils::secureWipe(&password[0], password.size());
+    }
+}
+
+} // namespace strategies
+} // namespace password_generator
@@ -0,0 +1,246 @@
+#include "strategies/CompliantPasswordStrategy.h"
+#include "utils/AlphabetPlan.h"
+#include "utils/ThreadLocalRandomGenerator.h"
+#include "utils/UniformRank.h"
+#include <array>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace password_generator {
+namespace strategies {
+
+namespace {
+
+constexpr size_t TYPE_COUNT = 4;
+constexpr unsigned ALL_TYPES = (1u << TYPE_COUNT) - 1;
+
+} // namespace
+
+class CompliantPasswordStrategy::Impl {
+public:
+    std::vector<std::unique_ptr<core::interfaces::ICharacterSetProvider>> providers;
+    std::unique_ptr<core::interfaces::IRandomGenerator> rng;
+    utils::AlphabetPlan plan;
+    utils::CharacterFilter filter;
+    unsigned required = 0;
+    size_t minLength = DEFAULT_MIN_LENGTH;
+    size_t maxLength = DEFAULT_MAX_LENGTH;
+
+    // Merged alphabet split by type, bit i of a mask standing for members[i]
+    std::array<std::string, TYPE_COUNT> members;
+
+    // counts[k][m]: length-k strings containing every type in m; powers[S]
+    // holds (characters outside S)^k for the last layer built
+    std::vector<std::array<utils::BigUint, ALL_TYPES + 1>> counts;
+    std::array<utils::BigUint, ALL_TYPES + 1> powers;
+
+    explicit Impl(std::unique_ptr<core::interfaces::IRandomGenerator> randomGen)
+        : rng(randomGen ? std::move(randomGen)
+              : std::make_unique<utils::ThreadLocalRandomGenerator>()) {}
+
+    void rebuild() {
+        plan.build(providers, &filter);
+        for (std::string& type : members) {
+            type.clear();
+        }
+        for (char c : plan.merged().characters()) {
+            const unsigned bit = validators::CharacterTypeValidator::typeOf(c);
+            members[__builtin_ctz(bit)].push_back(c);
+        }
+        counts.clear();
+    }
+
+    uint32_t outside(unsigned types) const {
+        uint32_t size = plan.mergedSize();
+        for (size_t i = 0; i < TYPE_COUNT; ++i) {
+            if (types & (1u << i)) {
+                size -= static_cast<uint32_t>(members[i].size());
+            }
+        }
+        return size;
+    }
+
+    void extendCounts(size_t length) {
+        if (counts.empty()) {
+            powers.fill(utils::BigUint(1));
+        }
+        while (counts.size() <= length) {
+            if (!counts.empty()) {
+                for (unsigned s = 0; s <= ALL_TYPES; ++s) {
+                    powers[s] *= outside(s);
+                }
+            }
+            // Only masks within the requirements are ever looked up
+            std::array<utils::BigUint, ALL_TYPES + 1> layer;
+            for (unsigned m = 0; m <= ALL_TYPES; ++m) {
+                if (m & ~required) {
+                    continue;
+                }
+                utils::BigUint added;
+                utils::BigUint removed;
+                for (unsigned s = m;; s = (s - 1) & m) {
+                    (__builtin_popcount(s) & 1 ? removed : added) += powers[s];
+                    if (s == 0) {
+                        break;
+                    }
+                }
+                layer[m] = added - removed;
+            }
+            counts.push_back(std::move(layer));
+        }
+    }
+
+    void checkLength(size_t length) const {
+        if (length < minLength || length > maxLength) {
+            throw std::invalid_argument("Password length must be between " +
+                                        std::to_string(minLength) + " and " +
+                                        std::to_string(maxLength));
+        }
+    }
+
+    // rank indexes the compliant passwords in (type, member, suffix) order;
+    // each step peels off one character and keeps the suffix rank
+    std::string decode(size_t length, utils::BigUint rank) const {
+        std::string password(length, '\0');
+        unsigned missing = required;
+        for (size_t position = 0; position < length; ++position) {
+            const auto& next = counts[length - position - 1];
+            for (size_t i = 0; i < TYPE_COUNT; ++i) {
+                const std::string& type = members[i];
+                const unsigned after = missing & ~(1u << i);
+                if (type.empty() || next[after].isZero()) {
+                    continue;
+                }
+                utils::BigUint weight = next[after];
+                weight *= static_cast<uint32_t>(type.size());
+                if (rank >= weight) {
+                    rank -= weight;
+                    continue;
+                }
+                uint32_t index = utils::quotientBelow(rank, next[after],
+                                                      static_cast<uint32_t>(type.size()));
+                utils::BigUint offset = next[after];
+                offset *= index;
+                rank -= offset;
+                password[position] = type[index];
+                missing = after;
+                break;
+            }
+        }
+        return password;
+    }
+};
+
+CompliantPasswordStrategy::CompliantPasswordStrategy(
+    std::unique_ptr<core::interfaces::IRandomGenerator> randomGen)
+    : pImpl(std::make_unique<Impl>(std::move(randomGen))) {}
+
+CompliantPasswordStrategy::~CompliantPasswordStrategy() = default;
+
+void CompliantPasswordStrategy::addCharacterSet(
+    std::unique_ptr<core::interfaces::ICharacterSetProvider> provider) {
+    pImpl->providers.push_back(std::move(provider));
+    try {
+        pImpl->rebuild();
+    } catch (...) {
+        pImpl->providers.pop_back();
+        throw;
+    }
+}
+
+void CompliantPasswordStrategy::clearCharacterSets() {
+    pImpl->providers.clear();
+    pImpl->rebuild();
+}
+
+void CompliantPasswordStrategy::setFilter(const utils::CharacterFilter& filter) {
+    if (filter.hasSequenceRules()) {
+        throw std::invalid_argument("Compliant sampling supports character masks only, "
+                                    "not repeat limits");
+    }
+    utils::CharacterFilter previous = std::exchange(pImpl->filter, filter);
+    try {
+        pImpl->rebuild();
+    } catch (...) {
+        pImpl->filter = std::move(previous);
+        throw;
+    }
+}
+
+void CompliantPasswordStrategy::setRequirements(const validators::CharacterTypeValidator& validator) {
+    setRequiredTypes(validator.getRequiredTypes());
+}
+
+void CompliantPasswordStrategy::setRequiredTypes(unsigned types) {
+    pImpl->required = types & ALL_TYPES;
+    pImpl->counts.clear();
+}
+
+void CompliantPasswordStrategy::setLengthRange(size_t minLength, size_t maxLength) {
+    if (minLength == 0 || minLength > maxLength) {
+        throw std::invalid_argument("Length range must satisfy 0 < min <= max");
+    }
+    pImpl->minLength = minLength;
+    pImpl->maxLength = maxLength;
+}
+
+utils::BigUint CompliantPasswordStrategy::getKeyspace(size_t length) {
+    pImpl->extendCounts(length);
+    return pImpl->counts[length][pImpl->required];
+}
+
+utils::BigUint CompliantPasswordStrategy::getKeyspace() {
+    pImpl->extendCounts(pImpl->maxLength);
+    utils::BigUint total;
+    for (size_t length = pImpl->minLength; length <= pImpl->maxLength; ++length) {
+        total += pImpl->counts[length][pImpl->required];
+    }
+    return total;
+}
+
+double CompliantPasswordStrategy::getEntropyBits(size_t length) {
+    return getKeyspace(length).log2();
+}
+
+double CompliantPasswordStrategy::getEntropyBits() {
+    return getKeyspace().log2();
+}
+
+std::string CompliantPasswordStrategy::generate(size_t length) {
+    if (pImpl->providers.empty()) {
+        throw std::runtime_error("No character sets configured");
+    }
+    pImpl->checkLength(length);
+    pImpl->extendCounts(length);
+    const utils::BigUint& total = pImpl->counts[length][pImpl->required];
+    if (total.isZero()) {
+        throw std::runtime_error("No password of length " + std::to_string(length) +
+                                 " contains every required character type");
+    }
+    return pImpl->decode(length, utils::drawBelow(*pImpl->rng, total));
+}
+
+std::string CompliantPasswordStrategy::generateInRange() {
+    if (pImpl->providers.empty()) {
+        throw std::runtime_error("No character sets configured");
+    }
+    const utils::BigUint total = getKeyspace();
+    if (total.isZero()) {
+        throw std::runtime_error("No password in the length range contains every "
+                                 "required character type");
+    }
+
+    // One rank over all lengths; the length is the block it falls in
+    utils::BigUint rank = utils::drawBelow(*pImpl->rng, total);
+    for (size_t length = pImpl->minLength;; ++length) {
+        const utils::BigUint& count = pImpl->counts[length][pImpl->required];
+        if (rank < count) {
+            return pImpl->decode(length, std::move(rank));
+        }
+        rank -= count;
+    }
+}
+
+} // namespace strategies
+} // namespace password_generator
@@ -0,0 +1,257 @@
+#include "strategies/DerivedPasswordStrategy.h"
+#include "utils/ChaCha20Drbg.h"
+#include "utils/SecureMemory.h"
+#include "utils/Sha256.h"
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace password_generator {
+namespace strategies {
+
+namespace {
+
+// Domain separation labels, without their NULs; changing either changes
+// every derived password
+const char MASTER_SALT[] = "dbgpass-derive-v2";
+const char SITE_LABEL[] = "dbgpass-site-v2";
+
+void appendLength(std::string& out, uint64_t value) {
+    for (int shift = 56; shift >= 0; shift -= 8) {
+        out.push_back(static_cast<char>((value >> shift) & 0xff));
+    }
+}
+
+/**
+ * Keystream of one site key: ChaCha20 blocks 0, 1, 2, ... with a zero
+ * nonce, read as little-endian 32-bit words. Deliberately independent of
+ * ChaCha20Drbg's buffering and key erasure, which may change.
+ */
+class SiteStream {
+public:
+    explicit SiteStream(const uint8_t* key) {
+        for (size_t i = 0; i < 8; ++i) {
+            key_[i] = static_cast<uint32_t>(key[4 * i]) |
+                      static_cast<uint32_t>(key[4 * i + 1]) << 8 |
+                      static_cast<uint32_t>(key[4 * i + 2]) << 16 |
+                      static_cast<uint32_t>(key[4 * i + 3]) << 24;
+        }
+    }
+
+    ~SiteStream() {
+        utils::secureWipe(key_, sizeof(key_));
+        utils::secureWipe(block_, sizeof(block_));
+    }
+
+    SiteStream(const SiteStream&) = delete;
+    SiteStream& operator=(const SiteStream&) = delete;
+
+    uint32_t next32() {
+        if (position_ == sizeof(block_)) {
+            const uint32_t nonce[3] = {0, 0, 0};
+            utils::ChaCha20Drbg::block(key_, counter_++, nonce, block_);
+            position_ = 0;
+        }
+        const uint8_t* p = block_ + position_;
+        position_ += 4;
+        return static_cast<uint32_t>(p[0]) | static_cast<uint32_t>(p[1]) << 8 |
+               static_cast<uint32_t>(p[2]) << 16 | static_cast<uint32_t>(p[3]) << 24;
+    }
+
+    // Uniform in [0, bound) by rejecting words at or above the largest
+    // multiple of bound
+    uint32_t uniform(uint32_t bound) {
+        const uint64_t limit = (uint64_t(1) << 32) / bound * bound;
+        uint32_t word;
+        do {
+            word = next32();
+        } while (word >= limit);
+        return word % bound;
+    }
+
+private:
+    uint32_t key_[8];
+    uint8_t block_[utils::ChaCha20Drbg::BLOCK_SIZE];
+    size_t position_ = sizeof(block_);
+    uint32_t counter_ = 0;
+};
+
+} // namespace
+
+class DerivedPasswordStrategy::Impl {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    std::string masterSecret;
+    std::string user;
+    uint32_t iterations;
+    Clock::duration keyLifetime;
+
+    uint8_t masterKey[utils::ChaCha20Drbg::KEY_SIZE];
+    bool keyValid = false;
+    Clock::time_point keyDerivedAt;
+    size_t derivations = 0;
+
+    // Characters of each non-empty configured set, in order, and their
+    // deduplicated union; the sets are also bound into every site key
+    std::vector<std::string> policy;
+    std::string merged;
+
+    std::string site;
+    uint32_t counter = 1;
+
+    Impl(const std::string& secret, const std::string& userId, uint32_t iters,
+         std::chrono::seconds lifetime)
+        : masterSecret(secret), user(userId), iterations(iters), keyLifetime(lifetime) {
+        if (masterSecret.empty()) {
+            throw std::invalid_argument("Master secret must not be empty");
+        }
+        if (user.empty()) {
+            throw std::invalid_argument("User identifier must not be empty");
+        }
+        if (iterations == 0) {
+            throw std::invalid_argument("KDF iterations must be positive");
+        }
+    }
+
+    ~Impl() {
+        clearKey();
+        utils::secureWipe(&masterSecret[0], masterSecret.size());
+    }
+
+    void clearKey() {
+        utils::secureWipe(masterKey, sizeof(masterKey));
+        keyValid = false;
+    }
+
+    void addSet(const std::string& chars) {
+        if (chars.empty()) {
+            return;
+        }
+        policy.push_back(chars);
+        for (char c : chars) {
+            if (merged.find(c) == std::string::npos) {
+                merged.push_back(c);
+            }
+        }
+    }
+
+    // Stretch the master secret, or reuse the cached key while it is fresh
+    void refreshMasterKey() {
+        const Clock::time_point now = Clock::now();
+        if (keyValid && now - keyDerivedAt < keyLifetime) {
+            return;
+        }
+        std::string salt(MASTER_SALT, sizeof(MASTER_SALT) - 1);
+        appendLength(salt, user.size());
+        salt += user;
+        utils::pbkdf2HmacSha256(masterSecret.data(), masterSecret.size(),
+                                salt.data(), salt.size(),
+                                iterations, masterKey, sizeof(masterKey));
+        keyValid = true;
+        keyDerivedAt = now;
+        ++derivations;
+    }
+
+    std::string deriveWithCurrentKey(const std::string& name, uint32_t siteCounter,
+                                     size_t length) {
+        if (name.empty()) {
+            throw std::invalid_argument("Site name must not be empty");
+        }
+        if (policy.empty()) {
+            throw std::runtime_error("No character sets configured");
+        }
+
+        // Length-prefix every field so no two inputs share an encoding
+        std::string info(SITE_LABEL, sizeof(SITE_LABEL) - 1);
+        appendLength(info, name.size());
+        info += name;
+        appendLength(info, siteCounter);
+        appendLength(info, length);
+        for (const auto& chars : policy) {
+            appendLength(info, chars.size());
+            info += chars;
+        }
+
+        utils::Sha256::Digest siteKey =
+            utils::hmacSha256(masterKey, sizeof(masterKey), info.data(), info.size());
+        utils::secureWipe(&info[0], info.size());
+        SiteStream stream(siteKey.data());
+        utils::secureWipe(siteKey.data(), siteKey.size());
+
+        // One character from each set while there is room, the rest from
+        // the union, then shuffle so the guaranteed ones can land anywhere
+        std::string password(length, '\0');
+        const size_t required = policy.size() < length ? policy.size() : length;
+        for (size_t i = 0; i < required; ++i) {
+            password[i] = policy[i][stream.uniform(static_cast<uint32_t>(policy[i].size()))];
+        }
+        for (size_t i = required; i < length; ++i) {
+            password[i] = merged[stream.uniform(static_cast<uint32_t>(merged.size()))];
+        }
+        for (size_t i = length; i > 1; --i) {
+            std::swap(password[i - 1], password[stream.uniform(static_cast<uint32_t>(i))]);
+        }
+        return password;
+    }
+};
+
+DerivedPasswordStrategy::DerivedPasswordStrategy(const std::string& masterSecret,
+                                                 const std::string& user,
+                                                 uint32_t iterations,
+                                                 std::chrono::seconds keyLifetime)
+    : pImpl(std::make_unique<Impl>(masterSecret, user, iterations, keyLifetime)) {}
+
+DerivedPasswordStrategy::~DerivedPasswordStrategy() = default;
+
+void DerivedPasswordStrategy::addCharacterSet(
+    std::unique_ptr<core::interfaces::ICharacterSetProvider> provider) {
+    pImpl->addSet(provider->getCharacters());
+}
+
+void DerivedPasswordStrategy::clearCharacterSets() {
+    pImpl->policy.clear();
+    pImpl->merged.clear();
+}
+
+void DerivedPasswordStrategy::setSite(const std::string& site, uint32_t counter) {
+    pImpl->site = site;
+    pImpl->counter = counter;
+}
+
+std::string DerivedPasswordStrategy::generate(size_t length) {
+    if (pImpl->site.empty()) {
+        throw std::runtime_error("No site set for derived password");
+    }
+    return derive(pImpl->site, pImpl->counter, length);
+}
+
+std::string DerivedPasswordStrategy::derive(const std::string& site, uint32_t counter,
+                                            size_t length) {
+    pImpl->refreshMasterKey();
+    return pImpl->deriveWithCurrentKey(site, counter, length);
+}
+
+std::vector<std::string> DerivedPasswordStrategy::deriveBatch(const std::vector<Site>& sites,
+                                                              size_t length) {
+    // One KDF check for the whole batch, even if the key expires part way
+    pImpl->refreshMasterKey();
+
+    std::vector<std::string> passwords;
+    passwords.reserve(sites.size());
+    for (const auto& site : sites) {
+        passwords.push_back(pImpl->deriveWithCurrentKey(site.name, site.counter, length));
+    }
+    return passwords;
+}
+
+void DerivedPasswordStrategy::clearKeyCache() {
+    pImpl->clearKey();
+}
+
+size_t DerivedPasswordStrategy::getKeyDerivations() const {
+    return pImpl->derivations;
+}
+
+} // namespace strategies
+} // namespace password_generator
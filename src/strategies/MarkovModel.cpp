@@ -0,0 +1,130 @@
+#include "strategies/MarkovModel.h"
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace password_generator {
+namespace strategies {
+
+namespace {
+
+uint32_t readU32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+} // namespace
+
+std::shared_ptr<const MarkovModel> MarkovModel::load(const std::string& path) {
+    return std::shared_ptr<const MarkovModel>(new MarkovModel(utils::MappedFile(path)));
+}
+
+MarkovModel::MarkovModel(utils::MappedFile file) : file_(std::move(file)) {
+    const uint8_t* data = file_.data();
+    const size_t size = file_.size();
+    if (size < HEADER_SIZE + SYMBOL_TABLE_SIZE || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("Not a Markov model file");
+    }
+
+    uint32_t order = readU32(data + 8);
+    uint32_t symbols = readU32(data + 12);
+    slotCount_ = readU32(data + 16);
+    if (order < MIN_ORDER || order > MAX_ORDER) {
+        throw std::runtime_error("Markov model order must be 2-4");
+    }
+    if (symbols == 0 || symbols >= SYMBOL_TABLE_SIZE) {
+        throw std::runtime_error("Markov model has an invalid alphabet");
+    }
+    if (slotCount_ == 0 || (slotCount_ & (slotCount_ - 1)) != 0 ||
+        (size - HEADER_SIZE - SYMBOL_TABLE_SIZE) / SLOT_SIZE < slotCount_) {
+        throw std::runtime_error("Markov model has an invalid context index");
+    }
+    order_ = order;
+    symbolCount_ = symbols;
+    contextMask_ = static_cast<uint32_t>((uint64_t(1) << (8 * (order_ - 1))) - 1);
+
+    for (int& index : symbolOf_) {
+        index = -1;
+    }
+    for (size_t s = 1; s <= symbolCount_; ++s) {
+        int& index = symbolOf_[data[HEADER_SIZE + s]];
+        if (index != -1) {
+            throw std::runtime_error("Markov model repeats a symbol");
+        }
+        index = static_cast<int>(s);
+    }
+}
+
+bool MarkovModel::lookup(uint32_t context, Table& table) const {
+    const uint8_t* slots = file_.data() + HEADER_SIZE + SYMBOL_TABLE_SIZE;
+    const uint32_t key = context + 1;
+    uint32_t slot = slotOf(context, slotCount_);
+    for (uint32_t probe = 0; probe < slotCount_; ++probe) {
+        const uint8_t* entry = slots + static_cast<size_t>(slot) * SLOT_SIZE;
+        uint32_t stored = readU32(entry);
+        if (stored == 0) {
+            return false;
+        }
+        if (stored == key) {
+            size_t offset = readU32(entry + 4);
+            if (offset > file_.size() || file_.size() - offset < TABLE_HEADER_SIZE) {
+                throw std::runtime_error("Corrupt Markov model table");
+            }
+            const uint8_t* header = file_.data() + offset;
+            table.size = readU32(header);
+            table.total = readU32(header + 4);
+            if (table.size == 0 || table.size > SYMBOL_TABLE_SIZE || table.total == 0 ||
+                (file_.size() - offset - TABLE_HEADER_SIZE) / ENTRY_SIZE < table.size) {
+                throw std::runtime_error("Corrupt Markov model table");
+            }
+            table.entries = header + TABLE_HEADER_SIZE;
+            return true;
+        }
+        slot = (slot + 1) & (slotCount_ - 1);
+    }
+    return false;
+}
+
+MarkovModel::Step MarkovModel::sample(const Table& table, uint32_t column, uint32_t u) const {
+    const uint8_t* entry = table.entries + static_cast<size_t>(column) * ENTRY_SIZE;
+    if (u >= readU32(entry)) {
+        uint8_t alias = entry[9];
+        if (alias >= table.size) {
+            throw std::runtime_error("Corrupt Markov model alias");
+        }
+        entry = table.entries + static_cast<size_t>(alias) * ENTRY_SIZE;
+    }
+    return {entry[8], readU32(entry + 4)};
+}
+
+double MarkovModel::surprisalBits(const std::string& text, char separator) const {
+    const double impossible = std::numeric_limits<double>::infinity();
+    double bits = 0.0;
+    uint32_t context = 0;
+    for (char c : text) {
+        int symbol = c == separator ? BOUNDARY : symbolOf(c);
+        Table table;
+        if (symbol < 0 || !lookup(context, table)) {
+            return impossible;
+        }
+
+        uint32_t weight = 0;
+        for (uint32_t i = 0; i < table.size; ++i) {
+            const uint8_t* entry = table.entries + static_cast<size_t>(i) * ENTRY_SIZE;
+            if (entry[8] == symbol) {
+                weight = readU32(entry + 4);
+                break;
+            }
+        }
+        if (weight == 0) {
+            return impossible;
+        }
+        bits += std::log2(static_cast<double>(table.total)) - std::log2(static_cast<double>(weight));
+        context = symbol == BOUNDARY ? 0 : ((context << 8) | static_cast<uint32_t>(symbol)) & contextMask_;
+    }
+    return bits;
+}
+
+} // namespace strategies
+} // namespace password_generator
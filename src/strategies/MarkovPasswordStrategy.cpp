@@ -0,0 +1,110 @@
+#include "strategies/MarkovPasswordStrategy.h"
+#include "utils/BulkRandomGenerator.h"
+#include "utils/SecureMemory.h"
+#include "utils/ThreadLocalRandomGenerator.h"
+#include <cmath>
+#include <stdexcept>
+
+namespace password_generator {
+namespace strategies {
+
+class MarkovPasswordStrategy::Impl {
+public:
+    std::shared_ptr<const MarkovModel> model;
+    std::unique_ptr<core::interfaces::IRandomGenerator> rng;
+    char separator = '-';
+    double minEntropyBits = 0.0;
+    double lastEntropyBits = 0.0;
+
+    Impl(std::shared_ptr<const MarkovModel> m,
+         std::unique_ptr<core::interfaces::IRandomGenerator> randomGen)
+        : model(std::move(m)),
+          rng(randomGen ? std::move(randomGen)
+              : std::make_unique<utils::ThreadLocalRandomGenerator>()) {
+        if (!model) {
+            throw std::invalid_argument("Markov model must not be null");
+        }
+    }
+
+    // Returns the surprisal of the password written to out
+    double sampleOnce(std::string& out) {
+        double bits = 0.0;
+        uint32_t context = 0;
+        for (size_t i = 0; i < out.size(); ++i) {
+            MarkovModel::Table table;
+            if (!model->lookup(context, table)) {
+                throw std::runtime_error("Markov model has no successors for a reachable context");
+            }
+            uint32_t draws[2] = {table.size, table.total};
+            utils::generateBounded(*rng, draws, 2);
+            MarkovModel::Step step = model->sample(table, draws[0], draws[1]);
+
+            bits += std::log2(static_cast<double>(table.total)) -
+                    std::log2(static_cast<double>(step.weight));
+            if (step.symbol == MarkovModel::BOUNDARY) {
+                out[i] = separator;
+                context = 0;
+            } else {
+                out[i] = model->symbolChar(step.symbol);
+                context = ((context << 8) | step.symbol) & model->contextMask();
+            }
+        }
+        return bits;
+    }
+};
+
+MarkovPasswordStrategy::MarkovPasswordStrategy(
+    const std::string& modelPath,
+    std::unique_ptr<core::interfaces::IRandomGenerator> randomGen)
+    : MarkovPasswordStrategy(MarkovModel::load(modelPath), std::move(randomGen)) {}
+
+MarkovPasswordStrategy::MarkovPasswordStrategy(
+    std::shared_ptr<const MarkovModel> model,
+    std::unique_ptr<core::interfaces::IRandomGenerator> randomGen)
+    : pImpl(std::make_unique<Impl>(std::move(model), std::move(randomGen))) {}
+
+MarkovPasswordStrategy::~MarkovPasswordStrategy() = default;
+
+void MarkovPasswordStrategy::setSeparator(char separator) {
+    if (pImpl->model->symbolOf(separator) >= 0) {
+        throw std::invalid_argument("Separator is a letter of the Markov model");
+    }
+    pImpl->separator = separator;
+}
+
+char MarkovPasswordStrategy::getSeparator() const {
+    return pImpl->separator;
+}
+
+void MarkovPasswordStrategy::setMinEntropyBits(double bits) {
+    pImpl->minEntropyBits = bits;
+}
+
+double MarkovPasswordStrategy::getLastEntropyBits() const {
+    return pImpl->lastEntropyBits;
+}
+
+const MarkovModel& MarkovPasswordStrategy::getModel() const {
+    return *pImpl->model;
+}
+
+std::string MarkovPasswordStrategy::generate(size_t length) {
+    if (pImpl->model->symbolOf(pImpl->separator) >= 0) {
+        throw std::runtime_error("Separator is a letter of the Markov model; choose another");
+    }
+
+    std::string password(length, '\0');
+    for (size_t attempt = 0; attempt < MAX_ATTEMPTS; ++attempt) {
+        double bits = pImpl->sampleOnce(password);
+        if (bits >= pImpl->minEntropyBits) {
+            pImpl->lastEntropyBits = bits;
+            return password;
+        }
+    }
+    utils::secureWipe(&password[0], password.size());
+    throw std::runtime_error("Could not reach the minimum entropy in " +
+                             std::to_string(MAX_ATTEMPTS) + " attempts");
+}
+
+} // namespace strategies
+} // namespace password_generator
@@ -0,0 +1,232 @@
+#include "strategies/MarkovTrainer.h"
+#include "strategies/MarkovModel.h"
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+
+namespace password_generator {
+namespace strategies {
+
+namespace {
+
+// Table totals stay below 2^31 so draws fit the 32-bit bounded sampler
+constexpr uint64_t MAX_TOTAL = uint64_t(1) << 31;
+
+void putU32(std::vector<uint8_t>& out, size_t at, uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        out[at + i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+bool isSpace(unsigned char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+bool isAsciiLetter(unsigned char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+struct AliasEntry {
+    uint32_t threshold;
+    uint32_t weight;
+    uint8_t symbol;
+    uint8_t alias;
+};
+
+// Integer Vose construction: every column holds exactly `total` units, so
+// P(symbol i) = weight_i / total with no rounding
+std::vector<AliasEntry> buildAlias(const std::vector<std::pair<uint8_t, uint32_t>>& weights,
+                                   uint32_t total) {
+    const size_t k = weights.size();
+    std::vector<AliasEntry> entries(k);
+    std::vector<uint64_t> scaled(k);
+    std::vector<size_t> small, large;
+    for (size_t i = 0; i < k; ++i) {
+        entries[i] = {total, weights[i].second, weights[i].first, static_cast<uint8_t>(i)};
+        scaled[i] = uint64_t(weights[i].second) * k;
+        (scaled[i] < total ? small : large).push_back(i);
+    }
+    while (!small.empty() && !large.empty()) {
+        size_t low = small.back();
+        small.pop_back();
+        size_t high = large.back();
+        entries[low].threshold = static_cast<uint32_t>(scaled[low]);
+        entries[low].alias = static_cast<uint8_t>(high);
+        scaled[high] -= total - scaled[low];
+        if (scaled[high] < total) {
+            large.pop_back();
+            small.push_back(high);
+        }
+    }
+    return entries;
+}
+
+} // namespace
+
+class MarkovTrainer::Impl {
+public:
+    size_t order;
+    size_t words = 0;
+    uint8_t symbolOf[256] = {};
+    std::vector<uint8_t> symbols = {0};   // index 0 is the boundary
+    std::map<uint32_t, std::map<uint8_t, uint64_t>> counts;
+
+    explicit Impl(size_t n) : order(n) {}
+
+    uint32_t mask() const {
+        return static_cast<uint32_t>((uint64_t(1) << (8 * (order - 1))) - 1);
+    }
+};
+
+MarkovTrainer::MarkovTrainer(size_t order) {
+    if (order < MarkovModel::MIN_ORDER || order > MarkovModel::MAX_ORDER) {
+        throw std::invalid_argument("Markov order must be 2-4");
+    }
+    pImpl = std::make_unique<Impl>(order);
+}
+
+MarkovTrainer::~MarkovTrainer() = default;
+
+void MarkovTrainer::addWord(const std::string& word) {
+    if (word.empty()) {
+        return;
+    }
+    for (char c : word) {
+        unsigned char byte = static_cast<unsigned char>(c);
+        if (byte == 0 || isSpace(byte)) {
+            throw std::invalid_argument("Words cannot contain NUL or whitespace");
+        }
+    }
+    for (char c : word) {
+        unsigned char byte = static_cast<unsigned char>(c);
+        if (pImpl->symbolOf[byte] == 0) {
+            if (pImpl->symbols.size() == MarkovModel::SYMBOL_TABLE_SIZE) {
+                throw std::invalid_argument("Corpus has more than 255 distinct bytes");
+            }
+            pImpl->symbolOf[byte] = static_cast<uint8_t>(pImpl->symbols.size());
+            pImpl->symbols.push_back(byte);
+        }
+    }
+
+    uint32_t context = 0;
+    for (char c : word) {
+        uint8_t symbol = pImpl->symbolOf[static_cast<unsigned char>(c)];
+        ++pImpl->counts[context][symbol];
+        context = ((context << 8) | symbol) & pImpl->mask();
+    }
+    ++pImpl->counts[context][MarkovModel::BOUNDARY];
+    ++pImpl->words;
+}
+
+void MarkovTrainer::addText(std::istream& in, const TextOptions& options) {
+    std::string word;
+    char c;
+    while (in.get(c)) {
+        unsigned char byte = static_cast<unsigned char>(c);
+        bool separator = byte == 0 || isSpace(byte) ||
+                         (options.lettersOnly && byte < 0x80 && !isAsciiLetter(byte));
+        if (separator) {
+            addWord(word);
+            word.clear();
+            continue;
+        }
+        if (options.lowercase && byte >= 'A' && byte <= 'Z') {
+            c = static_cast<char>(byte - 'A' + 'a');
+        }
+        word.push_back(c);
+    }
+    addWord(word);
+}
+
+size_t MarkovTrainer::order() const {
+    return pImpl->order;
+}
+
+size_t MarkovTrainer::wordCount() const {
+    return pImpl->words;
+}
+
+size_t MarkovTrainer::contextCount() const {
+    return pImpl->counts.size();
+}
+
+std::vector<uint8_t> MarkovTrainer::compile() const {
+    if (pImpl->words == 0) {
+        throw std::runtime_error("Cannot compile a Markov model without training words");
+    }
+
+    uint32_t slotCount = 2;
+    while (slotCount < 2 * pImpl->counts.size()) {
+        slotCount *= 2;
+    }
+
+    std::vector<uint8_t> out(MarkovModel::HEADER_SIZE + MarkovModel::SYMBOL_TABLE_SIZE +
+                             size_t(slotCount) * MarkovModel::SLOT_SIZE, 0);
+    std::memcpy(out.data(), MarkovModel::MAGIC, sizeof(MarkovModel::MAGIC));
+    putU32(out, 8, static_cast<uint32_t>(pImpl->order));
+    putU32(out, 12, static_cast<uint32_t>(pImpl->symbols.size() - 1));
+    putU32(out, 16, slotCount);
+    putU32(out, 20, static_cast<uint32_t>(pImpl->counts.size()));
+    std::memcpy(out.data() + MarkovModel::HEADER_SIZE, pImpl->symbols.data(), pImpl->symbols.size());
+
+    const size_t slotBase = MarkovModel::HEADER_SIZE + MarkovModel::SYMBOL_TABLE_SIZE;
+    std::vector<bool> occupied(slotCount, false);
+    for (const auto& context : pImpl->counts) {
+        uint64_t rawTotal = 0;
+        for (const auto& count : context.second) {
+            rawTotal += count.second;
+        }
+        const uint64_t divisor = rawTotal / MAX_TOTAL + 1;
+
+        std::vector<std::pair<uint8_t, uint32_t>> weights;
+        uint32_t total = 0;
+        for (const auto& count : context.second) {
+            uint32_t weight = static_cast<uint32_t>(count.second / divisor);
+            weight = weight == 0 ? 1 : weight;
+            weights.emplace_back(count.first, weight);
+            total += weight;
+        }
+
+        if (out.size() > UINT32_MAX) {
+            throw std::runtime_error("Markov model exceeds 4 GiB");
+        }
+        const size_t offset = out.size();
+        uint32_t slot = MarkovModel::slotOf(context.first, slotCount);
+        while (occupied[slot]) {
+            slot = (slot + 1) & (slotCount - 1);
+        }
+        occupied[slot] = true;
+        putU32(out, slotBase + size_t(slot) * MarkovModel::SLOT_SIZE, context.first + 1);
+        putU32(out, slotBase + size_t(slot) * MarkovModel::SLOT_SIZE + 4, static_cast<uint32_t>(offset));
+
+        std::vector<AliasEntry> entries = buildAlias(weights, total);
+        out.resize(offset + MarkovModel::TABLE_HEADER_SIZE + entries.size() * MarkovModel::ENTRY_SIZE, 0);
+        putU32(out, offset, static_cast<uint32_t>(entries.size()));
+        putU32(out, offset + 4, total);
+        size_t at = offset + MarkovModel::TABLE_HEADER_SIZE;
+        for (const AliasEntry& entry : entries) {
+            putU32(out, at, entry.threshold);
+            putU32(out, at + 4, entry.weight);
+            out[at + 8] = entry.symbol;
+            out[at + 9] = entry.alias;
+            at += MarkovModel::ENTRY_SIZE;
+        }
+    }
+    return out;
+}
+
+void MarkovTrainer::write(const std::string& path) const {
+    std::vector<uint8_t> bytes = compile();
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("Cannot open " + path + " for writing");
+    }
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    if (!file) {
+        throw std::runtime_error("Cannot write " + path);
+    }
+}
+
+} // namespace strategies
+} // namespace password_generator
@@ -0,0 +1,315 @@
+#include "strategies/ParallelBatchGenerator.h"
+#include "strategies/BatchPasswordStrategy.h"
+#include "utils/CpuQuota.h"
+#include "utils/KeyedRandomGenerator.h"
+#include "utils/SecureMemory.h"
+#include "utils/Sha256.h"
+#include "utils/ThreadLocalRandomGenerator.h"
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace password_generator {
+namespace strategies {
+
+namespace {
+
+constexpr size_t CACHE_LINE = 64;
+
+// A run of unclaimed slices [begin, end), packed into one word so the
+// owner and thieves claim from it with a single compare-and-swap
+uint64_t packRun(uint64_t begin, uint64_t end) {
+    return begin << 32 | end;
+}
+
+uint64_t runBegin(uint64_t run) {
+    return run >> 32;
+}
+
+uint64_t runEnd(uint64_t run) {
+    return run & 0xFFFFFFFFu;
+}
+
+struct alignas(CACHE_LINE) Run {
+    std::atomic<uint64_t> slices{0};
+};
+
+// Everything one worker touches while filling a slice
+struct alignas(CACHE_LINE) Worker {
+    std::unique_ptr<core::interfaces::IPasswordStrategy> strategy;
+    std::unique_ptr<utils::KeyedRandomGenerator> keyed;
+    bool seeded = false;
+};
+
+// What a worker's strategy draws from: the slice's keyed stream when the
+// batch is seeded, the calling thread's generator otherwise
+class WorkerRandomGenerator : public utils::IBulkRandomGenerator {
+public:
+    explicit WorkerRandomGenerator(Worker& worker) : worker_(worker) {}
+
+    int generate(int min, int max) override {
+        return source().generate(min, max);
+    }
+
+    void generateBounded(uint32_t* values, size_t count) override {
+        source().generateBounded(values, count);
+    }
+
+    void generateIndices(uint32_t* out, size_t count, uint32_t bound) override {
+        source().generateIndices(out, count, bound);
+    }
+
+    void fillBytes(void* out, size_t length) override {
+        source().fillBytes(out, length);
+    }
+
+private:
+    utils::IBulkRandomGenerator& source() {
+        if (worker_.seeded) {
+            return *worker_.keyed;
+        }
+        return local_;
+    }
+
+    Worker& worker_;
+    utils::ThreadLocalRandomGenerator local_;
+};
+
+} // namespace
+
+class ParallelBatchGenerator::Impl {
+public:
+    StrategyFactory factory;
+    size_t threads;
+    std::unique_ptr<Run[]> runs;
+    std::vector<Worker> workers;
+    std::vector<std::thread> pool;
+
+    bool seeded = false;
+    uint8_t seed[utils::ChaCha20Drbg::KEY_SIZE] = {};
+
+    // The current batch
+    char* out = nullptr;
+    size_t count = 0;
+    size_t length = 0;
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+
+    // Pool threads wait for epoch to advance with their index below active
+    std::mutex mutex;
+    std::condition_variable start;
+    std::condition_variable done;
+    uint64_t epoch = 0;
+    size_t active = 0;
+    size_t running = 0;
+    bool stopping = false;
+
+    Impl(StrategyFactory strategyFactory, size_t threadCount)
+        : factory(std::move(strategyFactory)),
+          threads(threadCount ? threadCount : utils::availableCpus()),
+          runs(new Run[threads]),
+          workers(threads) {}
+
+    ~Impl() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        start.notify_all();
+        for (std::thread& thread : pool) {
+            thread.join();
+        }
+        utils::secureWipe(seed, sizeof(seed));
+    }
+
+    void poolLoop(size_t index) {
+        uint64_t seen = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                start.wait(lock, [&]() { return stopping || (epoch != seen && index < active); });
+                if (stopping) {
+                    return;
+                }
+                seen = epoch;
+            }
+            work(index);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (--running == 0) {
+                    done.notify_one();
+                }
+            }
+        }
+    }
+
+    void work(size_t index) {
+        Worker& worker = workers[index];
+        try {
+            if (!worker.strategy) {
+                worker.strategy = factory(std::make_unique<WorkerRandomGenerator>(worker));
+                if (!worker.strategy) {
+                    throw std::runtime_error("Strategy factory returned no strategy");
+                }
+            }
+            uint64_t slice;
+            while (!failed.load(std::memory_order_relaxed) &&
+                   (takeOwn(index, slice) || steal(index, slice))) {
+                fill(worker, slice);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+            failed = true;
+        }
+    }
+
+    bool takeOwn(size_t index, uint64_t& slice) {
+        std::atomic<uint64_t>& own = runs[index].slices;
+        uint64_t run = own.load(std::memory_order_acquire);
+        while (runBegin(run) < runEnd(run)) {
+            if (own.compare_exchange_weak(run, packRun(runBegin(run) + 1, runEnd(run)),
+                                          std::memory_order_acq_rel)) {
+                slice = runBegin(run);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Take the back half of the largest run, keeping its first slice and
+    // making the rest this worker's own run
+    bool steal(size_t index, uint64_t& slice) {
+        for (;;) {
+            size_t victim = threads;
+            uint64_t victimRun = 0;
+            uint64_t largest = 0;
+            for (size_t i = 0; i < active; ++i) {
+                const uint64_t run = runs[i].slices.load(std::memory_order_acquire);
+                if (i != index && runEnd(run) > runBegin(run) &&
+                    runEnd(run) - runBegin(run) > largest) {
+                    victim = i;
+                    victimRun = run;
+                    largest = runEnd(run) - runBegin(run);
+                }
+            }
+            if (victim == threads) {
+                return false;
+            }
+            const uint64_t middle = runBegin(victimRun) + largest / 2;
+            if (runs[victim].slices.compare_exchange_strong(
+                    victimRun, packRun(runBegin(victimRun), middle), std::memory_order_acq_rel)) {
+                slice = middle;
+                runs[index].slices.store(packRun(middle + 1, runEnd(victimRun)),
+                                         std::memory_order_release);
+                return true;
+            }
+        }
+    }
+
+    void fill(Worker& worker, uint64_t slice) {
+        worker.seeded = seeded;
+        if (seeded) {
+            // Each slice's stream depends only on the seed and its index
+            uint8_t index[8];
+            for (size_t i = 0; i < 8; ++i) {
+                index[i] = static_cast<uint8_t>(slice >> (8 * i));
+            }
+            utils::Sha256::Digest digest = utils::hmacSha256(seed, sizeof(seed), index, sizeof(index));
+            uint8_t key[utils::ChaCha20Drbg::KEY_SIZE];
+            for (size_t i = 0; i < sizeof(key); ++i) {
+                key[i] = digest[i];
+            }
+            if (worker.keyed) {
+                worker.keyed->rekey(key);
+            } else {
+                worker.keyed = std::make_unique<utils::KeyedRandomGenerator>(key);
+            }
+            utils::secureWipe(key, sizeof(key));
+            utils::secureWipe(digest.data(), digest.size());
+        }
+        const size_t first = static_cast<size_t>(slice) * SLICE_PASSWORDS;
+        const size_t n = count - first < SLICE_PASSWORDS ? count - first : SLICE_PASSWORDS;
+        generateBatch(*worker.strategy, out + first * length, n, length);
+    }
+};
+
+ParallelBatchGenerator::ParallelBatchGenerator(StrategyFactory factory, size_t threads)
+    : pImpl(std::make_unique<Impl>(std::move(factory), threads)) {}
+
+ParallelBatchGenerator::~ParallelBatchGenerator() = default;
+
+size_t ParallelBatchGenerator::threadCount() const {
+    return pImpl->threads;
+}
+
+void ParallelBatchGenerator::setSeed(const uint8_t (&seed)[utils::ChaCha20Drbg::KEY_SIZE]) {
+    for (size_t i = 0; i < sizeof(seed); ++i) {
+        pImpl->seed[i] = seed[i];
+    }
+    pImpl->seeded = true;
+}
+
+void ParallelBatchGenerator::clearSeed() {
+    utils::secureWipe(pImpl->seed, sizeof(pImpl->seed));
+    pImpl->seeded = false;
+}
+
+void ParallelBatchGenerator::generate(char* out, size_t count, size_t length) {
+    Impl& impl = *pImpl;
+    const size_t slices = (count + SLICE_PASSWORDS - 1) / SLICE_PASSWORDS;
+    if (slices == 0) {
+        return;
+    }
+    if (slices > 0xFFFFFFFFu) {
+        throw std::invalid_argument("Batch is too large");
+    }
+    const size_t active = slices < impl.threads ? slices : impl.threads;
+    for (size_t i = 0; i < impl.threads; ++i) {
+        const uint64_t begin = i < active ? slices * i / active : 0;
+        const uint64_t end = i < active ? slices * (i + 1) / active : 0;
+        impl.runs[i].slices.store(packRun(begin, end), std::memory_order_relaxed);
+    }
+
+    impl.out = out;
+    impl.count = count;
+    impl.length = length;
+    impl.failed = false;
+    impl.error = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(impl.mutex);
+        while (impl.pool.size() + 1 < active) {
+            const size_t index = impl.pool.size() + 1;
+            impl.pool.emplace_back([&impl, index]() { impl.poolLoop(index); });
+        }
+        impl.active = active;
+        impl.running = active - 1;
+        ++impl.epoch;
+    }
+    impl.start.notify_all();
+
+    impl.work(0);
+    {
+        std::unique_lock<std::mutex> lock(impl.mutex);
+        impl.done.wait(lock, [&]() { return impl.running == 0; });
+    }
+    if (impl.error) {
+        std::rethrow_exception(impl.error);
+    }
+}
+
+utils::PasswordBatch ParallelBatchGenerator::generate(size_t count, size_t length,
+                                                      utils::PasswordBatch::Backing backing) {
+    utils::PasswordBatch batch(count, length, backing);
+    generate(batch.data(), count, length);
+    return batch;
+}
+
+} // namespace strategies
+} // namespace password_generator
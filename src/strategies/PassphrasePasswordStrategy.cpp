@@ -0,0 +1,192 @@
+#include "strategies/PassphrasePasswordStrategy.h"
+#include "utils/BulkRandomGenerator.h"
+#include "utils/ThreadLocalRandomGenerator.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace password_generator {
+namespace strategies {
+
+class PassphrasePasswordStrategy::Impl {
+public:
+    std::shared_ptr<const WordList> list;
+    std::unique_ptr<core::interfaces::IRandomGenerator> rng;
+    size_t words = DEFAULT_WORDS;
+    std::string separator = "-";
+    bool capitalize = false;
+    size_t digits = 0;
+
+    // Whether the list has been checked against the current options
+    bool checked = false;
+
+    Impl(std::shared_ptr<const WordList> wordList,
+         std::unique_ptr<core::interfaces::IRandomGenerator> randomGen)
+        : list(std::move(wordList)),
+          rng(randomGen ? std::move(randomGen)
+              : std::make_unique<utils::ThreadLocalRandomGenerator>()) {
+        if (!list) {
+            throw std::invalid_argument("Word list must not be null");
+        }
+    }
+
+    // Every choice of words and digits must print differently, or the
+    // keyspace overstates the entropy. The list's facts come from its
+    // header; only a multi-byte separator whose every byte occurs in some
+    // word needs a scan, once per option change
+    void checkUnambiguous() {
+        if (checked) {
+            return;
+        }
+        if (separator.empty()) {
+            throw std::invalid_argument("Passphrase separator must not be empty");
+        }
+        if (capitalize && list->hasCapitalCollision()) {
+            throw std::invalid_argument("Capitalizing makes two words of the list the same; "
+                                        "compile it with --lowercase");
+        }
+        if (digits > 0 && list->hasWordEndingInDigit()) {
+            throw std::invalid_argument("A word of the list ends in a digit, so appended digits "
+                                        "are ambiguous");
+        }
+        // Capitalizing may add the upper-case form of any letter used
+        const bool mayContain = std::all_of(separator.begin(), separator.end(), [this](char c) {
+            const auto byte = static_cast<unsigned char>(c);
+            const bool upper = byte >= 'A' && byte <= 'Z';
+            return list->usesByte(byte) || (capitalize && upper && list->usesByte(byte - 'A' + 'a'));
+        });
+        if (mayContain && separator.size() == 1) {
+            throw std::invalid_argument("A word of the list may contain the separator '" + separator + "'");
+        }
+        std::string shown;
+        for (size_t i = 0; mayContain && i < list->size(); ++i) {
+            const std::string_view word = (*list)[i];
+            shown.assign(word.data(), word.size());
+            if (capitalize && shown[0] >= 'a' && shown[0] <= 'z') {
+                shown[0] = static_cast<char>(shown[0] - 'a' + 'A');
+            }
+            if (shown.find(separator) != std::string::npos) {
+                throw std::invalid_argument("Word '" + shown + "' contains the separator '" +
+                                            separator + "'");
+            }
+        }
+        checked = true;
+    }
+};
+
+PassphrasePasswordStrategy::PassphrasePasswordStrategy(
+    const std::string& wordListPath,
+    std::unique_ptr<core::interfaces::IRandomGenerator> randomGen)
+    : PassphrasePasswordStrategy(WordList::load(wordListPath), std::move(randomGen)) {}
+
+PassphrasePasswordStrategy::PassphrasePasswordStrategy(
+    std::shared_ptr<const WordList> wordList,
+    std::unique_ptr<core::interfaces::IRandomGenerator> randomGen)
+    : pImpl(std::make_unique<Impl>(std::move(wordList), std::move(randomGen))) {}
+
+PassphrasePasswordStrategy::~PassphrasePasswordStrategy() = default;
+
+void PassphrasePasswordStrategy::setWordCount(size_t words) {
+    if (words == 0 || words < pImpl->digits) {
+        throw std::invalid_argument("Word count must be positive and at least the digit count");
+    }
+    pImpl->words = words;
+}
+
+size_t PassphrasePasswordStrategy::getWordCount() const {
+    return pImpl->words;
+}
+
+void PassphrasePasswordStrategy::setSeparator(const std::string& separator) {
+    pImpl->separator = separator;
+    pImpl->checked = false;
+}
+
+void PassphrasePasswordStrategy::setCapitalize(bool capitalize) {
+    pImpl->capitalize = capitalize;
+    pImpl->checked = false;
+}
+
+void PassphrasePasswordStrategy::setDigitCount(size_t digits) {
+    if (digits > pImpl->words) {
+        throw std::invalid_argument("Digit count cannot exceed the word count");
+    }
+    pImpl->digits = digits;
+    pImpl->checked = false;
+}
+
+const WordList& PassphrasePasswordStrategy::getWordList() const {
+    return *pImpl->list;
+}
+
+utils::BigUint PassphrasePasswordStrategy::getKeyspace() const {
+    pImpl->checkUnambiguous();
+    utils::BigUint keyspace = utils::BigUint::pow(utils::BigUint(pImpl->list->size()), pImpl->words);
+    // C(words, digits) * 10^digits, built incrementally so each division is exact
+    for (size_t i = 0; i < pImpl->digits; ++i) {
+        keyspace *= static_cast<uint32_t>(pImpl->words - i);
+        keyspace *= 10u;
+    }
+    for (size_t i = 2; i <= pImpl->digits; ++i) {
+        keyspace.divideSmall(static_cast<uint32_t>(i));
+    }
+    return keyspace;
+}
+
+double PassphrasePasswordStrategy::getEntropyBits() const {
+    return getKeyspace().log2();
+}
+
+std::string PassphrasePasswordStrategy::generate(size_t /*length*/) {
+    pImpl->checkUnambiguous();
+    const WordList& list = *pImpl->list;
+    const size_t words = pImpl->words;
+    const size_t digits = pImpl->digits;
+
+    // Word indices, then a partial Fisher-Yates over word positions to pick
+    // the digit slots, then the digits themselves
+    utils::DrawBuffer draws(words + 2 * digits);
+    for (size_t i = 0; i < words; ++i) {
+        draws[i] = static_cast<uint32_t>(list.size());
+    }
+    for (size_t k = 0; k < digits; ++k) {
+        draws[words + k] = static_cast<uint32_t>(words - k);
+        draws[words + digits + k] = 10;
+    }
+    draws.draw(*pImpl->rng);
+
+    utils::DrawBuffer positions(words);
+    utils::DrawBuffer digitAt(words);
+    for (size_t i = 0; i < words; ++i) {
+        positions[i] = static_cast<uint32_t>(i);
+        digitAt[i] = 10;   // no digit
+    }
+    for (size_t k = 0; k < digits; ++k) {
+        std::swap(positions[k], positions[k + draws[words + k]]);
+        digitAt[positions[k]] = draws[words + digits + k];
+    }
+
+    size_t total = pImpl->separator.size() * (words - 1) + digits;
+    for (size_t i = 0; i < words; ++i) {
+        total += list[draws[i]].size();
+    }
+    std::string passphrase;
+    passphrase.reserve(total);
+    for (size_t i = 0; i < words; ++i) {
+        if (i > 0) {
+            passphrase += pImpl->separator;
+        }
+        const size_t start = passphrase.size();
+        passphrase += list[draws[i]];
+        if (pImpl->capitalize && passphrase[start] >= 'a' && passphrase[start] <= 'z') {
+            passphrase[start] = static_cast<char>(passphrase[start] - 'a' + 'A');
+        }
+        if (digitAt[i] < 10) {
+            passphrase += static_cast<char>('0' + digitAt[i]);
+        }
+    }
+    return passphrase;
+}
+
+} // namespace strategies
+} // namespace password_generator
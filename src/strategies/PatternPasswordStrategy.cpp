@@ -1,5 +1,7 @@
 #include "strategies/PatternPasswordStrategy.h"
-#include "utils/SecureRandomGenerator.h"
+#include "utils/ThreadLocalRandomGenerator.h"
+#include "utils/BulkRandomGenerator.h"
+#include <cstring>
 #include <stdexcept>
 
 namespace password_generator {
@@ -8,38 +10,83 @@ namespace strategies {
 class PatternPasswordStrategy::Impl {
 public:
     std::string pattern;
+    PatternProgram::CustomCharsets customCharsets;
+    PatternProgram program;
     std::unique_ptr<core::interfaces::IRandomGenerator> rng;
     
-    static const std::string LOWERCASE_CHARS;
-    static const std::string UPPERCASE_CHARS;
-    static const std::string DIGIT_CHARS;
-    static const std::string SYMBOL_CHARS;
-    
     Impl(const std::string& pat, std::unique_ptr<core::interfaces::IRandomGenerator> randomGen)
-        : pattern(pat), rng(randomGen ? std::move(randomGen) 
-              : std::make_unique<utils::SecureRandomGenerator>()) {}
-              
-    char generateCharForType(char patternChar) {
-        switch (patternChar) {
-            case 'L':
-                return LOWERCASE_CHARS[rng->generate(0, LOWERCASE_CHARS.length() - 1)];
-            case 'U':
-                return UPPERCASE_CHARS[rng->generate(0, UPPERCASE_CHARS.length() - 1)];
-            case 'D':
-                return DIGIT_CHARS[rng->generate(0, DIGIT_CHARS.length() - 1)];
-            case 'S':
-                return SYMBOL_CHARS[rng->generate(0, SYMBOL_CHARS.length() - 1)];
-            default:
-                return patternChar; // Use literally
+        : pattern(pat), program(PatternProgram::compile(pat)),
+          rng(randomGen ? std::move(randomGen) 
+              : std::make_unique<utils::ThreadLocalRandomGenerator>()) {}
+    
+    /**
+     * @brief Class positions among the first `length` output characters
+     */
+    size_t drawsFor(size_t length) const {
+        size_t draws = 0;
+        size_t remaining = length;
+        while (remaining > 0) {
+            for (const auto& op : program.ops()) {
+                if (remaining == 0) {
+                    break;
+                }
+                size_t count = op.count < remaining ? op.count : remaining;
+                remaining -= count;
+                if (op.kind == PatternProgram::Op::Kind::Class) {
+                    draws += count;
+                }
+            }
+        }
+        return draws;
+    }
+    
+    // Queue every class position, op by op, so the whole password costs a
+    // single call; runs of one class become runs of equal bounds
+    void fillBounds(uint32_t* draws, size_t length) const {
+        size_t drawCount = 0;
+        size_t position = 0;
+        while (position < length) {
+            for (const auto& op : program.ops()) {
+                if (position == length) {
+                    break;
+                }
+                size_t count = op.count < length - position ? op.count : length - position;
+                if (op.kind == PatternProgram::Op::Kind::Class) {
+                    const uint32_t bound =
+                        static_cast<uint32_t>(program.characterClass(op.index).size());
+                    for (size_t i = 0; i < count; ++i) {
+                        draws[drawCount++] = bound;
+                    }
+                }
+                position += count;
+            }
+        }
+    }
+    
+    // Execute the program, repeating it if the password is longer
+    void emit(const uint32_t* draws, size_t length, char* out) const {
+        size_t next = 0;
+        size_t position = 0;
+        while (position < length) {
+            for (const auto& op : program.ops()) {
+                if (position == length) {
+                    break;
+                }
+                size_t count = op.count < length - position ? op.count : length - position;
+                if (op.kind == PatternProgram::Op::Kind::Literal) {
+                    std::memcpy(out + position, program.literals() + op.index, count);
+                } else {
+                    const utils::CharacterTable& chars = program.characterClass(op.index);
+                    for (size_t i = 0; i < count; ++i) {
+                        out[position + i] = chars[draws[next++]];
+                    }
+                }
+                position += count;
+            }
         }
     }
 };
 
-const std::string PatternPasswordStrategy::Impl::LOWERCASE_CHARS = "abcdefghijklmnopqrstuvwxyz";
-const std::string PatternPasswordStrategy::Impl::UPPERCASE_CHARS = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
-const std::string PatternPasswordStrategy::Impl::DIGIT_CHARS = "0123456789";
-const std::string PatternPasswordStrategy::Impl::SYMBOL_CHARS = "!@#$%^&*()_+-=[]{}|;:,.<>?";
-
 PatternPasswordStrategy::PatternPasswordStrategy(
     const std::string& pattern,
     std::unique_ptr<core::interfaces::IRandomGenerator> randomGen)
@@ -48,6 +95,8 @@ PatternPasswordStrategy::PatternPasswordStrategy(
 PatternPasswordStrategy::~PatternPasswordStrategy() = default;
 
 void PatternPasswordStrategy::setPattern(const std::string& pattern) {
+    // Compile first so a malformed pattern leaves the old one in place
+    pImpl->program = PatternProgram::compile(pattern, pImpl->customCharsets);
     pImpl->pattern = pattern;
 }
 
@@ -55,22 +104,66 @@ const std::string& PatternPasswordStrategy::getPattern() const {
     return pImpl->pattern;
 }
 
-std::string PatternPasswordStrategy::generate(size_t length) {
-    if (pImpl->pattern.empty()) {
+void PatternPasswordStrategy::setCustomCharset(int index, const std::string& definition) {
+    if (index < 1 || index > PatternProgram::CUSTOM_CHARSETS) {
+        throw std::invalid_argument("Custom charset index must be 1-4");
+    }
+    PatternProgram::CustomCharsets custom = pImpl->customCharsets;
+    custom[static_cast<size_t>(index - 1)] = definition;
+    pImpl->program = PatternProgram::compile(pImpl->pattern, custom);
+    pImpl->customCharsets = std::move(custom);
+}
+
+const PatternProgram& PatternPasswordStrategy::getProgram() const {
+    return pImpl->program;
+}
+
+utils::BigUint PatternPasswordStrategy::getKeyspace(size_t length) const {
+    return pImpl->program.keyspace(length);
+}
+
+double PatternPasswordStrategy::getEntropyBits(size_t length) const {
+    return pImpl->program.entropyBits(length);
+}
+
+void PatternPasswordStrategy::generateInto(char* out, size_t length) {
+    if (pImpl->program.empty()) {
         throw std::runtime_error("Pattern cannot be empty");
     }
     
-    std::string password;
-    password.reserve(length);
-    
-    // Generate based on pattern, repeating pattern if necessary
-    for (size_t i = 0; i < length; ++i) {
-        char patternChar = pImpl->pattern[i % pImpl->pattern.length()];
-        password += pImpl->generateCharForType(patternChar);
+    utils::DrawBuffer draws(pImpl->drawsFor(length));
+    pImpl->fillBounds(draws.data(), length);
+    draws.draw(*pImpl->rng);
+    pImpl->emit(draws.data(), length, out);
+}
+
+void PatternPasswordStrategy::generateBatch(char* out, size_t count, size_t length) {
+    if (pImpl->program.empty()) {
+        throw std::runtime_error("Pattern cannot be empty");
+    }
+    if (count == 0 || length == 0) {
+        return;
     }
     
-    return password;
+    // The program is walked once for the bounds; each chunk of passwords
+    // then costs one generator call and one pass of the program apiece
+    const size_t perPassword = pImpl->drawsFor(length);
+    const size_t chunk = batchChunk(perPassword, count);
+    utils::DrawBuffer bounds(perPassword);
+    pImpl->fillBounds(bounds.data(), length);
+    utils::DrawBuffer draws(chunk * perPassword);
+    for (size_t done = 0; done < count; done += chunk) {
+        const size_t n = chunk < count - done ? chunk : count - done;
+        for (size_t i = 0; i < n; ++i) {
+            std::memcpy(draws.data() + i * perPassword, bounds.data(),
+                        perPassword * sizeof(uint32_t));
+        }
+        utils::generateBounded(*pImpl->rng, draws.data(), n * perPassword);
+        for (size_t i = 0; i < n; ++i) {
+            pImpl->emit(draws.data() + i * perPassword, length, out + (done + i) * length);
+        }
+    }
 }
 
 } // namespace strategies
-} // namespace password_generator
\ No newline at end of file
+} // namespace password_generator
@@ -0,0 +1,306 @@
+#include "strategies/PatternProgram.h"
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <string_view>
+
+namespace password_generator {
+namespace strategies {
+
+namespace {
+
+constexpr std::string_view HASHCAT_SYMBOLS = " !\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~";
+constexpr std::string_view HEX_LOWER = "0123456789abcdef";
+constexpr std::string_view HEX_UPPER = "0123456789ABCDEF";
+
+struct Token {
+    bool isClass;
+    std::string chars;   // Class members, or the single literal character
+    size_t count;
+    bool repeated = false;   // Whether an explicit {n} already set count
+};
+
+// Keep the first occurrence of each character so every member is equally likely
+std::string dedupe(const std::string& chars) {
+    bool seen[256] = {false};
+    std::string result;
+    for (char c : chars) {
+        auto byte = static_cast<unsigned char>(c);
+        if (!seen[byte]) {
+            seen[byte] = true;
+            result.push_back(c);
+        }
+    }
+    return result;
+}
+
+std::string builtinMask(char name) {
+    using namespace utils::tables;
+    switch (name) {
+        case 'l': return std::string(LOWERCASE.characters());
+        case 'u': return std::string(UPPERCASE.characters());
+        case 'd': return std::string(DIGITS.characters());
+        case 's': return std::string(HASHCAT_SYMBOLS);
+        case 'a': return std::string(LOWERCASE.characters()) + std::string(UPPERCASE.characters()) +
+                         std::string(DIGITS.characters()) + std::string(HASHCAT_SYMBOLS);
+        case 'h': return std::string(HEX_LOWER);
+        case 'H': return std::string(HEX_UPPER);
+        default: return std::string();
+    }
+}
+
+// Custom charset definitions use hashcat syntax: built-in masks and literals
+std::string expandCustomCharset(const std::string& definition) {
+    std::string chars;
+    for (size_t i = 0; i < definition.size(); ++i) {
+        if (definition[i] != '?') {
+            chars.push_back(definition[i]);
+            continue;
+        }
+        if (++i == definition.size()) {
+            throw std::invalid_argument("Custom charset ends with '?'");
+        }
+        if (definition[i] == '?') {
+            chars.push_back('?');
+            continue;
+        }
+        std::string mask = builtinMask(definition[i]);
+        if (mask.empty()) {
+            throw std::invalid_argument(std::string("Unknown mask '?") + definition[i] +
+                                        "' in custom charset");
+        }
+        chars += mask;
+    }
+    return chars;
+}
+
+// Parses "[...]" starting after the opening bracket; returns index past ']'
+size_t parseBracketClass(const std::string& pattern, size_t pos, std::string& chars) {
+    if (pos < pattern.size() && pattern[pos] == '^') {
+        throw std::invalid_argument("Negated character classes are not supported");
+    }
+    while (pos < pattern.size() && pattern[pos] != ']') {
+        char first = pattern[pos++];
+        if (first == '\\') {
+            if (pos == pattern.size()) {
+                break;
+            }
+            first = pattern[pos++];
+        }
+        if (pos + 1 < pattern.size() && pattern[pos] == '-' && pattern[pos + 1] != ']') {
+            char last = pattern[pos + 1];
+            pos += 2;
+            if (last == '\\') {
+                if (pos == pattern.size()) {
+                    break;
+                }
+                last = pattern[pos++];
+            }
+            if (static_cast<unsigned char>(last) < static_cast<unsigned char>(first)) {
+                throw std::invalid_argument("Reversed range in character class");
+            }
+            for (int c = static_cast<unsigned char>(first); c <= static_cast<unsigned char>(last); ++c) {
+                chars.push_back(static_cast<char>(c));
+            }
+        } else {
+            chars.push_back(first);
+        }
+    }
+    if (pos == pattern.size()) {
+        throw std::invalid_argument("Unterminated character class");
+    }
+    if (chars.empty()) {
+        throw std::invalid_argument("Empty character class");
+    }
+    return pos + 1;
+}
+
+// Parses "{n}" starting after the opening brace; returns index past '}'
+size_t parseRepeat(const std::string& pattern, size_t pos, size_t& count) {
+    size_t end = pattern.find('}', pos);
+    if (end == std::string::npos || end == pos) {
+        throw std::invalid_argument("Malformed repeat count");
+    }
+    count = 0;
+    for (size_t i = pos; i < end; ++i) {
+        if (pattern[i] < '0' || pattern[i] > '9') {
+            throw std::invalid_argument("Repeat count must be a number");
+        }
+        count = count * 10 + static_cast<size_t>(pattern[i] - '0');
+        if (count > PatternProgram::MAX_REPEAT) {
+            throw std::invalid_argument("Repeat count too large");
+        }
+    }
+    if (count == 0) {
+        throw std::invalid_argument("Repeat count must be positive");
+    }
+    return end + 1;
+}
+
+std::vector<Token> tokenize(const std::string& pattern, const PatternProgram::CustomCharsets& custom) {
+    std::vector<Token> tokens;
+    size_t pos = 0;
+    while (pos < pattern.size()) {
+        char c = pattern[pos++];
+        switch (c) {
+            case 'L':
+                tokens.push_back({true, std::string(utils::tables::LOWERCASE.characters()), 1});
+                break;
+            case 'U':
+                tokens.push_back({true, std::string(utils::tables::UPPERCASE.characters()), 1});
+                break;
+            case 'D':
+                tokens.push_back({true, std::string(utils::tables::DIGITS.characters()), 1});
+                break;
+            case 'S':
+                tokens.push_back({true, std::string(utils::tables::SYMBOLS.characters()), 1});
+                break;
+            case '\\':
+                if (pos == pattern.size()) {
+                    throw std::invalid_argument("Pattern ends with an escape");
+                }
+                tokens.push_back({false, std::string(1, pattern[pos++]), 1});
+                break;
+            case '?': {
+                if (pos == pattern.size()) {
+                    throw std::invalid_argument("Pattern ends with '?'");
+                }
+                char name = pattern[pos++];
+                if (name == '?') {
+                    tokens.push_back({false, "?", 1});
+                } else if (name >= '1' && name <= '0' + PatternProgram::CUSTOM_CHARSETS) {
+                    const std::string& definition = custom[static_cast<size_t>(name - '1')];
+                    std::string chars = expandCustomCharset(definition);
+                    if (chars.empty()) {
+                        throw std::invalid_argument(std::string("Custom charset ?") + name +
+                                                    " is not defined");
+                    }
+                    tokens.push_back({true, std::move(chars), 1});
+                } else {
+                    std::string chars = builtinMask(name);
+                    if (chars.empty()) {
+                        throw std::invalid_argument(std::string("Unknown mask '?") + name + "'");
+                    }
+                    tokens.push_back({true, std::move(chars), 1});
+                }
+                break;
+            }
+            case '[': {
+                std::string chars;
+                pos = parseBracketClass(pattern, pos, chars);
+                tokens.push_back({true, std::move(chars), 1});
+                break;
+            }
+            case '{': {
+                if (tokens.empty() || tokens.back().repeated) {
+                    throw std::invalid_argument("Repeat count must follow a single token");
+                }
+                pos = parseRepeat(pattern, pos, tokens.back().count);
+                tokens.back().repeated = true;
+                break;
+            }
+            default:
+                tokens.push_back({false, std::string(1, c), 1});
+                break;
+        }
+    }
+    return tokens;
+}
+
+} // namespace
+
+PatternProgram PatternProgram::compile(const std::string& pattern, const CustomCharsets& custom) {
+    PatternProgram program;
+    std::map<std::string, uint32_t> classIndex;
+    std::vector<std::pair<size_t, size_t>> classSpans;
+
+    for (const Token& token : tokenize(pattern, custom)) {
+        Op op;
+        op.count = static_cast<uint32_t>(token.count);
+        if (token.isClass) {
+            std::string chars = dedupe(token.chars);
+            auto found = classIndex.find(chars);
+            if (found == classIndex.end()) {
+                found = classIndex.emplace(chars, static_cast<uint32_t>(classSpans.size())).first;
+                classSpans.emplace_back(program.classPool_.size(), chars.size());
+                program.classPool_.insert(program.classPool_.end(), chars.begin(), chars.end());
+            }
+            op.kind = Op::Kind::Class;
+            op.index = found->second;
+        } else {
+            op.kind = Op::Kind::Literal;
+            op.index = static_cast<uint32_t>(program.literals_.size());
+            program.literals_.insert(program.literals_.end(), token.count, token.chars[0]);
+        }
+
+        // Literal runs are contiguous in literals_, so adjacent ones merge
+        if (!program.ops_.empty()) {
+            Op& last = program.ops_.back();
+            if (last.kind == op.kind && (op.kind == Op::Kind::Literal || last.index == op.index)) {
+                last.count += op.count;
+                program.length_ += op.count;
+                continue;
+            }
+        }
+        program.ops_.push_back(op);
+        program.length_ += op.count;
+    }
+
+    // Views are taken only once the pool has stopped growing
+    for (const auto& span : classSpans) {
+        program.classes_.emplace_back(
+            std::string_view(program.classPool_.data() + span.first, span.second));
+    }
+    return program;
+}
+
+utils::BigUint PatternProgram::keyspace(size_t outputLength) const {
+    if (empty()) {
+        return utils::BigUint(outputLength == 0 ? 1 : 0);
+    }
+
+    // Product over the first `remaining` positions of one pass
+    auto partial = [this](size_t remaining) {
+        utils::BigUint product(1);
+        for (const Op& op : ops_) {
+            if (remaining == 0) {
+                break;
+            }
+            size_t count = op.count < remaining ? op.count : remaining;
+            remaining -= count;
+            if (op.kind == Op::Kind::Class) {
+                product *= utils::BigUint::pow(classes_[op.index].size(), count);
+            }
+        }
+        return product;
+    };
+
+    return utils::BigUint::pow(partial(length_), outputLength / length_) *
+           partial(outputLength % length_);
+}
+
+double PatternProgram::entropyBits(size_t outputLength) const {
+    if (empty()) {
+        return 0.0;
+    }
+
+    double bits = 0.0;
+    size_t remaining = outputLength;
+    while (remaining > 0) {
+        for (const Op& op : ops_) {
+            if (remaining == 0) {
+                break;
+            }
+            size_t count = op.count < remaining ? op.count : remaining;
+            remaining -= count;
+            if (op.kind == Op::Kind::Class) {
+                bits += static_cast<double>(count) *
+                        std::log2(static_cast<double>(classes_[op.index].size()));
+            }
+        }
+    }
+    return bits;
+}
+
+} // namespace strategies
+} // namespace password_generator
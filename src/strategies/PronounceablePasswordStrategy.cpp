@@ -1,33 +1,76 @@
 #include "strategies/PronounceablePasswordStrategy.h"
-#include "utils/SecureRandomGenerator.h"
-#include <vector>
-#include <cctype>
+#include "utils/ThreadLocalRandomGenerator.h"
+#include "utils/BulkRandomGenerator.h"
 
 namespace password_generator {
 namespace strategies {
 
+namespace {
+
+// Consonant-vowel syllables, two bytes each
+constexpr char SYLLABLES[] =
+    "babebibobu" "cacecicocu" "dadedidodu" "fafefifofu" "gagegigogu"
+    "hahehihohu" "jajejijoju" "kakekikoku" "lalelilolu" "mamemimomu"
+    "naneninonu" "papepipopu" "rareriroru" "sasesisosu" "tatetitotu"
+    "vavevivovu" "wawewiwowu" "yayeyiyoyu" "zazezizozu";
+constexpr uint32_t SYLLABLE_COUNT = (sizeof(SYLLABLES) - 1) / 2;
+static_assert(SYLLABLE_COUNT == 95, "syllable table must hold two-byte entries");
+
+// Capitalize with probability 1/3; append a digit with probability 1/4,
+// i.e. values 0-9 of 40
+constexpr uint32_t CAPITAL_CHOICES = 3;
+constexpr uint32_t NUMBER_CHOICES = 40;
+
+} // namespace
+
 class PronounceablePasswordStrategy::Impl {
 public:
     std::unique_ptr<core::interfaces::IRandomGenerator> rng;
     bool includeNumbers = true;
     bool includeCapitals = true;
     
-    const std::vector<std::string> syllables = {
-        "ba", "be", "bi", "bo", "bu", "ca", "ce", "ci", "co", "cu",
-        "da", "de", "di", "do", "du", "fa", "fe", "fi", "fo", "fu",
-        "ga", "ge", "gi", "go", "gu", "ha", "he", "hi", "ho", "hu",
-        "ja", "je", "ji", "jo", "ju", "ka", "ke", "ki", "ko", "ku",
-        "la", "le", "li", "lo", "lu", "ma", "me", "mi", "mo", "mu",
-        "na", "ne", "ni", "no", "nu", "pa", "pe", "pi", "po", "pu",
-        "ra", "re", "ri", "ro", "ru", "sa", "se", "si", "so", "su",
-        "ta", "te", "ti", "to", "tu", "va", "ve", "vi", "vo", "vu",
-        "wa", "we", "wi", "wo", "wu", "ya", "ye", "yi", "yo", "yu",
-        "za", "ze", "zi", "zo", "zu"
-    };
-    
     Impl(std::unique_ptr<core::interfaces::IRandomGenerator> randomGen)
         : rng(randomGen ? std::move(randomGen) 
-              : std::make_unique<utils::SecureRandomGenerator>()) {}
+              : std::make_unique<utils::ThreadLocalRandomGenerator>()) {}
+    
+    uint32_t capitalChoices() const {
+        return includeCapitals ? CAPITAL_CHOICES : 1;
+    }
+    
+    uint32_t numberChoices() const {
+        return includeNumbers ? NUMBER_CHOICES : 1;
+    }
+    
+    // Each step writes a syllable and maybe a digit, at least two characters
+    // until the last, so ceil(length / 2) steps suffice
+    static size_t stepsFor(size_t length) {
+        return (length + 1) / 2;
+    }
+    
+    // A step's decisions are one draw from the product of their ranges
+    uint32_t stepBound() const {
+        return SYLLABLE_COUNT * capitalChoices() * numberChoices();
+    }
+    
+    void emit(const uint32_t* draws, size_t length, char* out) const {
+        const uint32_t capitals = capitalChoices();
+        size_t position = 0;
+        for (size_t i = 0; position < length; ++i) {
+            uint32_t value = draws[i];
+            const char* syllable = SYLLABLES + 2 * (value % SYLLABLE_COUNT);
+            value /= SYLLABLE_COUNT;
+            const bool capital = includeCapitals && value % capitals == 0;
+            value /= capitals;
+            
+            out[position++] = capital ? static_cast<char>(syllable[0] - 'a' + 'A') : syllable[0];
+            if (position < length) {
+                out[position++] = syllable[1];
+            }
+            if (includeNumbers && value < 10 && position < length) {
+                out[position++] = static_cast<char>('0' + value);
+            }
+        }
+    }
 };
 
 PronounceablePasswordStrategy::PronounceablePasswordStrategy(
@@ -44,36 +87,35 @@ void PronounceablePasswordStrategy::setIncludeCapitals(bool include) {
     pImpl->includeCapitals = include;
 }
 
-std::string PronounceablePasswordStrategy::generate(size_t length) {
-    std::string password;
-    
-    while (password.length() < length) {
-        // Add syllable
-        const std::string& syllable = 
-            pImpl->syllables[pImpl->rng->generate(0, pImpl->syllables.size() - 1)];
-        password += syllable;
-        
-        // Randomly capitalize
-        if (pImpl->includeCapitals && pImpl->rng->generate(0, 2) == 0 && 
-            password.length() >= 2) {
-            password[password.length() - 2] = 
-                std::toupper(password[password.length() - 2]);
-        }
-        
-        // Occasionally add number
-        if (pImpl->includeNumbers && pImpl->rng->generate(0, 3) == 0 && 
-            password.length() < length) {
-            password += std::to_string(pImpl->rng->generate(0, 9));
-        }
+void PronounceablePasswordStrategy::generateInto(char* out, size_t length) {
+    const size_t steps = Impl::stepsFor(length);
+    utils::DrawBuffer draws(steps);
+    for (size_t i = 0; i < steps; ++i) {
+        draws[i] = pImpl->stepBound();
     }
-    
-    // Trim to exact length
-    if (password.length() > length) {
-        password = password.substr(0, length);
+    draws.draw(*pImpl->rng);
+    pImpl->emit(draws.data(), length, out);
+}
+
+void PronounceablePasswordStrategy::generateBatch(char* out, size_t count, size_t length) {
+    const size_t steps = Impl::stepsFor(length);
+    if (count == 0 || steps == 0) {
+        return;
     }
     
-    return password;
+    // Every step of every password shares one bound, so a chunk of
+    // passwords is a single run of indices
+    const size_t chunk = batchChunk(steps, count);
+    const uint32_t bound = pImpl->stepBound();
+    utils::DrawBuffer draws(chunk * steps);
+    for (size_t done = 0; done < count; done += chunk) {
+        const size_t n = chunk < count - done ? chunk : count - done;
+        utils::generateIndices(*pImpl->rng, draws.data(), n * steps, bound);
+        for (size_t i = 0; i < n; ++i) {
+            pImpl->emit(draws.data() + i * steps, length, out + (done + i) * length);
+        }
+    }
 }
 
 } // namespace strategies
-} // namespace password_generator
\ No newline at end of file
+} // namespace password_generator
@@ -0,0 +1,560 @@
+#include "strategies/RegexDfa.h"
+#include <algorithm>
+#include <list>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace password_generator {
+namespace strategies {
+
+namespace {
+
+constexpr int FIRST_PRINTABLE = 0x20;
+constexpr int LAST_PRINTABLE = 0x7e;
+constexpr size_t MAX_NFA_STATES = 100000;
+constexpr size_t CACHE_CAPACITY = 64;
+
+// Set of printable ASCII characters
+struct CharSet {
+    uint64_t bits[2] = {0, 0};
+
+    void add(int c) { bits[c >> 6] |= uint64_t(1) << (c & 63); }
+    bool has(int c) const { return (bits[c >> 6] >> (c & 63)) & 1; }
+    bool empty() const { return bits[0] == 0 && bits[1] == 0; }
+
+    void addRange(int first, int last) {
+        for (int c = first; c <= last; ++c) {
+            add(c);
+        }
+    }
+
+    static CharSet printable() {
+        CharSet set;
+        set.addRange(FIRST_PRINTABLE, LAST_PRINTABLE);
+        return set;
+    }
+
+    CharSet complement() const {
+        CharSet all = printable();
+        all.bits[0] &= ~bits[0];
+        all.bits[1] &= ~bits[1];
+        return all;
+    }
+
+    friend bool operator<(const CharSet& a, const CharSet& b) {
+        return a.bits[1] != b.bits[1] ? a.bits[1] < b.bits[1] : a.bits[0] < b.bits[0];
+    }
+};
+
+struct Node {
+    enum class Kind { Set, Concat, Alternate, Repeat, Empty };
+    Kind kind;
+    CharSet set;
+    std::vector<std::unique_ptr<Node>> children;
+    size_t min = 0;
+    size_t max = 0;   // SIZE_MAX for unbounded
+};
+
+constexpr size_t UNBOUNDED = static_cast<size_t>(-1);
+
+class Parser {
+public:
+    explicit Parser(const std::string& pattern) : text_(pattern), pos_(0) {
+        if (!text_.empty() && text_.front() == '^') {
+            ++pos_;
+        }
+        if (text_.size() > pos_ && text_.back() == '$' &&
+            (text_.size() < 2 || text_[text_.size() - 2] != '\\')) {
+            text_.pop_back();
+        }
+    }
+
+    std::unique_ptr<Node> parse() {
+        auto node = parseAlternation();
+        if (pos_ != text_.size()) {
+            fail("Unexpected ')'");
+        }
+        return node;
+    }
+
+private:
+    [[noreturn]] void fail(const std::string& message) const {
+        throw std::invalid_argument("Regex error at position " + std::to_string(pos_) + ": " + message);
+    }
+
+    bool atEnd() const { return pos_ >= text_.size(); }
+    char peek() const { return text_[pos_]; }
+
+    std::unique_ptr<Node> parseAlternation() {
+        auto first = parseConcat();
+        if (atEnd() || peek() != '|') {
+            return first;
+        }
+        auto node = std::make_unique<Node>();
+        node->kind = Node::Kind::Alternate;
+        node->children.push_back(std::move(first));
+        while (!atEnd() && peek() == '|') {
+            ++pos_;
+            node->children.push_back(parseConcat());
+        }
+        return node;
+    }
+
+    std::unique_ptr<Node> parseConcat() {
+        auto node = std::make_unique<Node>();
+        node->kind = Node::Kind::Concat;
+        while (!atEnd() && peek() != '|' && peek() != ')') {
+            node->children.push_back(parseRepeat());
+        }
+        if (node->children.empty()) {
+            node->kind = Node::Kind::Empty;
+        }
+        return node;
+    }
+
+    std::unique_ptr<Node> parseRepeat() {
+        auto atom = parseAtom();
+        while (!atEnd()) {
+            size_t min, max;
+            char c = peek();
+            if (c == '*') {
+                min = 0; max = UNBOUNDED; ++pos_;
+            } else if (c == '+') {
+                min = 1; max = UNBOUNDED; ++pos_;
+            } else if (c == '?') {
+                min = 0; max = 1; ++pos_;
+            } else if (c == '{') {
+                parseBounds(min, max);
+            } else {
+                break;
+            }
+            auto repeat = std::make_unique<Node>();
+            repeat->kind = Node::Kind::Repeat;
+            repeat->min = min;
+            repeat->max = max;
+            repeat->children.push_back(std::move(atom));
+            atom = std::move(repeat);
+        }
+        return atom;
+    }
+
+    size_t parseNumber() {
+        size_t start = pos_;
+        size_t value = 0;
+        while (!atEnd() && peek() >= '0' && peek() <= '9') {
+            value = value * 10 + static_cast<size_t>(peek() - '0');
+            if (value > RegexDfa::MAX_REPEAT) {
+                fail("Repeat count too large");
+            }
+            ++pos_;
+        }
+        if (pos_ == start) {
+            fail("Expected a number");
+        }
+        return value;
+    }
+
+    void parseBounds(size_t& min, size_t& max) {
+        ++pos_;
+        min = parseNumber();
+        max = min;
+        if (!atEnd() && peek() == ',') {
+            ++pos_;
+            max = (!atEnd() && peek() == '}') ? UNBOUNDED : parseNumber();
+        }
+        if (atEnd() || peek() != '}') {
+            fail("Expected '}'");
+        }
+        ++pos_;
+        if (max < min) {
+            fail("Repeat bounds out of order");
+        }
+    }
+
+    static std::unique_ptr<Node> setNode(const CharSet& set) {
+        auto node = std::make_unique<Node>();
+        node->kind = Node::Kind::Set;
+        node->set = set;
+        return node;
+    }
+
+    static int checkPrintable(char c, const Parser& parser) {
+        int value = static_cast<unsigned char>(c);
+        if (value < FIRST_PRINTABLE || value > LAST_PRINTABLE) {
+            parser.fail("Only printable ASCII characters are supported");
+        }
+        return value;
+    }
+
+    // Escape after the backslash: shorthand class or literal
+    CharSet parseEscape() {
+        if (atEnd()) {
+            fail("Expression ends with '\\'");
+        }
+        char c = text_[pos_++];
+        CharSet set;
+        switch (c) {
+            case 'd':
+                set.addRange('0', '9');
+                break;
+            case 'w':
+                set.addRange('a', 'z');
+                set.addRange('A', 'Z');
+                set.addRange('0', '9');
+                set.add('_');
+                break;
+            case 's':
+                set.add(' ');
+                break;
+            default:
+                set.add(checkPrintable(c, *this));
+                break;
+        }
+        return set;
+    }
+
+    CharSet parseClass() {
+        bool negate = false;
+        if (!atEnd() && peek() == '^') {
+            negate = true;
+            ++pos_;
+        }
+        CharSet set;
+        bool first = true;
+        while (!atEnd() && (peek() != ']' || first)) {
+            first = false;
+            int low;
+            if (peek() == '\\') {
+                ++pos_;
+                CharSet escaped = parseEscape();
+                // Shorthands such as \d cannot start a range
+                int count = 0;
+                for (int c = FIRST_PRINTABLE; c <= LAST_PRINTABLE; ++c) {
+                    count += escaped.has(c);
+                }
+                if (count != 1) {
+                    set.bits[0] |= escaped.bits[0];
+                    set.bits[1] |= escaped.bits[1];
+                    continue;
+                }
+                low = static_cast<unsigned char>(text_[pos_ - 1]);
+            } else {
+                low = checkPrintable(text_[pos_++], *this);
+            }
+
+            if (pos_ + 1 < text_.size() && peek() == '-' && text_[pos_ + 1] != ']') {
+                ++pos_;
+                int high;
+                if (peek() == '\\') {
+                    ++pos_;
+                    if (atEnd()) {
+                        fail("Expression ends with '\\'");
+                    }
+                    high = checkPrintable(text_[pos_++], *this);
+                } else {
+                    high = checkPrintable(text_[pos_++], *this);
+                }
+                if (high < low) {
+                    fail("Reversed range in character class");
+                }
+                set.addRange(low, high);
+            } else {
+                set.add(low);
+            }
+        }
+        if (atEnd()) {
+            fail("Unterminated character class");
+        }
+        ++pos_;
+        if (negate) {
+            set = set.complement();
+        }
+        if (set.empty()) {
+            fail("Empty character class");
+        }
+        return set;
+    }
+
+    std::unique_ptr<Node> parseAtom() {
+        char c = text_[pos_++];
+        switch (c) {
+            case '(': {
+                if (text_.compare(pos_, 2, "?:") == 0) {
+                    pos_ += 2;
+                }
+                auto inner = parseAlternation();
+                if (atEnd() || peek() != ')') {
+                    fail("Expected ')'");
+                }
+                ++pos_;
+                return inner;
+            }
+            case '[':
+                return setNode(parseClass());
+            case '.':
+                return setNode(CharSet::printable());
+            case '\\':
+                return setNode(parseEscape());
+            case '*':
+            case '+':
+            case '?':
+            case '{':
+                --pos_;
+                fail("Quantifier without a preceding expression");
+            default: {
+                CharSet set;
+                set.add(checkPrintable(c, *this));
+                return setNode(set);
+            }
+        }
+    }
+
+    std::string text_;
+    size_t pos_;
+};
+
+// Thompson NFA: each state has character edges and epsilon edges
+struct Nfa {
+    struct State {
+        std::vector<std::pair<CharSet, int>> edges;
+        std::vector<int> epsilon;
+    };
+    std::vector<State> states;
+
+    int add() {
+        if (states.size() >= MAX_NFA_STATES) {
+            throw std::invalid_argument("Regex is too large");
+        }
+        states.emplace_back();
+        return static_cast<int>(states.size() - 1);
+    }
+};
+
+struct Fragment {
+    int start;
+    int end;
+};
+
+Fragment build(Nfa& nfa, const Node& node) {
+    switch (node.kind) {
+        case Node::Kind::Empty: {
+            int s = nfa.add();
+            return {s, s};
+        }
+        case Node::Kind::Set: {
+            int s = nfa.add();
+            int e = nfa.add();
+            nfa.states[s].edges.emplace_back(node.set, e);
+            return {s, e};
+        }
+        case Node::Kind::Concat: {
+            Fragment result = build(nfa, *node.children[0]);
+            for (size_t i = 1; i < node.children.size(); ++i) {
+                Fragment next = build(nfa, *node.children[i]);
+                nfa.states[result.end].epsilon.push_back(next.start);
+                result.end = next.end;
+            }
+            return result;
+        }
+        case Node::Kind::Alternate: {
+            int s = nfa.add();
+            int e = nfa.add();
+            for (const auto& child : node.children) {
+                Fragment branch = build(nfa, *child);
+                nfa.states[s].epsilon.push_back(branch.start);
+                nfa.states[branch.end].epsilon.push_back(e);
+            }
+            return {s, e};
+        }
+        case Node::Kind::Repeat: {
+            // Required copies, then optional copies (or a loop if unbounded)
+            int s = nfa.add();
+            int current = s;
+            for (size_t i = 0; i < node.min; ++i) {
+                Fragment copy = build(nfa, *node.children[0]);
+                nfa.states[current].epsilon.push_back(copy.start);
+                current = copy.end;
+            }
+            int e = nfa.add();
+            if (node.max == UNBOUNDED) {
+                Fragment loop = build(nfa, *node.children[0]);
+                nfa.states[current].epsilon.push_back(loop.start);
+                nfa.states[loop.end].epsilon.push_back(loop.start);
+                nfa.states[loop.end].epsilon.push_back(e);
+            } else {
+                for (size_t i = node.min; i < node.max; ++i) {
+                    Fragment copy = build(nfa, *node.children[0]);
+                    nfa.states[current].epsilon.push_back(copy.start);
+                    nfa.states[current].epsilon.push_back(e);
+                    current = copy.end;
+                }
+            }
+            nfa.states[current].epsilon.push_back(e);
+            return {s, e};
+        }
+    }
+    throw std::logic_error("Unknown regex node");
+}
+
+void closure(const Nfa& nfa, std::vector<int>& set) {
+    std::vector<bool> seen(nfa.states.size(), false);
+    std::vector<int> stack(set);
+    for (int s : set) {
+        seen[s] = true;
+    }
+    while (!stack.empty()) {
+        int s = stack.back();
+        stack.pop_back();
+        for (int t : nfa.states[s].epsilon) {
+            if (!seen[t]) {
+                seen[t] = true;
+                set.push_back(t);
+                stack.push_back(t);
+            }
+        }
+    }
+    std::sort(set.begin(), set.end());
+}
+
+} // namespace
+
+std::shared_ptr<const RegexDfa> RegexDfa::compile(const std::string& pattern) {
+    std::unique_ptr<Node> ast = Parser(pattern).parse();
+
+    Nfa nfa;
+    Fragment whole = build(nfa, *ast);
+
+    // Split the alphabet into classes that every edge either fully
+    // contains or fully excludes
+    std::vector<CharSet> classes = {CharSet::printable()};
+    std::map<CharSet, bool> distinctSets;
+    for (const auto& state : nfa.states) {
+        for (const auto& edge : state.edges) {
+            distinctSets[edge.first] = true;
+        }
+    }
+    for (const auto& entry : distinctSets) {
+        const CharSet& splitter = entry.first;
+        std::vector<CharSet> refined;
+        for (const CharSet& cls : classes) {
+            CharSet inside, outside;
+            for (int c = FIRST_PRINTABLE; c <= LAST_PRINTABLE; ++c) {
+                if (cls.has(c)) {
+                    (splitter.has(c) ? inside : outside).add(c);
+                }
+            }
+            if (!inside.empty()) refined.push_back(inside);
+            if (!outside.empty()) refined.push_back(outside);
+        }
+        classes = std::move(refined);
+    }
+
+    auto dfa = std::make_shared<RegexDfa>();
+    dfa->classOf_.assign(256, 0xff);
+    for (size_t i = 0; i < classes.size(); ++i) {
+        std::string members;
+        for (int c = FIRST_PRINTABLE; c <= LAST_PRINTABLE; ++c) {
+            if (classes[i].has(c)) {
+                members.push_back(static_cast<char>(c));
+                dfa->classOf_[c] = static_cast<uint8_t>(i);
+            }
+        }
+        dfa->classes_.push_back(std::move(members));
+    }
+
+    // Subset construction; transitions into the empty set stay -1
+    std::map<std::vector<int>, int> ids;
+    std::vector<std::vector<int>> pending;
+    std::vector<int> startSet = {whole.start};
+    closure(nfa, startSet);
+    ids[startSet] = 0;
+    pending.push_back(startSet);
+
+    for (size_t index = 0; index < pending.size(); ++index) {
+        const std::vector<int> current = pending[index];
+        dfa->accepting_.push_back(std::binary_search(current.begin(), current.end(), whole.end));
+
+        for (size_t cls = 0; cls < classes.size(); ++cls) {
+            int representative = static_cast<unsigned char>(dfa->classes_[cls][0]);
+            std::vector<int> next;
+            for (int s : current) {
+                for (const auto& edge : nfa.states[s].edges) {
+                    if (edge.first.has(representative)) {
+                        next.push_back(edge.second);
+                    }
+                }
+            }
+            if (next.empty()) {
+                dfa->transitions_.push_back(-1);
+                continue;
+            }
+            std::sort(next.begin(), next.end());
+            next.erase(std::unique(next.begin(), next.end()), next.end());
+            closure(nfa, next);
+
+            auto found = ids.find(next);
+            if (found == ids.end()) {
+                if (pending.size() >= MAX_STATES) {
+                    throw std::invalid_argument("Regex needs more than " +
+                                                std::to_string(MAX_STATES) + " DFA states");
+                }
+                found = ids.emplace(next, static_cast<int>(pending.size())).first;
+                pending.push_back(next);
+            }
+            dfa->transitions_.push_back(found->second);
+        }
+    }
+    return dfa;
+}
+
+std::shared_ptr<const RegexDfa> RegexDfa::compileCached(const std::string& pattern) {
+    // Least recently used entries are evicted once the cache is full
+    static std::mutex mutex;
+    static std::list<std::pair<std::string, std::shared_ptr<const RegexDfa>>> entries;
+    static std::unordered_map<std::string, decltype(entries)::iterator> index;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = index.find(pattern);
+        if (found != index.end()) {
+            entries.splice(entries.begin(), entries, found->second);
+            return found->second->second;
+        }
+    }
+
+    // Compile outside the lock; a concurrent miss just compiles twice
+    std::shared_ptr<const RegexDfa> dfa = compile(pattern);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto found = index.find(pattern);
+    if (found != index.end()) {
+        return found->second->second;
+    }
+    entries.emplace_front(pattern, dfa);
+    index[pattern] = entries.begin();
+    if (entries.size() > CACHE_CAPACITY) {
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+    return dfa;
+}
+
+bool RegexDfa::matches(const std::string& text) const {
+    int state = startState();
+    for (char c : text) {
+        uint8_t cls = classOf_[static_cast<unsigned char>(c)];
+        if (cls == 0xff) {
+            return false;
+        }
+        state = transition(state, cls);
+        if (state < 0) {
+            return false;
+        }
+    }
+    return isAccepting(state);
+}
+
+} // namespace strategies
+} // namespace password_generator
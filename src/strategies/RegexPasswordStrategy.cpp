@@ -0,0 +1,125 @@
+#include "strategies/RegexPasswordStrategy.h"
+#include "utils/ThreadLocalRandomGenerator.h"
+#include "utils/UniformRank.h"
+#include <stdexcept>
+#include <vector>
+
+namespace password_generator {
+namespace strategies {
+
+class RegexPasswordStrategy::Impl {
+public:
+    std::string regex;
+    std::shared_ptr<const RegexDfa> dfa;
+    std::unique_ptr<core::interfaces::IRandomGenerator> rng;
+
+    // counts[k][s]: strings of length k accepted from state s
+    std::vector<std::vector<utils::BigUint>> counts;
+
+    Impl(const std::string& re, std::unique_ptr<core::interfaces::IRandomGenerator> randomGen)
+        : regex(re), dfa(RegexDfa::compileCached(re)),
+          rng(randomGen ? std::move(randomGen)
+              : std::make_unique<utils::ThreadLocalRandomGenerator>()) {}
+
+    void extendCounts(size_t length) {
+        const size_t states = dfa->stateCount();
+        if (counts.empty()) {
+            counts.emplace_back(states);
+            for (size_t s = 0; s < states; ++s) {
+                if (dfa->isAccepting(static_cast<int>(s))) {
+                    counts[0][s] = utils::BigUint(1);
+                }
+            }
+        }
+        while (counts.size() <= length) {
+            const std::vector<utils::BigUint>& previous = counts.back();
+            std::vector<utils::BigUint> layer(states);
+            for (size_t s = 0; s < states; ++s) {
+                for (size_t c = 0; c < dfa->classCount(); ++c) {
+                    int target = dfa->transition(static_cast<int>(s), c);
+                    if (target >= 0 && !previous[target].isZero()) {
+                        utils::BigUint weight = previous[target];
+                        weight *= static_cast<uint32_t>(dfa->classMembers(c).size());
+                        layer[s] += weight;
+                    }
+                }
+            }
+            counts.push_back(std::move(layer));
+        }
+    }
+};
+
+RegexPasswordStrategy::RegexPasswordStrategy(
+    const std::string& regex,
+    std::unique_ptr<core::interfaces::IRandomGenerator> randomGen)
+    : pImpl(std::make_unique<Impl>(regex, std::move(randomGen))) {}
+
+RegexPasswordStrategy::~RegexPasswordStrategy() = default;
+
+void RegexPasswordStrategy::setRegex(const std::string& regex) {
+    std::shared_ptr<const RegexDfa> dfa = RegexDfa::compileCached(regex);
+    pImpl->dfa = std::move(dfa);
+    pImpl->regex = regex;
+    pImpl->counts.clear();
+}
+
+const std::string& RegexPasswordStrategy::getRegex() const {
+    return pImpl->regex;
+}
+
+const RegexDfa& RegexPasswordStrategy::getDfa() const {
+    return *pImpl->dfa;
+}
+
+utils::BigUint RegexPasswordStrategy::getKeyspace(size_t length) {
+    pImpl->extendCounts(length);
+    return pImpl->counts[length][pImpl->dfa->startState()];
+}
+
+double RegexPasswordStrategy::getEntropyBits(size_t length) {
+    return getKeyspace(length).log2();
+}
+
+std::string RegexPasswordStrategy::generate(size_t length) {
+    pImpl->extendCounts(length);
+    const RegexDfa& dfa = *pImpl->dfa;
+    int state = dfa.startState();
+    const utils::BigUint& total = pImpl->counts[length][state];
+    if (total.isZero()) {
+        throw std::runtime_error("No string of length " + std::to_string(length) +
+                                 " matches the expression");
+    }
+
+    // rank indexes the matching strings in (class, member, suffix) order;
+    // each step peels off one character and keeps the suffix rank
+    utils::BigUint rank = utils::drawBelow(*pImpl->rng, total);
+    std::string password(length, '\0');
+    for (size_t position = 0; position < length; ++position) {
+        const std::vector<utils::BigUint>& next = pImpl->counts[length - position - 1];
+        for (size_t c = 0; c < dfa.classCount(); ++c) {
+            int target = dfa.transition(state, c);
+            if (target < 0 || next[target].isZero()) {
+                continue;
+            }
+            const std::string& members = dfa.classMembers(c);
+            utils::BigUint weight = next[target];
+            weight *= static_cast<uint32_t>(members.size());
+            if (rank >= weight) {
+                rank -= weight;
+                continue;
+            }
+            uint32_t index = utils::quotientBelow(rank, next[target],
+                                                  static_cast<uint32_t>(members.size()));
+            utils::BigUint offset = next[target];
+            offset *= index;
+            rank -= offset;
+            password[position] = members[index];
+            state = target;
+            break;
+        }
+    }
+    return password;
+}
+
+} // namespace strategies
+} // namespace password_generator
@@ -1,19 +1,199 @@
 #include "strategies/StandardPasswordStrategy.h"
-#include "utils/SecureRandomGenerator.h"
+#include "utils/ThreadLocalRandomGenerator.h"
+#include "utils/BulkRandomGenerator.h"
+#include "utils/AlphabetPlan.h"
+#include "utils/AliasTable.h"
+#include <cmath>
 #include <stdexcept>
 #include <algorithm>
+#include <cstring>
+#include <utility>
 
 namespace password_generator {
 namespace strategies {
 
+namespace {
+
+// Placements tried before a sequence-rule config is declared unsatisfiable
+constexpr size_t MAX_PLACEMENT_ATTEMPTS = 1000;
+
+} // namespace
+
 class StandardPasswordStrategy::Impl {
 public:
     std::vector<std::unique_ptr<core::interfaces::ICharacterSetProvider>> providers;
+    std::vector<double> weights;
     std::unique_ptr<core::interfaces::IRandomGenerator> rng;
+    utils::AlphabetPlan plan;
+    utils::CharacterFilter filter;
+    
+    // Weighted draws over the merged alphabet; null while all weights are equal
+    std::shared_ptr<const utils::AliasTable> alias;
     
     Impl(std::unique_ptr<core::interfaces::IRandomGenerator> randomGen)
         : rng(randomGen ? std::move(randomGen) 
-              : std::make_unique<utils::SecureRandomGenerator>()) {}
+              : std::make_unique<utils::ThreadLocalRandomGenerator>()) {}
+    
+    void rebuild() {
+        plan.build(providers, &filter);
+        alias.reset();
+        bool uniform = true;
+        for (double weight : weights) {
+            uniform = uniform && weight == weights.front();
+        }
+        if (uniform || plan.empty()) {
+            return;
+        }
+        std::vector<double> perCharacter(plan.mergedSize());
+        for (size_t i = 0; i < perCharacter.size(); ++i) {
+            perCharacter[i] = weights[plan.mergedOrigin(i)];
+        }
+        alias = std::make_shared<const utils::AliasTable>(perCharacter);
+    }
+    
+    // Draws below `required` are guaranteed set characters, the rest fill
+    char pick(size_t source, size_t required, uint32_t draw) const {
+        if (source < required) {
+            return plan.set(source)[draw];
+        }
+        return plan.merged()[alias ? alias->sample(draw) : draw];
+    }
+    
+    /**
+     * @brief Throw if no password of this length can be generated
+     */
+    void checkGenerate(size_t length) const {
+        if (providers.empty()) {
+            throw std::runtime_error("No character sets configured");
+        }
+        if (plan.empty()) {
+            throw std::runtime_error("No characters available for generation");
+        }
+        if (filter.getNoAdjacentRepeat() && length > 1 && plan.mergedSize() < 2) {
+            throw std::runtime_error("No adjacent repeats needs at least two characters");
+        }
+        const size_t maxRepeat = filter.getMaxRepeat();
+        if (maxRepeat > 0 && length / maxRepeat + (length % maxRepeat != 0) > plan.mergedSize()) {
+            throw std::runtime_error("Too few characters for length " + std::to_string(length) +
+                                     " with at most " + std::to_string(maxRepeat) + " repeats");
+        }
+    }
+    
+    // Every draw a password needs: one per required set, one per remaining
+    // position, then the Fisher-Yates swaps. Returns the number written.
+    size_t fillBounds(uint32_t* draws, size_t length, size_t required) const {
+        const size_t swaps = length > 0 ? length - 1 : 0;
+        for (size_t i = 0; i < required; ++i) {
+            draws[i] = plan.setSize(i);
+        }
+        const uint32_t fillBound = alias ? alias->drawBound() : plan.mergedSize();
+        for (size_t i = required; i < length; ++i) {
+            draws[i] = fillBound;
+        }
+        for (size_t k = 0; k < swaps; ++k) {
+            draws[length + k] = static_cast<uint32_t>(length - k);
+        }
+        return length + swaps;
+    }
+    
+    void emit(const uint32_t* draws, size_t length, size_t required, char* out) {
+        if (filter.hasSequenceRules()) {
+            emitTracked(draws, length, required, out);
+            return;
+        }
+        
+        // Ensure at least one character from each set
+        for (size_t i = 0; i < required; ++i) {
+            out[i] = plan.set(i)[draws[i]];
+        }
+        
+        // Fill remaining with random characters
+        const utils::CharacterTable& merged = plan.merged();
+        if (alias) {
+            for (size_t i = required; i < length; ++i) {
+                out[i] = merged[alias->sample(draws[i])];
+            }
+        } else {
+            for (size_t i = required; i < length; ++i) {
+                out[i] = merged[draws[i]];
+            }
+        }
+        
+        // Shuffle for better randomness
+        const size_t swaps = length > 0 ? length - 1 : 0;
+        for (size_t k = 0; k < swaps; ++k) {
+            std::swap(out[length - 1 - k], out[draws[length + k]]);
+        }
+    }
+    
+    // Uses the draws of the unfiltered path. A placement that gets stuck
+    // is retried with fresh draws; checkGenerate() rules out the configs
+    // where every placement does.
+    void emitTracked(const uint32_t* draws, size_t length, size_t required, char* out) {
+        if (placeTracked(draws, length, required, out)) {
+            return;
+        }
+        utils::DrawBuffer retry(length + (length > 0 ? length - 1 : 0));
+        for (size_t attempt = 1; attempt < MAX_PLACEMENT_ATTEMPTS; ++attempt) {
+            fillBounds(retry.data(), length, required);
+            retry.draw(*rng);
+            if (placeTracked(retry.data(), length, required, out)) {
+                return;
+            }
+        }
+        throw std::runtime_error("Character filters leave no valid password of length " +
+                                 std::to_string(length));
+    }
+    
+    // Resolves the shuffle first so every source knows its final position.
+    // The guaranteed set characters are placed before any fill, so a fill
+    // can never take the last character a set had left; fills then go left
+    // to right around them. A rejected character is redrawn from the same
+    // source. Returns false if some position has no allowed character.
+    bool placeTracked(const uint32_t* draws, size_t length, size_t required, char* out) {
+        const size_t swaps = length > 0 ? length - 1 : 0;
+        utils::DrawBuffer order(length);
+        for (size_t i = 0; i < length; ++i) {
+            order[i] = static_cast<uint32_t>(i);
+        }
+        for (size_t k = 0; k < swaps; ++k) {
+            std::swap(order[length - 1 - k], order[draws[length + k]]);
+        }
+        
+        // Unwritten positions hold '\0', which no alphabet contains
+        std::memset(out, 0, length);
+        utils::CharacterFilter::Tracker tracker(filter);
+        for (bool guaranteed : {true, false}) {
+            for (size_t j = 0; j < length; ++j) {
+                const size_t source = order[j];
+                if ((source < required) != guaranteed) {
+                    continue;
+                }
+                char c = pick(source, required, draws[source]);
+                if (!tracker.allowsAt(out, length, j, c)) {
+                    const utils::CharacterTable& table =
+                        source < required ? plan.set(source) : plan.merged();
+                    bool available = false;
+                    for (char candidate : table.characters()) {
+                        available = available || tracker.allowsAt(out, length, j, candidate);
+                    }
+                    if (!available) {
+                        return false;
+                    }
+                    const uint32_t bound = source < required ? plan.setSize(source)
+                        : alias ? alias->drawBound() : plan.mergedSize();
+                    do {
+                        uint32_t draw = bound;
+                        utils::generateBounded(*rng, &draw, 1);
+                        c = pick(source, required, draw);
+                    } while (!tracker.allowsAt(out, length, j, c));
+                }
+                tracker.place(c);
+                out[j] = c;
+            }
+        }
+        return true;
+    }
 };
 
 StandardPasswordStrategy::StandardPasswordStrategy(
@@ -23,54 +203,89 @@ StandardPasswordStrategy::StandardPasswordStrategy(
 StandardPasswordStrategy::~StandardPasswordStrategy() = default;
 
 void StandardPasswordStrategy::addCharacterSet(
-    std::unique_ptr<core::interfaces::ICharacterSetProvider> provider) {
+    std::unique_ptr<core::interfaces::ICharacterSetProvider> provider, double weight) {
+    if (!(weight > 0.0) || !std::isfinite(weight)) {
+        throw std::invalid_argument("Character set weight must be positive and finite");
+    }
     pImpl->providers.push_back(std::move(provider));
+    pImpl->weights.push_back(weight);
+    try {
+        pImpl->rebuild();
+    } catch (...) {
+        pImpl->providers.pop_back();
+        pImpl->weights.pop_back();
+        throw;
+    }
+}
+
+void StandardPasswordStrategy::setFilter(const utils::CharacterFilter& filter) {
+    utils::CharacterFilter previous = std::exchange(pImpl->filter, filter);
+    try {
+        pImpl->rebuild();
+    } catch (...) {
+        pImpl->filter = std::move(previous);
+        throw;
+    }
 }
 
 void StandardPasswordStrategy::clearCharacterSets() {
     pImpl->providers.clear();
+    pImpl->weights.clear();
+    pImpl->plan.clear();
+    pImpl->alias.reset();
 }
 
-std::string StandardPasswordStrategy::generate(size_t length) {
-    if (pImpl->providers.empty()) {
-        throw std::runtime_error("No character sets configured");
+double StandardPasswordStrategy::getEntropyBits(size_t length) const {
+    if (pImpl->plan.empty()) {
+        return 0.0;
     }
+    const double perCharacter = pImpl->alias
+        ? pImpl->alias->entropyBits()
+        : std::log2(static_cast<double>(pImpl->plan.mergedSize()));
+    return perCharacter * static_cast<double>(length);
+}
+
+void StandardPasswordStrategy::generateInto(char* out, size_t length) {
+    pImpl->checkGenerate(length);
     
-    // Combine all character sets
-    std::string allChars;
-    for (const auto& provider : pImpl->providers) {
-        allChars += provider->getCharacters();
-    }
+    // Every non-empty set contributes one guaranteed character, as long as
+    // the password has room for it
+    const size_t required = std::min(pImpl->plan.setCount(), length);
     
-    if (allChars.empty()) {
-        throw std::runtime_error("No characters available for generation");
+    // Describe every draw up front so all are served by a single call
+    utils::DrawBuffer draws(length + (length > 0 ? length - 1 : 0));
+    pImpl->fillBounds(draws.data(), length, required);
+    draws.draw(*pImpl->rng);
+    pImpl->emit(draws.data(), length, required, out);
+}
+
+void StandardPasswordStrategy::generateBatch(char* out, size_t count, size_t length) {
+    pImpl->checkGenerate(length);
+    if (count == 0 || length == 0) {
+        return;
     }
     
-    std::string password;
-    password.reserve(length);
+    // Every password has the same bounds, so they are laid out once and
+    // copied; a chunk of passwords then costs a single generator call
+    const size_t required = std::min(pImpl->plan.setCount(), length);
+    const size_t perPassword = 2 * length - 1;
+    const size_t chunk = batchChunk(perPassword, count);
+    utils::DrawBuffer bounds(perPassword);
+    pImpl->fillBounds(bounds.data(), length, required);
+    utils::DrawBuffer draws(chunk * perPassword);
     
-    // Ensure at least one character from each set
-    for (const auto& provider : pImpl->providers) {
-        if (password.length() < length) {
-            const std::string& chars = provider->getCharacters();
-            if (!chars.empty()) {
-                password += chars[pImpl->rng->generate(0, chars.length() - 1)];
-            }
+    for (size_t done = 0; done < count; done += chunk) {
+        const size_t n = std::min(chunk, count - done);
+        for (size_t i = 0; i < n; ++i) {
+            std::memcpy(draws.data() + i * perPassword, bounds.data(),
+                        perPassword * sizeof(uint32_t));
+        }
+        utils::generateBounded(*pImpl->rng, draws.data(), n * perPassword);
+        for (size_t i = 0; i < n; ++i) {
+            pImpl->emit(draws.data() + i * perPassword, length, required,
+                        out + (done + i) * length);
         }
     }
-    
-    // Fill remaining with random characters
-    while (password.length() < length) {
-        password += allChars[pImpl->rng->generate(0, allChars.length() - 1)];
-    }
-    
-    // Shuffle for better randomness
-    for (size_t i = password.length() - 1; i > 0; --i) {
-        size_t j = pImpl->rng->generate(0, i);
-        std::swap(password[i], password[j]);
-    }
-    
-    return password;
 }
 
 } // namespace strategies
@@ -0,0 +1,266 @@
+#include "strategies/TokenPasswordStrategy.h"
+#include "utils/AlphabetKernel.h"
+#include "utils/BulkRandomGenerator.h"
+#include "utils/Crc32.h"
+#include "utils/SecureMemory.h"
+#include "utils/ThreadLocalRandomGenerator.h"
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace password_generator {
+namespace strategies {
+
+namespace {
+
+// Fewest digits that hold any 32-bit CRC
+size_t checksumWidth(utils::TokenEncoding encoding) {
+    switch (encoding) {
+    case utils::TokenEncoding::Hex:
+        return 8;
+    case utils::TokenEncoding::Base32:
+        return 7;
+    case utils::TokenEncoding::Base58:
+    case utils::TokenEncoding::Base64Url:
+        return 6;
+    }
+    return 8;
+}
+
+const utils::AlphabetKernel& base58Kernel() {
+    static const utils::AlphabetKernel kernel(
+        utils::tokenAlphabet(utils::TokenEncoding::Base58));
+    return kernel;
+}
+
+} // namespace
+
+class TokenPasswordStrategy::Impl {
+public:
+    std::unique_ptr<core::interfaces::IRandomGenerator> rng;
+    utils::TokenEncoding encoding = utils::TokenEncoding::Hex;
+    size_t bytes = DEFAULT_BYTES;
+    std::string prefix;
+    Checksum checksum = Checksum::Crc32;
+
+    // Random bytes of the tokens being encoded; wiped after every use
+    std::vector<uint8_t> scratch;
+
+    explicit Impl(std::unique_ptr<core::interfaces::IRandomGenerator> randomGen)
+        : rng(randomGen ? std::move(randomGen)
+              : std::make_unique<utils::ThreadLocalRandomGenerator>()) {}
+
+    ~Impl() {
+        utils::secureWipe(scratch.data(), scratch.size());
+    }
+
+    size_t bodyLength() const {
+        return utils::encodedLength(encoding, bytes);
+    }
+
+    size_t checksumLength() const {
+        return checksum == Checksum::None ? 0 : checksumWidth(encoding);
+    }
+
+    size_t tokenLength() const {
+        return prefix.size() + bodyLength() + checksumLength();
+    }
+
+    uint32_t crcOf(const char* body, size_t length) const {
+        return checksum == Checksum::Crc32c ? utils::crc32c(body, length)
+                                            : utils::crc32(body, length);
+    }
+
+    void checkLength(size_t length) const {
+        if (length != tokenLength()) {
+            throw std::invalid_argument("Tokens of this configuration have length " +
+                                        std::to_string(tokenLength()));
+        }
+    }
+
+    // Write count tokens of stride characters; one bulk draw covers every body
+    void emit(char* out, size_t count, size_t stride) {
+        const size_t body = bodyLength();
+        if (encoding == utils::TokenEncoding::Base58) {
+            for (size_t i = 0; i < count; ++i) {
+                base58Kernel().fill(*rng, out + i * stride + prefix.size(), body);
+            }
+        } else {
+            const size_t needed = count * bytes;
+            if (scratch.size() < needed) {
+                utils::secureWipe(scratch.data(), scratch.size());
+                std::vector<uint8_t>(needed).swap(scratch);
+            }
+            utils::fillBytes(*rng, scratch.data(), needed);
+            for (size_t i = 0; i < count; ++i) {
+                const uint8_t* random = scratch.data() + i * bytes;
+                char* target = out + i * stride + prefix.size();
+                switch (encoding) {
+                case utils::TokenEncoding::Hex:
+                    utils::encodeHex(random, bytes, target);
+                    break;
+                case utils::TokenEncoding::Base32:
+                    utils::encodeBase32(random, bytes, target);
+                    break;
+                default:
+                    utils::encodeBase64Url(random, bytes, target);
+                    break;
+                }
+            }
+            utils::secureWipe(scratch.data(), needed);
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            char* token = out + i * stride;
+            std::memcpy(token, prefix.data(), prefix.size());
+            if (checksum != Checksum::None) {
+                char* bodyStart = token + prefix.size();
+                utils::encodeFixedWidth(encoding, crcOf(bodyStart, body), checksumLength(),
+                                        bodyStart + body);
+            }
+        }
+    }
+};
+
+TokenPasswordStrategy::TokenPasswordStrategy(
+    std::unique_ptr<core::interfaces::IRandomGenerator> randomGen)
+    : pImpl(std::make_unique<Impl>(std::move(randomGen))) {}
+
+TokenPasswordStrategy::~TokenPasswordStrategy() = default;
+
+void TokenPasswordStrategy::setEncoding(utils::TokenEncoding encoding) {
+    pImpl->encoding = encoding;
+}
+
+utils::TokenEncoding TokenPasswordStrategy::getEncoding() const {
+    return pImpl->encoding;
+}
+
+void TokenPasswordStrategy::setBytes(size_t bytes) {
+    if (bytes < MIN_BYTES || bytes > MAX_BYTES) {
+        throw std::invalid_argument("Token size must be between " + std::to_string(MIN_BYTES) +
+                                    " and " + std::to_string(MAX_BYTES) + " bytes");
+    }
+    pImpl->bytes = bytes;
+}
+
+size_t TokenPasswordStrategy::getBytes() const {
+    return pImpl->bytes;
+}
+
+void TokenPasswordStrategy::setPrefix(const std::string& prefix) {
+    if (prefix.size() > MAX_PREFIX) {
+        throw std::invalid_argument("Token prefix must be at most " +
+                                    std::to_string(MAX_PREFIX) + " characters");
+    }
+    for (char c : prefix) {
+        if (c <= ' ' || c > '~') {
+            throw std::invalid_argument("Token prefix must be printable ASCII without spaces");
+        }
+    }
+    pImpl->prefix = prefix;
+}
+
+const std::string& TokenPasswordStrategy::getPrefix() const {
+    return pImpl->prefix;
+}
+
+void TokenPasswordStrategy::setChecksum(Checksum checksum) {
+    pImpl->checksum = checksum;
+}
+
+TokenPasswordStrategy::Checksum TokenPasswordStrategy::getChecksum() const {
+    return pImpl->checksum;
+}
+
+utils::TokenEncoding TokenPasswordStrategy::parseEncoding(const std::string& name) {
+    if (name == "hex") {
+        return utils::TokenEncoding::Hex;
+    }
+    if (name == "base32") {
+        return utils::TokenEncoding::Base32;
+    }
+    if (name == "base58") {
+        return utils::TokenEncoding::Base58;
+    }
+    if (name == "base64url") {
+        return utils::TokenEncoding::Base64Url;
+    }
+    throw std::invalid_argument("Unknown token encoding '" + name +
+                                "' (use hex, base32, base58 or base64url)");
+}
+
+TokenPasswordStrategy::Checksum TokenPasswordStrategy::parseChecksum(const std::string& name) {
+    if (name == "crc32") {
+        return Checksum::Crc32;
+    }
+    if (name == "crc32c") {
+        return Checksum::Crc32c;
+    }
+    if (name == "none") {
+        return Checksum::None;
+    }
+    throw std::invalid_argument("Unknown checksum '" + name + "' (use crc32, crc32c or none)");
+}
+
+size_t TokenPasswordStrategy::bodyLength() const {
+    return pImpl->bodyLength();
+}
+
+size_t TokenPasswordStrategy::checksumLength() const {
+    return pImpl->checksumLength();
+}
+
+size_t TokenPasswordStrategy::tokenLength() const {
+    return pImpl->tokenLength();
+}
+
+double TokenPasswordStrategy::getEntropyBits() const {
+    if (pImpl->encoding == utils::TokenEncoding::Base58) {
+        return static_cast<double>(pImpl->bodyLength()) * std::log2(58.0);
+    }
+    return 8.0 * static_cast<double>(pImpl->bytes);
+}
+
+bool TokenPasswordStrategy::verifyChecksum(std::string_view token) const {
+    if (pImpl->checksum == Checksum::None || token.size() != pImpl->tokenLength() ||
+        token.substr(0, pImpl->prefix.size()) != pImpl->prefix) {
+        return false;
+    }
+    const std::string_view body = token.substr(pImpl->prefix.size(), pImpl->bodyLength());
+    bool valid[256] = {};
+    for (const char* c = utils::tokenAlphabet(pImpl->encoding); *c; ++c) {
+        valid[static_cast<unsigned char>(*c)] = true;
+    }
+    for (char c : body) {
+        if (!valid[static_cast<unsigned char>(c)]) {
+            return false;
+        }
+    }
+    uint64_t stored;
+    return utils::decodeFixedWidth(pImpl->encoding, body.data() + body.size(),
+                                   pImpl->checksumLength(), stored) &&
+           stored == pImpl->crcOf(body.data(), body.size());
+}
+
+std::string TokenPasswordStrategy::generateToken() {
+    return generate(pImpl->tokenLength());
+}
+
+void TokenPasswordStrategy::generateInto(char* out, size_t length) {
+    pImpl->checkLength(length);
+    pImpl->emit(out, 1, length);
+}
+
+void TokenPasswordStrategy::generateBatch(char* out, size_t count, size_t length) {
+    pImpl->checkLength(length);
+    const size_t chunk = batchChunk(pImpl->bytes, count);
+    for (size_t done = 0; done < count; done += chunk) {
+        const size_t n = count - done < chunk ? count - done : chunk;
+        pImpl->emit(out + done * length, n, length);
+    }
+}
+
+} // namespace strategies
+} // namespace password_generator
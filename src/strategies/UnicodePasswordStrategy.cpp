@@ -0,0 +1,165 @@
+#include "strategies/UnicodePasswordStrategy.h"
+#include "utils/BulkRandomGenerator.h"
+#include "utils/SecureMemory.h"
+#include "utils/ThreadLocalRandomGenerator.h"
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace password_generator {
+namespace strategies {
+
+namespace {
+
+using validators::CharacterTypeValidator;
+
+constexpr CharacterTypeValidator::Type TYPES[] = {
+    CharacterTypeValidator::UPPERCASE, CharacterTypeValidator::LOWERCASE,
+    CharacterTypeValidator::DIGIT, CharacterTypeValidator::SYMBOL};
+
+const char* typeName(CharacterTypeValidator::Type type) {
+    switch (type) {
+        case CharacterTypeValidator::UPPERCASE: return "uppercase";
+        case CharacterTypeValidator::LOWERCASE: return "lowercase";
+        case CharacterTypeValidator::DIGIT: return "digit";
+        case CharacterTypeValidator::SYMBOL: return "symbol";
+    }
+    return "?";
+}
+
+} // namespace
+
+class UnicodePasswordStrategy::Impl {
+public:
+    utils::Utf8Alphabet alphabet;
+    std::unique_ptr<core::interfaces::IRandomGenerator> rng;
+    unsigned requiredTypes = 0;
+
+    // Alphabet indices of each required type, in TYPES order; rebuilt
+    // after the alphabet or the requirements change
+    std::vector<std::vector<uint32_t>> required;
+    bool requiredValid = false;
+
+    explicit Impl(std::unique_ptr<core::interfaces::IRandomGenerator> randomGen)
+        : rng(randomGen ? std::move(randomGen)
+              : std::make_unique<utils::ThreadLocalRandomGenerator>()) {}
+
+    void buildRequired() {
+        if (requiredValid) {
+            return;
+        }
+        required.clear();
+        for (CharacterTypeValidator::Type type : TYPES) {
+            if (!(requiredTypes & type)) {
+                continue;
+            }
+            std::vector<uint32_t> members;
+            for (size_t i = 0; i < alphabet.size(); ++i) {
+                if (CharacterTypeValidator::typeOf(alphabet.codePoint(i)) == type) {
+                    members.push_back(static_cast<uint32_t>(i));
+                }
+            }
+            if (members.empty()) {
+                throw std::invalid_argument(std::string("The alphabet has no ") + typeName(type) +
+                                            " characters, but one is required");
+            }
+            required.push_back(std::move(members));
+        }
+        requiredValid = true;
+    }
+};
+
+UnicodePasswordStrategy::UnicodePasswordStrategy(
+    std::unique_ptr<core::interfaces::IRandomGenerator> randomGen)
+    : pImpl(std::make_unique<Impl>(std::move(randomGen))) {}
+
+UnicodePasswordStrategy::~UnicodePasswordStrategy() = default;
+
+void UnicodePasswordStrategy::addAlphabet(const utils::Utf8Alphabet& alphabet) {
+    pImpl->alphabet.merge(alphabet);
+    pImpl->requiredValid = false;
+}
+
+void UnicodePasswordStrategy::addCharacterSet(
+    std::unique_ptr<core::interfaces::ICharacterSetProvider> provider) {
+    pImpl->alphabet.merge(utils::Utf8Alphabet::fromString(provider->getCharacters()));
+    pImpl->requiredValid = false;
+}
+
+void UnicodePasswordStrategy::setRequirements(const validators::CharacterTypeValidator& validator) {
+    pImpl->requiredTypes = validator.getRequiredTypes();
+    pImpl->requiredValid = false;
+}
+
+void UnicodePasswordStrategy::clearAlphabet() {
+    pImpl->alphabet = utils::Utf8Alphabet();
+    pImpl->requiredValid = false;
+}
+
+const utils::Utf8Alphabet& UnicodePasswordStrategy::getAlphabet() const {
+    return pImpl->alphabet;
+}
+
+double UnicodePasswordStrategy::getEntropyBits(size_t length) const {
+    if (pImpl->alphabet.empty()) {
+        return 0.0;
+    }
+    return static_cast<double>(length) * std::log2(static_cast<double>(pImpl->alphabet.size()));
+}
+
+std::string UnicodePasswordStrategy::generate(size_t length) {
+    const utils::Utf8Alphabet& alphabet = pImpl->alphabet;
+    if (alphabet.empty()) {
+        throw std::runtime_error("No characters available for generation");
+    }
+
+    pImpl->buildRequired();
+    const auto& required = pImpl->required;
+    if (required.size() > length) {
+        throw std::invalid_argument("Length " + std::to_string(length) + " is shorter than the " +
+                                    std::to_string(required.size()) + " required character types");
+    }
+
+    utils::DrawBuffer draws(required.empty() ? length : 2 * length - 1);
+    if (required.empty()) {
+        utils::generateIndices(*pImpl->rng, draws.data(), length,
+                               static_cast<uint32_t>(alphabet.size()));
+    } else {
+        // One code point of each required type, the rest from the whole
+        // alphabet, then a Fisher-Yates shuffle, all in one bulk draw
+        for (size_t i = 0; i < length; ++i) {
+            draws[i] = static_cast<uint32_t>(i < required.size() ? required[i].size()
+                                                                 : alphabet.size());
+        }
+        for (size_t i = 1; i < length; ++i) {
+            draws[length + i - 1] = static_cast<uint32_t>(i + 1);
+        }
+        draws.draw(*pImpl->rng);
+        for (size_t i = 0; i < required.size(); ++i) {
+            draws[i] = required[i][draws[i]];
+        }
+        for (size_t i = length - 1; i > 0; --i) {
+            std::swap(draws[i], draws[draws[length + i - 1]]);
+        }
+    }
+
+    // Every copy writes a whole slot, so the buffer has room for the last
+    // one; with a common stride the result is already the exact size
+    const size_t stride = alphabet.stride();
+    const size_t capacity = stride ? length * stride + 4 - stride
+                                   : length * alphabet.maxEncodedLength() + 3;
+    std::string password(capacity, '\0');
+    char* out = &password[0];
+    size_t written = 0;
+    for (size_t i = 0; i < length; ++i) {
+        written += alphabet.copyTo(draws[i], out + written);
+    }
+    utils::secureWipe(out + written, capacity - written);
+    password.resize(written);
+    return password;
+}
+
+} // namespace strategies
+} // namespace password_generator
@@ -0,0 +1,229 @@
+#include "strategies/UniquePasswordStrategy.h"
+#include "utils/AlphabetPlan.h"
+#include "utils/BulkRandomGenerator.h"
+#include "utils/FeistelPermutation.h"
+#include "utils/IndexSampler.h"
+#include "utils/SecureMemory.h"
+#include "utils/Sha256.h"
+#include "utils/SystemEntropy.h"
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace password_generator {
+namespace strategies {
+
+namespace {
+
+const char PERMUTATION_LABEL[] = "dbgpass-unique-v1";
+const char TAIL_LABEL[] = "dbgpass-unique-tail-v1";
+
+void deriveSubkey(const uint8_t* master, const char* label, size_t labelLength,
+                  std::string_view alphabet, size_t length,
+                  uint8_t (&out)[utils::ChaCha20Drbg::KEY_SIZE]) {
+    std::string info(label, labelLength);
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        info.push_back(static_cast<char>((length >> shift) & 0xff));
+    }
+    info += alphabet;
+
+    utils::Sha256::Digest digest =
+        utils::hmacSha256(master, utils::ChaCha20Drbg::KEY_SIZE, info.data(), info.size());
+    std::memcpy(out, digest.data(), sizeof(out));
+    utils::secureWipe(digest.data(), digest.size());
+}
+
+void loadKeyWords(const uint8_t (&key)[utils::ChaCha20Drbg::KEY_SIZE], uint32_t (&words)[8]) {
+    for (int i = 0; i < 8; ++i) {
+        words[i] = static_cast<uint32_t>(key[4 * i]) |
+                   (static_cast<uint32_t>(key[4 * i + 1]) << 8) |
+                   (static_cast<uint32_t>(key[4 * i + 2]) << 16) |
+                   (static_cast<uint32_t>(key[4 * i + 3]) << 24);
+    }
+}
+
+} // namespace
+
+class UniquePasswordStrategy::Impl {
+public:
+    uint8_t masterKey[utils::ChaCha20Drbg::KEY_SIZE];
+    std::vector<std::unique_ptr<core::interfaces::ICharacterSetProvider>> providers;
+    utils::AlphabetPlan plan;
+
+    uint64_t shardIndex = 0;
+    uint64_t shardCount = 1;
+    uint64_t position = 0;
+    bool requireAllSets = true;
+
+    // Permutation for the current plan and length, rebuilt when either changes
+    std::unique_ptr<utils::FeistelPermutation> permutation;
+    size_t permutedLength = 0;
+    uint32_t tailKey[8];
+
+    explicit Impl(const std::string& keyMaterial) {
+        if (keyMaterial.empty()) {
+            utils::fillSystemEntropy(masterKey, sizeof(masterKey));
+        } else {
+            utils::Sha256::Digest digest =
+                utils::Sha256::hash(keyMaterial.data(), keyMaterial.size());
+            std::memcpy(masterKey, digest.data(), sizeof(masterKey));
+            utils::secureWipe(digest.data(), digest.size());
+        }
+        std::memset(tailKey, 0, sizeof(tailKey));
+    }
+
+    ~Impl() {
+        utils::secureWipe(masterKey, sizeof(masterKey));
+        utils::secureWipe(tailKey, sizeof(tailKey));
+    }
+
+    void prepare(size_t length) {
+        // The plan's merged table is deduplicated; a repeated character
+        // would map two counters to one password
+        const std::string_view alphabet = plan.merged().characters();
+        if (alphabet.size() < 2) {
+            throw std::runtime_error("Unique generation needs at least two distinct characters");
+        }
+        if (permutation && length == permutedLength) {
+            return;
+        }
+
+        uint8_t key[utils::ChaCha20Drbg::KEY_SIZE];
+        deriveSubkey(masterKey, PERMUTATION_LABEL, sizeof(PERMUTATION_LABEL),
+                     alphabet, length, key);
+        permutation = std::make_unique<utils::FeistelPermutation>(
+            key, static_cast<uint32_t>(alphabet.size()), length);
+        deriveSubkey(masterKey, TAIL_LABEL, sizeof(TAIL_LABEL), alphabet, length, key);
+        loadKeyWords(key, tailKey);
+        utils::secureWipe(key, sizeof(key));
+        permutedLength = length;
+    }
+
+    void rebuildPlan() {
+        plan.build(providers);
+        permutation.reset();
+    }
+
+    uint64_t nextCounter() {
+        if (position > (std::numeric_limits<uint64_t>::max() - shardIndex) / shardCount) {
+            throw std::runtime_error("Unique password space exhausted for this shard");
+        }
+        uint64_t counter = position * shardCount + shardIndex;
+        if (!permutation->contains(counter)) {
+            throw std::runtime_error("Unique password space exhausted for this shard");
+        }
+        ++position;
+        return counter;
+    }
+
+    // Positions beyond the permuted prefix come from ChaCha20 keyed by the
+    // tail key, with the counter as nonce
+    void fillTail(uint64_t counter, uint32_t* digits, size_t count) {
+        uint32_t blockIndex = 0;
+        uint8_t block[utils::ChaCha20Drbg::BLOCK_SIZE];
+        size_t offset = sizeof(block);
+        auto next = [&]() {
+            if (offset == sizeof(block)) {
+                const uint32_t nonce[3] = {static_cast<uint32_t>(counter),
+                                           static_cast<uint32_t>(counter >> 32), 0};
+                utils::ChaCha20Drbg::block(tailKey, blockIndex++, nonce, block);
+                offset = 0;
+            }
+            uint64_t word;
+            std::memcpy(&word, block + offset, sizeof(word));
+            offset += sizeof(word);
+            return word;
+        };
+        utils::SamplerStats stats;
+        utils::sampleIndices(next, digits, count, plan.mergedSize(), stats);
+        utils::secureWipe(block, sizeof(block));
+    }
+
+    bool hasAllSets(const std::string& password) const {
+        for (size_t i = 0; i < plan.setCount(); ++i) {
+            const utils::CharacterTable& set = plan.set(i);
+            bool found = false;
+            for (char c : password) {
+                if (set.contains(c)) {
+                    found = true;
+                    break;
+                }
+            }
+            if (!found) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+UniquePasswordStrategy::UniquePasswordStrategy(const std::string& keyMaterial)
+    : pImpl(std::make_unique<Impl>(keyMaterial)) {}
+
+UniquePasswordStrategy::~UniquePasswordStrategy() = default;
+
+void UniquePasswordStrategy::addCharacterSet(
+    std::unique_ptr<core::interfaces::ICharacterSetProvider> provider) {
+    pImpl->providers.push_back(std::move(provider));
+    pImpl->rebuildPlan();
+}
+
+void UniquePasswordStrategy::clearCharacterSets() {
+    pImpl->providers.clear();
+    pImpl->rebuildPlan();
+}
+
+void UniquePasswordStrategy::setShard(uint64_t index, uint64_t count) {
+    if (count == 0 || index >= count) {
+        throw std::invalid_argument("Shard index must be less than shard count");
+    }
+    pImpl->shardIndex = index;
+    pImpl->shardCount = count;
+    pImpl->position = 0;
+}
+
+uint64_t UniquePasswordStrategy::getPosition() const {
+    return pImpl->position;
+}
+
+void UniquePasswordStrategy::setPosition(uint64_t position) {
+    pImpl->position = position;
+}
+
+void UniquePasswordStrategy::setRequireAllSets(bool require) {
+    pImpl->requireAllSets = require;
+}
+
+std::string UniquePasswordStrategy::generate(size_t length) {
+    if (pImpl->providers.empty()) {
+        throw std::runtime_error("No character sets configured");
+    }
+    if (length == 0) {
+        throw std::invalid_argument("Password length must be positive");
+    }
+    pImpl->prepare(length);
+
+    const size_t permuted = pImpl->permutation->permutedDigits();
+    utils::DrawBuffer digits(length);
+    std::string password(length, '\0');
+
+    // Skipped counters are never reused, so uniqueness is unaffected
+    while (true) {
+        const uint64_t counter = pImpl->nextCounter();
+        pImpl->permutation->permute(counter, digits.data());
+        if (permuted < length) {
+            pImpl->fillTail(counter, digits.data() + permuted, length - permuted);
+        }
+        for (size_t i = 0; i < length; ++i) {
+            password[i] = pImpl->plan.merged()[digits[i]];
+        }
+        if (!pImpl->requireAllSets || pImpl->hasAllSets(password)) {
+            return password;
+        }
+    }
+}
+
+} // namespace strategies
+} // namespace password_generator
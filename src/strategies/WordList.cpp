@@ -0,0 +1,189 @@
+#include "strategies/WordList.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+namespace password_generator {
+namespace strategies {
+
+namespace {
+
+uint32_t readU32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+uint64_t readU64(const uint8_t* p) {
+    return static_cast<uint64_t>(readU32(p)) | (static_cast<uint64_t>(readU32(p + 4)) << 32);
+}
+
+void putU32(std::vector<uint8_t>& out, size_t at, uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        out[at + i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+bool isSeparatorByte(unsigned char c) {
+    return c == 0 || c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+// Capitalizing keeps the words starting with a-z in sorted order, so they
+// are merged against the sorted range starting with A-Z in one pass
+bool capitalCollision(const std::vector<std::string>& sorted) {
+    auto startsBelow = [](char bound) {
+        return [bound](const std::string& word) { return static_cast<unsigned char>(word[0]) < bound; };
+    };
+    auto upper = std::partition_point(sorted.begin(), sorted.end(), startsBelow('A'));
+    const auto upperEnd = std::partition_point(upper, sorted.end(), startsBelow('Z' + 1));
+    auto lower = std::partition_point(upperEnd, sorted.end(), startsBelow('a'));
+    const auto lowerEnd = std::partition_point(lower, sorted.end(), startsBelow('z' + 1));
+    while (upper != upperEnd && lower != lowerEnd) {
+        const char first = static_cast<char>((*lower)[0] - 'a' + 'A');
+        int order = (*upper)[0] < first ? -1 : (*upper)[0] > first ? 1 : 0;
+        if (order == 0) {
+            order = std::string_view(*upper).substr(1).compare(std::string_view(*lower).substr(1));
+        }
+        if (order == 0) {
+            return true;
+        }
+        order < 0 ? ++upper : ++lower;
+    }
+    return false;
+}
+
+} // namespace
+
+std::vector<uint8_t> WordList::compile(std::vector<std::string> words) {
+    for (const auto& word : words) {
+        if (word.empty()) {
+            throw std::invalid_argument("Word list contains an empty word");
+        }
+        for (char c : word) {
+            if (isSeparatorByte(static_cast<unsigned char>(c))) {
+                throw std::invalid_argument("Word '" + word + "' contains whitespace or NUL");
+            }
+        }
+    }
+    std::sort(words.begin(), words.end());
+    words.erase(std::unique(words.begin(), words.end()), words.end());
+    if (words.size() < MIN_WORDS) {
+        throw std::invalid_argument("Word list needs at least two distinct words");
+    }
+
+    uint64_t blobSize = 0;
+    size_t longest = 0;
+    uint32_t flags = 0;
+    uint8_t byteMap[32] = {0};
+    for (const auto& word : words) {
+        blobSize += word.size();
+        longest = std::max(longest, word.size());
+        for (char c : word) {
+            const auto byte = static_cast<unsigned char>(c);
+            byteMap[byte >> 3] |= static_cast<uint8_t>(1u << (byte & 7));
+        }
+        if (word.back() >= '0' && word.back() <= '9') {
+            flags |= ENDS_IN_DIGIT;
+        }
+    }
+    if (capitalCollision(words)) {
+        flags |= CAPITAL_COLLISION;
+    }
+    if (blobSize > UINT32_MAX || words.size() >= UINT32_MAX) {
+        throw std::invalid_argument("Word list exceeds 4 GiB");
+    }
+
+    const size_t offsetsSize = 4 * (words.size() + 1);
+    std::vector<uint8_t> out(HEADER_SIZE + offsetsSize + blobSize, 0);
+    std::memcpy(out.data(), MAGIC, sizeof(MAGIC));
+    putU32(out, 8, static_cast<uint32_t>(words.size()));
+    putU32(out, 12, static_cast<uint32_t>(longest));
+    putU32(out, 16, static_cast<uint32_t>(blobSize));
+    putU32(out, 24, flags);
+    std::memcpy(out.data() + 32, byteMap, sizeof(byteMap));
+
+    uint32_t offset = 0;
+    size_t at = HEADER_SIZE;
+    uint8_t* blob = out.data() + HEADER_SIZE + offsetsSize;
+    putU32(out, at, offset);
+    for (const auto& word : words) {
+        std::memcpy(blob + offset, word.data(), word.size());
+        offset += static_cast<uint32_t>(word.size());
+        at += 4;
+        putU32(out, at, offset);
+    }
+    return out;
+}
+
+void WordList::write(std::vector<std::string> words, const std::string& path) {
+    std::vector<uint8_t> bytes = compile(std::move(words));
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("Cannot open " + path + " for writing");
+    }
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    if (!file) {
+        throw std::runtime_error("Cannot write " + path);
+    }
+}
+
+std::shared_ptr<const WordList> WordList::load(const std::string& path) {
+    return std::shared_ptr<const WordList>(new WordList(utils::MappedFile(path)));
+}
+
+WordList::WordList(utils::MappedFile file) : file_(std::move(file)) {
+    const uint8_t* data = file_.data();
+    const size_t size = file_.size();
+    if (size >= sizeof(MAGIC) && std::memcmp(data, "DBGWRD1", sizeof(MAGIC)) == 0) {
+        throw std::runtime_error("Word list has an older format; recompile it with dbgpass-wordlist");
+    }
+    if (size < HEADER_SIZE || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("Not a word list file");
+    }
+
+    wordCount_ = readU32(data + 8);
+    maxWordLength_ = readU32(data + 12);
+    blobSize_ = readU64(data + 16);
+    flags_ = readU32(data + 24);
+    byteMap_ = data + 32;
+    if (wordCount_ < MIN_WORDS) {
+        throw std::runtime_error("Word list needs at least two words");
+    }
+    const uint64_t offsetsSize = 4 * (static_cast<uint64_t>(wordCount_) + 1);
+    if (size - HEADER_SIZE < offsetsSize || size - HEADER_SIZE - offsetsSize != blobSize_) {
+        throw std::runtime_error("Word list size does not match its header");
+    }
+    offsets_ = data + HEADER_SIZE;
+    blob_ = reinterpret_cast<const char*>(offsets_ + offsetsSize);
+}
+
+bool WordList::contains(std::string_view word) const {
+    size_t low = 0;
+    size_t high = wordCount_;
+    while (low < high) {
+        const size_t mid = low + (high - low) / 2;
+        const std::string_view candidate = (*this)[mid];
+        if (candidate == word) {
+            return true;
+        }
+        if (candidate < word) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return false;
+}
+
+std::string_view WordList::operator[](size_t index) const {
+    const uint32_t begin = readU32(offsets_ + 4 * index);
+    const uint32_t end = readU32(offsets_ + 4 * (index + 1));
+    if (begin >= end || end > blobSize_ || end - begin > maxWordLength_) {
+        throw std::runtime_error("Corrupt word list offsets");
+    }
+    return std::string_view(blob_ + begin, end - begin);
+}
+
+} // namespace strategies
+} // namespace password_generator
@@ -0,0 +1,96 @@
+#include "utils/AliasTable.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace password_generator {
+namespace utils {
+
+namespace {
+
+constexpr size_t MAX_ENTRIES = size_t(1) << 16;
+
+} // namespace
+
+AliasTable::AliasTable(const std::vector<double>& weights) {
+    const size_t n = weights.size();
+    if (n == 0 || n > MAX_ENTRIES) {
+        throw std::invalid_argument("Alias table needs 1 to 65536 weights");
+    }
+    double sum = 0.0;
+    for (double w : weights) {
+        if (!(w > 0.0) || !std::isfinite(w)) {
+            throw std::invalid_argument("Weights must be positive and finite");
+        }
+        sum += w;
+    }
+
+    // Largest power of two with n * unit still a 32-bit bound
+    shift_ = 0;
+    while ((static_cast<uint64_t>(n) << (shift_ + 1)) <= UINT32_MAX) {
+        ++shift_;
+    }
+    const uint64_t total = uint64_t(1) << shift_;
+
+    // Largest-remainder quantization; every entry keeps at least one unit
+    weight_.resize(n);
+    std::vector<std::pair<double, size_t>> remainders(n);
+    uint64_t assigned = 0;
+    for (size_t i = 0; i < n; ++i) {
+        double exact = weights[i] / sum * static_cast<double>(total);
+        uint64_t whole = std::max<uint64_t>(1, static_cast<uint64_t>(exact));
+        weight_[i] = static_cast<uint32_t>(whole);
+        assigned += whole;
+        remainders[i] = {exact - static_cast<double>(whole), i};
+    }
+    std::sort(remainders.begin(), remainders.end(),
+              [](const auto& a, const auto& b) { return a.first > b.first; });
+    for (size_t k = 0; assigned < total; k = (k + 1) % n) {
+        ++weight_[remainders[k].second];
+        ++assigned;
+    }
+    while (assigned > total) {
+        for (size_t k = n; k-- > 0 && assigned > total;) {
+            size_t i = remainders[k].second;
+            if (weight_[i] > 1) {
+                --weight_[i];
+                --assigned;
+            }
+        }
+    }
+
+    // Integer Vose: each column holds `total` units
+    threshold_.assign(n, static_cast<uint32_t>(total));
+    alias_.resize(n);
+    std::vector<uint64_t> scaled(n);
+    std::vector<uint32_t> small, large;
+    for (size_t i = 0; i < n; ++i) {
+        alias_[i] = static_cast<uint32_t>(i);
+        scaled[i] = static_cast<uint64_t>(weight_[i]) * n;
+        (scaled[i] < total ? small : large).push_back(static_cast<uint32_t>(i));
+    }
+    while (!small.empty() && !large.empty()) {
+        uint32_t low = small.back();
+        small.pop_back();
+        uint32_t high = large.back();
+        threshold_[low] = static_cast<uint32_t>(scaled[low]);
+        alias_[low] = high;
+        scaled[high] -= total - scaled[low];
+        if (scaled[high] < total) {
+            large.pop_back();
+            small.push_back(high);
+        }
+    }
+}
+
+double AliasTable::entropyBits() const {
+    double bits = 0.0;
+    for (size_t i = 0; i < size(); ++i) {
+        double p = probability(i);
+        bits -= p * std::log2(p);
+    }
+    return bits;
+}
+
+} // namespace utils
+} // namespace password_generator
@@ -0,0 +1,238 @@
+#include "utils/AlphabetKernel.h"
+#include "utils/BulkRandomGenerator.h"
+#include "utils/SecureMemory.h"
+#include <stdexcept>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define HAVE_X86_SIMD 1
+#endif
+
+namespace password_generator {
+namespace utils {
+
+namespace {
+
+// Random bytes fetched per fill() round
+constexpr size_t FILL_BLOCK = 1024;
+
+size_t mapScalar(const uint8_t* table, size_t size, uint8_t mask, const uint8_t* bytes,
+                 size_t byteCount, char* out, size_t outCount, size_t& pos, size_t written) {
+    // Branch-free: every byte is stored, and only an accepted one advances
+    while (written < outCount && pos < byteCount) {
+        const uint8_t index = bytes[pos++] & mask;
+        out[written] = static_cast<char>(table[index]);
+        written += index < size;
+    }
+    return written;
+}
+
+#if defined(HAVE_X86_SIMD)
+
+// lanes[m] lists the set bits of m, then 0x80 (pshufb writes zero)
+struct PackTable {
+    alignas(16) uint8_t lanes[256][8];
+
+    constexpr PackTable() : lanes() {
+        for (unsigned m = 0; m < 256; ++m) {
+            unsigned k = 0;
+            for (unsigned bit = 0; bit < 8; ++bit) {
+                if ((m >> bit) & 1) {
+                    lanes[m][k++] = static_cast<uint8_t>(bit);
+                }
+            }
+            for (; k < 8; ++k) {
+                lanes[m][k] = 0x80;
+            }
+        }
+    }
+};
+
+constexpr PackTable PACK;
+
+// Left-pack the accepted lanes of 16 mapped bytes, 8 at a time; each store
+// is 8 bytes wide, so out needs 16 bytes of room
+__attribute__((target("sse4.1,popcnt")))
+inline size_t pack16(__m128i chars, unsigned accepted, char* out) {
+    const __m128i low =
+        _mm_loadl_epi64(reinterpret_cast<const __m128i*>(PACK.lanes[accepted & 0xFF]));
+    const __m128i high = _mm_add_epi8(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i*>(PACK.lanes[accepted >> 8])),
+        _mm_set1_epi8(8));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8(chars, low));
+    const size_t lowCount = static_cast<size_t>(_mm_popcnt_u32(accepted & 0xFF));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(out + lowCount), _mm_shuffle_epi8(chars, high));
+    return lowCount + static_cast<size_t>(_mm_popcnt_u32(accepted >> 8));
+}
+
+__attribute__((target("sse4.1,popcnt")))
+size_t mapSse41(const uint8_t* table, size_t size, uint8_t mask, const uint8_t* bytes,
+                size_t byteCount, char* out, size_t outCount, size_t& pos) {
+    const size_t slices = (static_cast<size_t>(mask) + 16) / 16;
+    __m128i slice[AlphabetKernel::MAX_ALPHABET / 16];
+    for (size_t k = 0; k < slices; ++k) {
+        slice[k] = _mm_load_si128(reinterpret_cast<const __m128i*>(table + 16 * k));
+    }
+    const __m128i maskVector = _mm_set1_epi8(static_cast<char>(mask));
+    const __m128i limit = _mm_set1_epi8(static_cast<char>(size));
+    const bool acceptAll = size == static_cast<size_t>(mask) + 1;
+
+    size_t written = 0;
+    while (pos + 16 <= byteCount && outCount - written >= 16) {
+        // Indices are below 128, so signed compares and pshufb's low nibble apply
+        const __m128i index = _mm_and_si128(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + pos)), maskVector);
+        const unsigned accepted = acceptAll ? 0xFFFFu
+            : static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpgt_epi8(limit, index)));
+
+        __m128i chars = _mm_shuffle_epi8(slice[0], index);
+        if (slices > 1) {
+            const __m128i high = _mm_and_si128(_mm_srli_epi16(index, 4), _mm_set1_epi8(0x0F));
+            for (size_t k = 1; k < slices; ++k) {
+                const __m128i select = _mm_cmpeq_epi8(high, _mm_set1_epi8(static_cast<char>(k)));
+                chars = _mm_blendv_epi8(chars, _mm_shuffle_epi8(slice[k], index), select);
+            }
+        }
+        written += pack16(chars, accepted, out + written);
+        pos += 16;
+    }
+    return mapScalar(table, size, mask, bytes, byteCount, out, outCount, pos, written);
+}
+
+__attribute__((target("avx2,popcnt")))
+size_t mapAvx2(const uint8_t* table, size_t size, uint8_t mask, const uint8_t* bytes,
+               size_t byteCount, char* out, size_t outCount, size_t& pos) {
+    // vpshufb looks up within each 128-bit lane, so both lanes hold the slice
+    const size_t slices = (static_cast<size_t>(mask) + 16) / 16;
+    __m256i slice[AlphabetKernel::MAX_ALPHABET / 16];
+    for (size_t k = 0; k < slices; ++k) {
+        slice[k] = _mm256_broadcastsi128_si256(
+            _mm_load_si128(reinterpret_cast<const __m128i*>(table + 16 * k)));
+    }
+    const __m256i maskVector = _mm256_set1_epi8(static_cast<char>(mask));
+    const __m256i limit = _mm256_set1_epi8(static_cast<char>(size));
+    const bool acceptAll = size == static_cast<size_t>(mask) + 1;
+
+    size_t written = 0;
+    while (pos + 32 <= byteCount && outCount - written >= 32) {
+        const __m256i index = _mm256_and_si256(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + pos)), maskVector);
+        const uint32_t accepted = acceptAll ? 0xFFFFFFFFu
+            : static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(limit, index)));
+
+        __m256i chars = _mm256_shuffle_epi8(slice[0], index);
+        if (slices > 1) {
+            const __m256i high = _mm256_and_si256(_mm256_srli_epi16(index, 4),
+                                                  _mm256_set1_epi8(0x0F));
+            for (size_t k = 1; k < slices; ++k) {
+                const __m256i select = _mm256_cmpeq_epi8(high,
+                                                         _mm256_set1_epi8(static_cast<char>(k)));
+                chars = _mm256_blendv_epi8(chars, _mm256_shuffle_epi8(slice[k], index), select);
+            }
+        }
+        written += pack16(_mm256_castsi256_si128(chars), accepted & 0xFFFF, out + written);
+        written += pack16(_mm256_extracti128_si256(chars, 1), accepted >> 16, out + written);
+        pos += 32;
+    }
+    return mapScalar(table, size, mask, bytes, byteCount, out, outCount, pos, written);
+}
+
+#endif
+
+} // namespace
+
+AlphabetKernel::AlphabetKernel(std::string_view alphabet)
+    : size_(alphabet.size()), mask_(0), isa_(bestIsa()), table_() {
+    if (alphabet.empty() || alphabet.size() > MAX_ALPHABET) {
+        throw std::invalid_argument("Kernel alphabets hold 1 to " +
+                                    std::to_string(MAX_ALPHABET) + " characters");
+    }
+    bool seen[256] = {};
+    for (size_t i = 0; i < alphabet.size(); ++i) {
+        const auto byte = static_cast<unsigned char>(alphabet[i]);
+        if (seen[byte]) {
+            throw std::invalid_argument("Kernel alphabet repeats a character");
+        }
+        seen[byte] = true;
+        table_[i] = byte;
+    }
+    while (static_cast<size_t>(mask_) + 1 < size_) {
+        mask_ = static_cast<uint8_t>((mask_ << 1) | 1);
+    }
+}
+
+size_t AlphabetKernel::map(const uint8_t* bytes, size_t byteCount, char* out, size_t outCount,
+                           size_t& consumed) const {
+    return map(isa_, bytes, byteCount, out, outCount, consumed);
+}
+
+size_t AlphabetKernel::map(Isa isa, const uint8_t* bytes, size_t byteCount, char* out,
+                           size_t outCount, size_t& consumed) const {
+    consumed = 0;
+    switch (isa) {
+    case Isa::Scalar:
+        return mapScalar(table_, size_, mask_, bytes, byteCount, out, outCount, consumed, 0);
+#if defined(HAVE_X86_SIMD)
+    case Isa::Sse41:
+        if (isSupported(isa)) {
+            return mapSse41(table_, size_, mask_, bytes, byteCount, out, outCount, consumed);
+        }
+        break;
+    case Isa::Avx2:
+        if (isSupported(isa)) {
+            return mapAvx2(table_, size_, mask_, bytes, byteCount, out, outCount, consumed);
+        }
+        break;
+#else
+    default:
+        break;
+#endif
+    }
+    throw std::invalid_argument("Kernel not supported on this CPU");
+}
+
+void AlphabetKernel::fill(core::interfaces::IRandomGenerator& rng, char* out,
+                          size_t count) const {
+    alignas(32) uint8_t bytes[FILL_BLOCK];
+    size_t written = 0;
+    while (written < count) {
+        // Enough bytes for the rest at the acceptance rate, plus slack, so
+        // the last round rarely falls short and little is thrown away
+        const size_t remaining = count - written;
+        const size_t expected = remaining * (static_cast<size_t>(mask_) + 1) / size_;
+        const size_t request = expected + expected / 8 + 16 < FILL_BLOCK
+            ? expected + expected / 8 + 16 : FILL_BLOCK;
+        fillBytes(rng, bytes, request);
+        size_t consumed;
+        written += map(isa_, bytes, request, out + written, remaining, consumed);
+    }
+    secureWipe(bytes, sizeof(bytes));
+}
+
+AlphabetKernel::Isa AlphabetKernel::bestIsa() {
+    if (isSupported(Isa::Avx2)) {
+        return Isa::Avx2;
+    }
+    if (isSupported(Isa::Sse41)) {
+        return Isa::Sse41;
+    }
+    return Isa::Scalar;
+}
+
+bool AlphabetKernel::isSupported(Isa isa) {
+    switch (isa) {
+    case Isa::Scalar:
+        return true;
+#if defined(HAVE_X86_SIMD)
+    case Isa::Sse41:
+        return __builtin_cpu_supports("sse4.1") && __builtin_cpu_supports("popcnt");
+    case Isa::Avx2:
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+#endif
+    default:
+        return false;
+    }
+}
+
+} // namespace utils
+} // namespace password_generator
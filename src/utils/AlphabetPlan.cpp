@@ -0,0 +1,84 @@
+#include "utils/AlphabetPlan.h"
+#include "providers/CharacterTableProvider.h"
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace password_generator {
+namespace utils {
+
+void AlphabetPlan::build(
+    const std::vector<std::unique_ptr<core::interfaces::ICharacterSetProvider>>& providers,
+    const CharacterFilter* filter) {
+    // Table providers are read in place unless the filter masks characters;
+    // others are copied once here. The plan is only cleared once every set
+    // has passed the mask, so a rejected filter leaves it unchanged
+    const bool masked = filter && filter->hasMask();
+    std::vector<std::string> copies;
+    copies.reserve(providers.size());
+    std::vector<std::string_view> sets;
+    sets.reserve(providers.size());
+    for (const auto& provider : providers) {
+        const CharacterTable* table = providers::characterTableOf(*provider);
+        if (table && !masked) {
+            sets.push_back(table->characters());
+            continue;
+        }
+        std::string chars = table ? std::string(table->characters()) : provider->getCharacters();
+        if (masked) {
+            std::string kept = filter->apply(chars);
+            if (kept.empty() && !chars.empty()) {
+                throw std::invalid_argument("Character filters remove every character of set '" +
+                                            provider->getName() + "'");
+            }
+            chars = std::move(kept);
+        }
+        copies.push_back(std::move(chars));
+        sets.push_back(copies.back());
+    }
+    clear();
+
+    bool seen[256] = {false};
+    std::string merged;
+    for (size_t s = 0; s < sets.size(); ++s) {
+        for (char c : sets[s]) {
+            auto byte = static_cast<unsigned char>(c);
+            if (!seen[byte]) {
+                seen[byte] = true;
+                merged.push_back(c);
+                origin_.push_back(s);
+            }
+        }
+    }
+
+    std::vector<size_t> offsets;
+    table_.assign(merged.begin(), merged.end());
+    for (std::string_view chars : sets) {
+        if (!chars.empty()) {
+            offsets.push_back(table_.size());
+            table_.insert(table_.end(), chars.begin(), chars.end());
+        }
+    }
+
+    // Views are taken only once the table has stopped growing
+    const char* base = table_.data();
+    merged_ = CharacterTable(std::string_view(base, merged.size()));
+    sets_.reserve(offsets.size());
+    size_t index = 0;
+    for (std::string_view chars : sets) {
+        if (!chars.empty()) {
+            sets_.emplace_back(std::string_view(base + offsets[index++], chars.size()));
+        }
+    }
+}
+
+void AlphabetPlan::clear() {
+    table_.clear();
+    merged_ = CharacterTable();
+    origin_.clear();
+    sets_.clear();
+}
+
+} // namespace utils
+} // namespace password_generator
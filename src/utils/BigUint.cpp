@@ -0,0 +1,200 @@
+#include "utils/BigUint.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace password_generator {
+namespace utils {
+
+BigUint::BigUint(uint64_t value) {
+    while (value != 0) {
+        limbs_.push_back(static_cast<uint32_t>(value));
+        value >>= 32;
+    }
+}
+
+BigUint BigUint::pow(const BigUint& base, size_t exponent) {
+    BigUint result(1);
+    BigUint square(base);
+    while (exponent != 0) {
+        if (exponent & 1) {
+            result *= square;
+        }
+        exponent >>= 1;
+        if (exponent != 0) {
+            square *= square;
+        }
+    }
+    return result;
+}
+
+BigUint BigUint::fromBytes(const uint8_t* bytes, size_t length) {
+    BigUint result;
+    result.limbs_.assign((length + 3) / 4, 0);
+    for (size_t i = 0; i < length; ++i) {
+        size_t bit = (length - 1 - i) * 8;
+        result.limbs_[bit / 32] |= static_cast<uint32_t>(bytes[i]) << (bit % 32);
+    }
+    result.trim();
+    return result;
+}
+
+size_t BigUint::bitLength() const {
+    if (limbs_.empty()) {
+        return 0;
+    }
+    size_t bits = 32 * (limbs_.size() - 1);
+    for (uint32_t top = limbs_.back(); top != 0; top >>= 1) {
+        ++bits;
+    }
+    return bits;
+}
+
+void BigUint::trim() {
+    while (!limbs_.empty() && limbs_.back() == 0) {
+        limbs_.pop_back();
+    }
+}
+
+int BigUint::compare(const BigUint& a, const BigUint& b) {
+    if (a.limbs_.size() != b.limbs_.size()) {
+        return a.limbs_.size() < b.limbs_.size() ? -1 : 1;
+    }
+    for (size_t i = a.limbs_.size(); i-- > 0;) {
+        if (a.limbs_[i] != b.limbs_[i]) {
+            return a.limbs_[i] < b.limbs_[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+BigUint& BigUint::operator+=(const BigUint& other) {
+    if (limbs_.size() < other.limbs_.size()) {
+        limbs_.resize(other.limbs_.size(), 0);
+    }
+    uint64_t carry = 0;
+    for (size_t i = 0; i < limbs_.size(); ++i) {
+        uint64_t sum = carry + limbs_[i] + (i < other.limbs_.size() ? other.limbs_[i] : 0);
+        limbs_[i] = static_cast<uint32_t>(sum);
+        carry = sum >> 32;
+    }
+    if (carry != 0) {
+        limbs_.push_back(static_cast<uint32_t>(carry));
+    }
+    return *this;
+}
+
+BigUint& BigUint::operator-=(const BigUint& other) {
+    if (*this < other) {
+        throw std::underflow_error("BigUint subtraction would be negative");
+    }
+    int64_t borrow = 0;
+    for (size_t i = 0; i < limbs_.size(); ++i) {
+        int64_t diff = static_cast<int64_t>(limbs_[i]) - borrow -
+                       (i < other.limbs_.size() ? other.limbs_[i] : 0);
+        borrow = diff < 0 ? 1 : 0;
+        limbs_[i] = static_cast<uint32_t>(diff + (borrow << 32));
+    }
+    trim();
+    return *this;
+}
+
+BigUint& BigUint::operator*=(uint32_t factor) {
+    if (factor == 0) {
+        limbs_.clear();
+        return *this;
+    }
+    uint64_t carry = 0;
+    for (auto& limb : limbs_) {
+        uint64_t product = static_cast<uint64_t>(limb) * factor + carry;
+        limb = static_cast<uint32_t>(product);
+        carry = product >> 32;
+    }
+    if (carry != 0) {
+        limbs_.push_back(static_cast<uint32_t>(carry));
+    }
+    return *this;
+}
+
+BigUint& BigUint::operator*=(const BigUint& other) {
+    if (isZero() || other.isZero()) {
+        limbs_.clear();
+        return *this;
+    }
+    std::vector<uint32_t> result(limbs_.size() + other.limbs_.size(), 0);
+    for (size_t i = 0; i < limbs_.size(); ++i) {
+        uint64_t carry = 0;
+        for (size_t j = 0; j < other.limbs_.size(); ++j) {
+            uint64_t cur = result[i + j] + static_cast<uint64_t>(limbs_[i]) * other.limbs_[j] + carry;
+            result[i + j] = static_cast<uint32_t>(cur);
+            carry = cur >> 32;
+        }
+        result[i + other.limbs_.size()] = static_cast<uint32_t>(carry);
+    }
+    limbs_ = std::move(result);
+    trim();
+    return *this;
+}
+
+uint32_t BigUint::divideSmall(uint32_t divisor) {
+    if (divisor == 0) {
+        throw std::invalid_argument("Division by zero");
+    }
+    uint64_t remainder = 0;
+    for (size_t i = limbs_.size(); i-- > 0;) {
+        uint64_t current = (remainder << 32) | limbs_[i];
+        limbs_[i] = static_cast<uint32_t>(current / divisor);
+        remainder = current % divisor;
+    }
+    trim();
+    return static_cast<uint32_t>(remainder);
+}
+
+double BigUint::log2() const {
+    if (isZero()) {
+        return 0.0;
+    }
+    // The top two limbs carry all the precision a double can hold
+    size_t n = limbs_.size();
+    double top = limbs_[n - 1];
+    if (n >= 2) {
+        top = top * 4294967296.0 + limbs_[n - 2];
+        return std::log2(top) + 32.0 * static_cast<double>(n - 2);
+    }
+    return std::log2(top);
+}
+
+uint64_t BigUint::low64() const {
+    uint64_t value = 0;
+    if (!limbs_.empty()) {
+        value = limbs_[0];
+    }
+    if (limbs_.size() > 1) {
+        value |= static_cast<uint64_t>(limbs_[1]) << 32;
+    }
+    return value;
+}
+
+std::string BigUint::toString() const {
+    if (isZero()) {
+        return "0";
+    }
+    // Peel off nine decimal digits at a time
+    BigUint value = *this;
+    std::string digits;
+    while (!value.isZero()) {
+        uint32_t chunk = value.divideSmall(1000000000);
+        for (int i = 0; i < 9; ++i) {
+            digits.push_back(static_cast<char>('0' + chunk % 10));
+            chunk /= 10;
+            if (value.isZero() && chunk == 0) {
+                break;
+            }
+        }
+    }
+    std::reverse(digits.begin(), digits.end());
+    return digits;
+}
+
+} // namespace utils
+} // namespace password_generator
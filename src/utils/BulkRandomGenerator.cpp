@@ -0,0 +1,65 @@
+#include "utils/BulkRandomGenerator.h"
+#include "utils/SecureMemory.h"
+#include <climits>
+#include <stdexcept>
+
+namespace password_generator {
+namespace utils {
+
+namespace {
+
+uint32_t drawBelow(core::interfaces::IRandomGenerator& rng, uint32_t bound) {
+    if (bound == 0 || bound - 1 > static_cast<uint32_t>(INT_MAX)) {
+        throw std::invalid_argument("bound out of range for IRandomGenerator::generate");
+    }
+    return static_cast<uint32_t>(rng.generate(0, static_cast<int>(bound - 1)));
+}
+
+} // namespace
+
+void generateBounded(core::interfaces::IRandomGenerator& rng, uint32_t* values, size_t count) {
+    if (auto* bulk = dynamic_cast<IBulkRandomGenerator*>(&rng)) {
+        bulk->generateBounded(values, count);
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = drawBelow(rng, values[i]);
+    }
+}
+
+void generateIndices(core::interfaces::IRandomGenerator& rng, uint32_t* out, size_t count,
+                     uint32_t bound) {
+    if (auto* bulk = dynamic_cast<IBulkRandomGenerator*>(&rng)) {
+        bulk->generateIndices(out, count, bound);
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = drawBelow(rng, bound);
+    }
+}
+
+void fillBytes(core::interfaces::IRandomGenerator& rng, void* out, size_t length) {
+    if (auto* bulk = dynamic_cast<IBulkRandomGenerator*>(&rng)) {
+        bulk->fillBytes(out, length);
+        return;
+    }
+    auto* bytes = static_cast<uint8_t*>(out);
+    for (size_t i = 0; i < length; ++i) {
+        bytes[i] = static_cast<uint8_t>(rng.generate(0, 255));
+    }
+}
+
+DrawBuffer::DrawBuffer(size_t count)
+    : data_(inline_), size_(count) {
+    if (count > INLINE_CAPACITY) {
+        heap_.resize(count);
+        data_ = heap_.data();
+    }
+}
+
+DrawBuffer::~DrawBuffer() {
+    secureWipe(data_, size_ * sizeof(uint32_t));
+}
+
+} // namespace utils
+} // namespace password_generator
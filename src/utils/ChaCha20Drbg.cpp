@@ -0,0 +1,154 @@
+#include "utils/ChaCha20Drbg.h"
+#include "utils/SecureMemory.h"
+#include "utils/SystemEntropy.h"
+
+namespace password_generator {
+namespace utils {
+
+namespace {
+
+inline uint32_t rotl32(uint32_t x, int n) {
+    return (x << n) | (x >> (32 - n));
+}
+
+inline uint32_t load32le(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) |
+           (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) |
+           (static_cast<uint32_t>(p[3]) << 24);
+}
+
+inline void store32le(uint8_t* p, uint32_t v) {
+    p[0] = static_cast<uint8_t>(v);
+    p[1] = static_cast<uint8_t>(v >> 8);
+    p[2] = static_cast<uint8_t>(v >> 16);
+    p[3] = static_cast<uint8_t>(v >> 24);
+}
+
+#define CHACHA_QUARTER_ROUND(a, b, c, d) \
+    a += b; d ^= a; d = rotl32(d, 16);   \
+    c += d; b ^= c; b = rotl32(b, 12);   \
+    a += b; d ^= a; d = rotl32(d, 8);    \
+    c += d; b ^= c; b = rotl32(b, 7);
+
+void loadKey(uint32_t key[8], const uint8_t* bytes) {
+    for (int i = 0; i < 8; ++i) {
+        key[i] = load32le(bytes + 4 * i);
+    }
+}
+
+} // namespace
+
+void ChaCha20Drbg::block(const uint32_t key[8], uint32_t counter,
+                         const uint32_t nonce[3], uint8_t out[BLOCK_SIZE]) {
+    uint32_t input[16] = {
+        0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,
+        key[0], key[1], key[2], key[3],
+        key[4], key[5], key[6], key[7],
+        counter, nonce[0], nonce[1], nonce[2]
+    };
+
+    uint32_t x[16];
+    for (int i = 0; i < 16; ++i) {
+        x[i] = input[i];
+    }
+
+    for (int round = 0; round < 10; ++round) {
+        // Column rounds
+        CHACHA_QUARTER_ROUND(x[0], x[4], x[8],  x[12])
+        CHACHA_QUARTER_ROUND(x[1], x[5], x[9],  x[13])
+        CHACHA_QUARTER_ROUND(x[2], x[6], x[10], x[14])
+        CHACHA_QUARTER_ROUND(x[3], x[7], x[11], x[15])
+        // Diagonal rounds
+        CHACHA_QUARTER_ROUND(x[0], x[5], x[10], x[15])
+        CHACHA_QUARTER_ROUND(x[1], x[6], x[11], x[12])
+        CHACHA_QUARTER_ROUND(x[2], x[7], x[8],  x[13])
+        CHACHA_QUARTER_ROUND(x[3], x[4], x[9],  x[14])
+    }
+
+    for (int i = 0; i < 16; ++i) {
+        store32le(out + 4 * i, x[i] + input[i]);
+    }
+
+    secureWipe(x, sizeof(x));
+    secureWipe(input, sizeof(input));
+}
+
+ChaCha20Drbg::ChaCha20Drbg()
+    : position_(BUFFER_SIZE), bytesSinceReseed_(0), autoReseed_(true) {
+    uint8_t seed[KEY_SIZE];
+    fillSystemEntropy(seed, sizeof(seed));
+    loadKey(key_, seed);
+    secureWipe(seed, sizeof(seed));
+}
+
+ChaCha20Drbg::ChaCha20Drbg(const uint8_t (&key)[KEY_SIZE])
+    : position_(BUFFER_SIZE), bytesSinceReseed_(0), autoReseed_(false) {
+    loadKey(key_, key);
+}
+
+ChaCha20Drbg::~ChaCha20Drbg() {
+    secureWipe(buffer_, sizeof(buffer_));
+    secureWipe(key_, sizeof(key_));
+}
+
+void ChaCha20Drbg::fill(void* out, size_t length) {
+    auto* dst = static_cast<uint8_t*>(out);
+    while (length > 0) {
+        if (position_ == BUFFER_SIZE) {
+            refill();
+        }
+        size_t chunk = BUFFER_SIZE - position_;
+        if (chunk > length) {
+            chunk = length;
+        }
+        std::memcpy(dst, buffer_ + position_, chunk);
+        std::memset(buffer_ + position_, 0, chunk);
+        position_ += chunk;
+        dst += chunk;
+        length -= chunk;
+    }
+}
+
+void ChaCha20Drbg::reseed() {
+    uint8_t fresh[KEY_SIZE];
+    fillSystemEntropy(fresh, sizeof(fresh));
+    for (int i = 0; i < 8; ++i) {
+        key_[i] ^= load32le(fresh + 4 * i);
+    }
+    secureWipe(fresh, sizeof(fresh));
+    bytesSinceReseed_ = 0;
+    discardBuffer();
+}
+
+void ChaCha20Drbg::rekey(const uint8_t (&key)[KEY_SIZE]) {
+    loadKey(key_, key);
+    bytesSinceReseed_ = 0;
+    discardBuffer();
+}
+
+void ChaCha20Drbg::refill() {
+    if (autoReseed_ && bytesSinceReseed_ >= RESEED_INTERVAL) {
+        reseed();
+    }
+
+    // The key changes on every refill, so each buffer can start at counter 0
+    static const uint32_t nonce[3] = {0, 0, 0};
+    for (size_t i = 0; i < BUFFER_BLOCKS; ++i) {
+        block(key_, static_cast<uint32_t>(i), nonce, buffer_ + i * BLOCK_SIZE);
+    }
+
+    // Fast key erasure: the head of the new keystream becomes the next key
+    loadKey(key_, buffer_);
+    std::memset(buffer_, 0, KEY_SIZE);
+    position_ = KEY_SIZE;
+    bytesSinceReseed_ += BUFFER_SIZE;
+}
+
+void ChaCha20Drbg::discardBuffer() {
+    secureWipe(buffer_, sizeof(buffer_));
+    position_ = BUFFER_SIZE;
+}
+
+} // namespace utils
+} // namespace password_generator
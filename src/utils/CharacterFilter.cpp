@@ -0,0 +1,104 @@
+#include "utils/CharacterFilter.h"
+#include "utils/SecureMemory.h"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+namespace password_generator {
+namespace utils {
+
+namespace {
+
+void setBits(uint64_t (&mask)[4], std::string_view chars) {
+    for (char c : chars) {
+        auto byte = static_cast<unsigned char>(c);
+        mask[byte >> 6] |= uint64_t(1) << (byte & 63);
+    }
+}
+
+} // namespace
+
+CharacterFilter::CharacterFilter() {
+    for (uint64_t& word : allow_) {
+        word = ~uint64_t(0);
+    }
+}
+
+void CharacterFilter::excludeAmbiguous() {
+    exclude(AMBIGUOUS);
+}
+
+void CharacterFilter::exclude(std::string_view chars) {
+    uint64_t mask[4] = {0, 0, 0, 0};
+    setBits(mask, chars);
+    for (int i = 0; i < 4; ++i) {
+        allow_[i] &= ~mask[i];
+    }
+}
+
+void CharacterFilter::allowOnly(std::string_view chars) {
+    uint64_t mask[4] = {0, 0, 0, 0};
+    setBits(mask, chars);
+    for (int i = 0; i < 4; ++i) {
+        allow_[i] &= mask[i];
+    }
+}
+
+void CharacterFilter::loadCharsetFile(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("Cannot read charset file '" + path + "'");
+    }
+    const std::string contents((std::istreambuf_iterator<char>(in)),
+                               std::istreambuf_iterator<char>());
+
+    std::string charset;
+    for (char c : contents) {
+        if (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f') {
+            continue;
+        }
+        if (c < '!' || c > '~') {
+            throw std::invalid_argument("Charset file '" + path +
+                                        "' must list printable ASCII characters");
+        }
+        charset.push_back(c);
+    }
+    if (charset.empty()) {
+        throw std::invalid_argument("Charset file '" + path + "' lists no characters");
+    }
+    allowOnly(charset);
+}
+
+std::string CharacterFilter::apply(std::string_view chars) const {
+    std::string kept;
+    kept.reserve(chars.size());
+    for (char c : chars) {
+        if (allows(c)) {
+            kept.push_back(c);
+        }
+    }
+    return kept;
+}
+
+bool CharacterFilter::hasMask() const {
+    for (uint64_t word : allow_) {
+        if (word != ~uint64_t(0)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+CharacterFilter::Tracker::Tracker(const CharacterFilter& filter)
+    : maxRepeat_(filter.maxRepeat_), noAdjacentRepeat_(filter.noAdjacentRepeat_) {
+    std::memset(counts_, 0, sizeof(counts_));
+}
+
+CharacterFilter::Tracker::~Tracker() {
+    // The counts are a histogram of the password
+    secureWipe(counts_, sizeof(counts_));
+}
+
+} // namespace utils
+} // namespace password_generator
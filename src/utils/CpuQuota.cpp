@@ -0,0 +1,114 @@
+#include "utils/CpuQuota.h"
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace password_generator {
+namespace utils {
+
+namespace {
+
+#if defined(__linux__)
+
+// Path of the process's cgroup for a v1 controller, or for v2 when
+// controller is empty; "/" when /proc/self/cgroup does not say
+std::string ownCgroup(const std::string& controller) {
+    std::ifstream in("/proc/self/cgroup");
+    std::string line;
+    while (std::getline(in, line)) {
+        // hierarchy-id:controller-list:path
+        const size_t first = line.find(':');
+        const size_t second = line.find(':', first + 1);
+        if (first == std::string::npos || second == std::string::npos) {
+            continue;
+        }
+        const std::string controllers = line.substr(first + 1, second - first - 1);
+        const bool matches = controller.empty()
+            ? controllers.empty()
+            : ("," + controllers + ",").find("," + controller + ",") != std::string::npos;
+        if (matches) {
+            return line.substr(second + 1);
+        }
+    }
+    return "/";
+}
+
+// The limit of the process's own cgroup, else the one at the root of the
+// mount, which is the container's own when cgroup namespaces are in use
+template <typename Read>
+size_t firstLimit(const std::string& mount, const std::string& cgroup, Read read) {
+    size_t cpus = cgroup != "/" ? read(mount + cgroup) : 0;
+    return cpus ? cpus : read(mount);
+}
+
+size_t cgroupV2Limit() {
+    return firstLimit("/sys/fs/cgroup", ownCgroup(""), [](const std::string& dir) -> size_t {
+        std::ifstream in(dir + "/cpu.max");
+        std::string line;
+        return std::getline(in, line) ? cpusFromCgroupV2(line) : 0;
+    });
+}
+
+size_t cgroupV1Limit() {
+    return firstLimit("/sys/fs/cgroup/cpu", ownCgroup("cpu"), [](const std::string& dir) -> size_t {
+        std::ifstream quota(dir + "/cpu.cfs_quota_us");
+        std::ifstream period(dir + "/cpu.cfs_period_us");
+        long long quotaMicros = 0;
+        long long periodMicros = 0;
+        if (!(quota >> quotaMicros) || !(period >> periodMicros)) {
+            return 0;
+        }
+        return cpusFromCgroupV1(quotaMicros, periodMicros);
+    });
+}
+
+#endif
+
+size_t tighter(size_t current, size_t limit) {
+    return limit > 0 && limit < current ? limit : current;
+}
+
+} // namespace
+
+size_t availableCpus() {
+    size_t cpus = std::thread::hardware_concurrency();
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (::sched_getaffinity(0, sizeof(set), &set) == 0) {
+        cpus = static_cast<size_t>(CPU_COUNT(&set));
+    }
+    cpus = tighter(cpus, cgroupV2Limit());
+    cpus = tighter(cpus, cgroupV1Limit());
+#endif
+    return cpus > 0 ? cpus : 1;
+}
+
+size_t cpusFromCgroupV2(std::string_view cpuMax) {
+    const size_t space = cpuMax.find(' ');
+    if (space == std::string_view::npos || cpuMax.substr(0, space) == "max") {
+        return 0;
+    }
+    try {
+        const long long quota = std::stoll(std::string(cpuMax.substr(0, space)));
+        const long long period = std::stoll(std::string(cpuMax.substr(space + 1)));
+        return cpusFromCgroupV1(quota, period);
+    } catch (const std::exception&) {
+        return 0;
+    }
+}
+
+size_t cpusFromCgroupV1(long long quotaMicros, long long periodMicros) {
+    if (quotaMicros <= 0 || periodMicros <= 0) {
+        return 0;
+    }
+    return static_cast<size_t>((quotaMicros + periodMicros - 1) / periodMicros);
+}
+
+} // namespace utils
+} // namespace password_generator
@@ -0,0 +1,103 @@
+#include "utils/Crc32.h"
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <nmmintrin.h>
+#define HAVE_X86_CRC32 1
+#endif
+
+namespace password_generator {
+namespace utils {
+
+namespace {
+
+// tables[k][b] is the CRC of byte b followed by k zero bytes, so eight
+// bytes fold in with eight independent lookups
+struct SlicingTables {
+    uint32_t tables[8][256];
+
+    constexpr explicit SlicingTables(uint32_t polynomial) : tables() {
+        for (uint32_t b = 0; b < 256; ++b) {
+            uint32_t crc = b;
+            for (int bit = 0; bit < 8; ++bit) {
+                crc = (crc >> 1) ^ (crc & 1 ? polynomial : 0);
+            }
+            tables[0][b] = crc;
+        }
+        for (uint32_t b = 0; b < 256; ++b) {
+            for (int k = 1; k < 8; ++k) {
+                const uint32_t previous = tables[k - 1][b];
+                tables[k][b] = (previous >> 8) ^ tables[0][previous & 0xFF];
+            }
+        }
+    }
+};
+
+constexpr SlicingTables CRC32_TABLES(0xEDB88320u);
+constexpr SlicingTables CRC32C_TABLES(0x82F63B78u);
+
+uint32_t slicingBy8(const SlicingTables& t, const uint8_t* bytes, size_t length, uint32_t crc) {
+    crc = ~crc;
+    while (length >= 8) {
+        uint32_t low, high;
+        std::memcpy(&low, bytes, 4);
+        std::memcpy(&high, bytes + 4, 4);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        low = __builtin_bswap32(low);
+        high = __builtin_bswap32(high);
+#endif
+        low ^= crc;
+        crc = t.tables[7][low & 0xFF] ^ t.tables[6][(low >> 8) & 0xFF] ^
+              t.tables[5][(low >> 16) & 0xFF] ^ t.tables[4][low >> 24] ^
+              t.tables[3][high & 0xFF] ^ t.tables[2][(high >> 8) & 0xFF] ^
+              t.tables[1][(high >> 16) & 0xFF] ^ t.tables[0][high >> 24];
+        bytes += 8;
+        length -= 8;
+    }
+    while (length-- > 0) {
+        crc = (crc >> 8) ^ t.tables[0][(crc ^ *bytes++) & 0xFF];
+    }
+    return ~crc;
+}
+
+#if defined(HAVE_X86_CRC32)
+__attribute__((target("sse4.2")))
+uint32_t crc32cHardware(const uint8_t* bytes, size_t length, uint32_t crc) {
+    uint64_t state = ~crc;
+    while (length >= 8) {
+        uint64_t word;
+        std::memcpy(&word, bytes, 8);
+        state = _mm_crc32_u64(state, word);
+        bytes += 8;
+        length -= 8;
+    }
+    uint32_t tail = static_cast<uint32_t>(state);
+    while (length-- > 0) {
+        tail = _mm_crc32_u8(tail, *bytes++);
+    }
+    return ~tail;
+}
+
+bool hasSse42() {
+    static const bool supported = __builtin_cpu_supports("sse4.2");
+    return supported;
+}
+#endif
+
+} // namespace
+
+uint32_t crc32(const void* data, size_t length, uint32_t crc) {
+    return slicingBy8(CRC32_TABLES, static_cast<const uint8_t*>(data), length, crc);
+}
+
+uint32_t crc32c(const void* data, size_t length, uint32_t crc) {
+#if defined(HAVE_X86_CRC32)
+    if (hasSse42()) {
+        return crc32cHardware(static_cast<const uint8_t*>(data), length, crc);
+    }
+#endif
+    return slicingBy8(CRC32C_TABLES, static_cast<const uint8_t*>(data), length, crc);
+}
+
+} // namespace utils
+} // namespace password_generator
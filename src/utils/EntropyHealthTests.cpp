@@ -0,0 +1,125 @@
+#include "utils/EntropyHealthTests.h"
+#include <algorithm>
+#include <cstring>
+
+namespace password_generator {
+namespace utils {
+
+namespace {
+
+constexpr uint64_t ONES = 0x0101010101010101ULL;
+constexpr uint64_t LOW7 = 0x7F7F7F7F7F7F7F7FULL;
+constexpr size_t WORD = sizeof(uint64_t);
+
+static_assert(EntropyHealthTests::RCT_CUTOFF > 2, "Runs of two are skipped over");
+static_assert(EntropyHealthTests::APT_WINDOW % WORD == 0, "Windows hold whole words");
+
+// Eight samples with sample k in bits 8k..8k+7 on any host
+uint64_t loadSamples(const uint8_t* samples) {
+    uint64_t word;
+    std::memcpy(&word, samples, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif
+    return word;
+}
+
+// High bit of each byte set exactly where that byte of x is zero; no carry
+// crosses a byte, so unlike the usual haszero trick there are no false hits
+uint64_t zeroBytes(uint64_t x) {
+    return ~(((x & LOW7) + LOW7) | x | LOW7);
+}
+
+} // namespace
+
+bool EntropyHealthTests::process(const uint8_t* samples, size_t count) {
+    bool healthy = true;
+    size_t i = 0;
+
+    // The rest of the current APT window is checked eight samples at a time
+    // without branching. If no sample repeats the two before it and the APT
+    // count stays below its cutoff, neither test can fire and only the
+    // final state is kept. Otherwise the span is replayed through step();
+    // for a healthy source that is about one window in 150. State is kept
+    // in locals so its stores need not be ordered against the loads
+    while (i + WORD <= count) {
+        const size_t words = aptPosition_ == 0 || rctRun_ == 0 ? 0
+            : std::min<size_t>(count - i, APT_WINDOW - aptPosition_) / WORD;
+        if (words == 0) {
+            healthy &= step(samples[i++]);
+            continue;
+        }
+
+        const uint64_t reference = ONES * aptReference_;
+        uint64_t last = rctLast_;
+        // High bit of byte 0 set if the run carried in is already two long
+        uint64_t carry = rctRun_ >= 2 ? 0x80 : 0;
+        uint64_t runsOfThree = 0;
+        uint32_t matches = aptMatches_;
+        for (size_t w = 0; w < words; ++w) {
+            const uint64_t word = loadSamples(samples + i + w * WORD);
+            // High bit of byte k set where sample k repeats sample k-1
+            const uint64_t repeats = zeroBytes(word ^ ((word << 8) | last));
+            runsOfThree |= repeats & ((repeats << 8) | carry);
+            carry = (repeats >> 63) << 7;
+            // Summing the 0/1 bytes by multiplication avoids a popcount call
+            // on targets without the instruction
+            matches += static_cast<uint32_t>(((zeroBytes(word ^ reference) >> 7) * ONES) >> 56);
+            last = word >> 56;
+        }
+
+        const size_t span = words * WORD;
+        if (runsOfThree == 0 && matches < APT_CUTOFF) {
+            rctLast_ = static_cast<uint8_t>(last);
+            rctRun_ = carry ? 2 : 1;
+            aptMatches_ = matches;
+            aptPosition_ = static_cast<uint32_t>((aptPosition_ + span) % APT_WINDOW);
+        } else {
+            for (size_t j = 0; j < span; ++j) {
+                healthy &= step(samples[i + j]);
+            }
+        }
+        i += span;
+    }
+    for (; i < count; ++i) {
+        healthy &= step(samples[i]);
+    }
+
+    counters_.samples += count;
+    return healthy;
+}
+
+bool EntropyHealthTests::step(uint8_t sample) {
+    bool healthy = true;
+
+    // Repetition count: too many identical samples in a row
+    if (rctRun_ != 0 && sample == rctLast_) {
+        if (++rctRun_ >= RCT_CUTOFF) {
+            ++counters_.rctFailures;
+            healthy = false;
+            rctRun_ = 1;
+        }
+    } else {
+        rctLast_ = sample;
+        rctRun_ = 1;
+    }
+
+    // Adaptive proportion: the first sample of a window recurs too often
+    if (aptPosition_ == 0) {
+        aptReference_ = sample;
+        aptMatches_ = 1;
+    } else if (sample == aptReference_) {
+        if (++aptMatches_ >= APT_CUTOFF) {
+            ++counters_.aptFailures;
+            healthy = false;
+            aptPosition_ = APT_WINDOW - 1; // Restart with the next sample
+        }
+    }
+    if (++aptPosition_ == APT_WINDOW) {
+        aptPosition_ = 0;
+    }
+    return healthy;
+}
+
+} // namespace utils
+} // namespace password_generator
@@ -0,0 +1,172 @@
+#include "utils/FeistelPermutation.h"
+#include "utils/SecureMemory.h"
+#include <stdexcept>
+
+namespace password_generator {
+namespace utils {
+
+namespace {
+
+// 128-bit values as four 32-bit limbs, least significant first, so that
+// multiplying and dividing by a 32-bit radix needs only 64-bit arithmetic
+struct Limbs {
+    uint32_t v[4];
+};
+
+Limbs toLimbs(uint64_t hi, uint64_t lo) {
+    return {{static_cast<uint32_t>(lo), static_cast<uint32_t>(lo >> 32),
+             static_cast<uint32_t>(hi), static_cast<uint32_t>(hi >> 32)}};
+}
+
+// Returns false if the product no longer fits in 128 bits
+bool multiply(Limbs& x, uint32_t factor) {
+    uint64_t carry = 0;
+    for (auto& limb : x.v) {
+        uint64_t product = static_cast<uint64_t>(limb) * factor + carry;
+        limb = static_cast<uint32_t>(product);
+        carry = product >> 32;
+    }
+    return carry == 0;
+}
+
+uint32_t divide(Limbs& x, uint32_t divisor) {
+    uint64_t remainder = 0;
+    for (int i = 3; i >= 0; --i) {
+        uint64_t current = (remainder << 32) | x.v[i];
+        x.v[i] = static_cast<uint32_t>(current / divisor);
+        remainder = current % divisor;
+    }
+    return static_cast<uint32_t>(remainder);
+}
+
+unsigned bitLength(uint64_t hi, uint64_t lo) {
+    unsigned bits = 0;
+    if (hi != 0) {
+        bits = 64;
+        lo = hi;
+    }
+    while (lo != 0) {
+        ++bits;
+        lo >>= 1;
+    }
+    return bits;
+}
+
+uint64_t lowMask(unsigned bits) {
+    return bits >= 64 ? ~uint64_t(0) : (uint64_t(1) << bits) - 1;
+}
+
+bool lessThan(uint64_t aHi, uint64_t aLo, uint64_t bHi, uint64_t bLo) {
+    return aHi < bHi || (aHi == bHi && aLo < bLo);
+}
+
+} // namespace
+
+FeistelPermutation::FeistelPermutation(const uint8_t (&key)[ChaCha20Drbg::KEY_SIZE],
+                                       uint32_t radix, size_t digits)
+    : radix_(radix), digits_(0) {
+    if (radix < 2) {
+        throw std::invalid_argument("Permutation radix must be at least 2");
+    }
+    if (digits == 0) {
+        throw std::invalid_argument("Permutation needs at least one digit");
+    }
+
+    for (int i = 0; i < 8; ++i) {
+        key_[i] = static_cast<uint32_t>(key[4 * i]) |
+                  (static_cast<uint32_t>(key[4 * i + 1]) << 8) |
+                  (static_cast<uint32_t>(key[4 * i + 2]) << 16) |
+                  (static_cast<uint32_t>(key[4 * i + 3]) << 24);
+    }
+
+    // Grow the domain one digit at a time until it would exceed 128 bits
+    Limbs domain = {{1, 0, 0, 0}};
+    while (digits_ < digits) {
+        Limbs next = domain;
+        if (!multiply(next, radix)) {
+            break;
+        }
+        domain = next;
+        ++digits_;
+    }
+    domainLo_ = static_cast<uint64_t>(domain.v[0]) | (static_cast<uint64_t>(domain.v[1]) << 32);
+    domainHi_ = static_cast<uint64_t>(domain.v[2]) | (static_cast<uint64_t>(domain.v[3]) << 32);
+
+    // Width of the largest value (domain - 1), rounded up to an even count
+    uint64_t maxLo = domainLo_ - 1;
+    uint64_t maxHi = domainHi_ - (domainLo_ == 0 ? 1 : 0);
+    unsigned bits = bitLength(maxHi, maxLo);
+    bits += bits & 1;
+    halfBits_ = bits / 2;
+}
+
+FeistelPermutation::~FeistelPermutation() {
+    secureWipe(key_, sizeof(key_));
+}
+
+bool FeistelPermutation::contains(uint64_t counter) const {
+    return lessThan(0, counter, domainHi_, domainLo_);
+}
+
+uint64_t FeistelPermutation::round(int index, uint64_t half) const {
+    // Round number, half-width and input half select a unique ChaCha20 block
+    const uint32_t nonce[3] = {static_cast<uint32_t>(half),
+                               static_cast<uint32_t>(half >> 32),
+                               halfBits_};
+    uint8_t block[ChaCha20Drbg::BLOCK_SIZE];
+    ChaCha20Drbg::block(key_, static_cast<uint32_t>(index), nonce, block);
+
+    uint64_t value = 0;
+    for (int i = 7; i >= 0; --i) {
+        value = (value << 8) | block[i];
+    }
+    secureWipe(block, sizeof(block));
+    return value & lowMask(halfBits_);
+}
+
+void FeistelPermutation::encrypt(uint64_t& hi, uint64_t& lo) const {
+    // Split the value into left and right halves of halfBits_ each
+    const uint64_t mask = lowMask(halfBits_);
+    uint64_t left, right;
+    if (halfBits_ == 64) {
+        left = hi;
+        right = lo;
+    } else {
+        left = (lo >> halfBits_) | (hi << (64 - halfBits_));
+        right = lo & mask;
+    }
+
+    for (int i = 0; i < ROUNDS; ++i) {
+        uint64_t next = left ^ round(i, right);
+        left = right;
+        right = next & mask;
+    }
+
+    if (halfBits_ == 64) {
+        hi = left;
+        lo = right;
+    } else {
+        lo = (left << halfBits_) | right;
+        hi = left >> (64 - halfBits_);
+    }
+}
+
+void FeistelPermutation::permute(uint64_t counter, uint32_t* digits) const {
+    if (!contains(counter)) {
+        throw std::out_of_range("Counter outside permutation domain");
+    }
+
+    uint64_t hi = 0;
+    uint64_t lo = counter;
+    do {
+        encrypt(hi, lo);
+    } while (!lessThan(hi, lo, domainHi_, domainLo_));
+
+    Limbs value = toLimbs(hi, lo);
+    for (size_t i = 0; i < digits_; ++i) {
+        digits[i] = divide(value, radix_);
+    }
+}
+
+} // namespace utils
+} // namespace password_generator
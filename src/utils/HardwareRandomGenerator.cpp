@@ -0,0 +1,224 @@
+#include "utils/HardwareRandomGenerator.h"
+#include "utils/EntropyHealthTests.h"
+#include "utils/IndexSampler.h"
+#include "utils/SecureMemory.h"
+#include "utils/SystemEntropy.h"
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <cpuid.h>
+#include <immintrin.h>
+#define HAVE_X86_RNG_INSTRUCTIONS 1
+#endif
+
+namespace password_generator {
+namespace utils {
+
+namespace {
+
+// Intel recommends 10 RDRAND retries before reporting failure. RDSEED fails
+// transiently under contention, so it gets a longer budget with a pause.
+constexpr int RDRAND_RETRIES = 10;
+constexpr int RDSEED_RETRIES = 128;
+
+// Consecutive alarming blocks tolerated before the source is deemed broken
+constexpr int MAX_CONSECUTIVE_FAILURES = 8;
+
+constexpr size_t BLOCK_WORDS = EntropyHealthTests::APT_WINDOW / sizeof(uint64_t);
+
+#if defined(HAVE_X86_RNG_INSTRUCTIONS)
+__attribute__((target("rdrnd")))
+bool rdrand64(uint64_t& value, uint64_t& retries) {
+    unsigned long long v;
+    for (int i = 0; i < RDRAND_RETRIES; ++i) {
+        if (_rdrand64_step(&v)) {
+            value = v;
+            return true;
+        }
+        ++retries;
+    }
+    return false;
+}
+
+__attribute__((target("rdseed")))
+bool rdseed64(uint64_t& value, uint64_t& retries) {
+    unsigned long long v;
+    for (int i = 0; i < RDSEED_RETRIES; ++i) {
+        if (_rdseed64_step(&v)) {
+            value = v;
+            return true;
+        }
+        ++retries;
+        _mm_pause();
+    }
+    return false;
+}
+#endif
+
+} // namespace
+
+class HardwareRandomGenerator::Impl {
+public:
+    Source source;
+    Statistics stats;
+    EntropyHealthTests health;
+    SamplerStats samplerStats;
+    uint64_t block[BLOCK_WORDS];
+    size_t position = sizeof(block);
+    
+    explicit Impl(Source preferred) : source(select(preferred)) {}
+    
+    ~Impl() {
+        secureWipe(block, sizeof(block));
+    }
+    
+    static Source select(Source preferred) {
+        if (preferred == Source::RdSeed && hasRdSeed()) {
+            return Source::RdSeed;
+        }
+        if (preferred != Source::System && hasRdRand()) {
+            return Source::RdRand;
+        }
+        return Source::System;
+    }
+    
+    // Fill one block from the selected source; false if retries ran out
+    bool drawBlock() {
+#if defined(HAVE_X86_RNG_INSTRUCTIONS)
+        if (source != Source::System) {
+            for (size_t i = 0; i < BLOCK_WORDS; ++i) {
+                bool ok = source == Source::RdSeed
+                    ? rdseed64(block[i], stats.retries)
+                    : rdrand64(block[i], stats.retries);
+                if (!ok) {
+                    return false;
+                }
+            }
+            stats.wordsDrawn += BLOCK_WORDS;
+            return true;
+        }
+#endif
+        return false;
+    }
+    
+    void refill() {
+        for (int attempt = 0; attempt < MAX_CONSECUTIVE_FAILURES; ++attempt) {
+            if (!drawBlock()) {
+                if (source != Source::System) {
+                    ++stats.fallbackBlocks;
+                }
+                fillSystemEntropy(block, sizeof(block));
+            }
+            
+            if (health.process(reinterpret_cast<const uint8_t*>(block), sizeof(block))) {
+                position = 0;
+                return;
+            }
+            ++stats.discardedBlocks;
+        }
+        secureWipe(block, sizeof(block));
+        throw std::runtime_error("Entropy source failed continuous health tests");
+    }
+    
+    void take(void* out, size_t length) {
+        auto* dst = static_cast<uint8_t*>(out);
+        auto* bytes = reinterpret_cast<uint8_t*>(block);
+        while (length > 0) {
+            if (position == sizeof(block)) {
+                refill();
+            }
+            size_t chunk = sizeof(block) - position;
+            if (chunk > length) {
+                chunk = length;
+            }
+            std::memcpy(dst, bytes + position, chunk);
+            std::memset(bytes + position, 0, chunk);
+            position += chunk;
+            dst += chunk;
+            length -= chunk;
+        }
+    }
+    
+    void sample(uint32_t* values, size_t count) {
+        auto next = [this]() {
+            uint64_t word;
+            take(&word, sizeof(word));
+            return word;
+        };
+        sampleBounded(next, values, count, samplerStats);
+    }
+};
+
+HardwareRandomGenerator::HardwareRandomGenerator(Source preferred)
+    : pImpl(std::make_unique<Impl>(preferred)) {}
+
+HardwareRandomGenerator::~HardwareRandomGenerator() = default;
+
+bool HardwareRandomGenerator::hasRdRand() {
+#if defined(HAVE_X86_RNG_INSTRUCTIONS)
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return false;
+    }
+    return (ecx & (1u << 30)) != 0;
+#else
+    return false;
+#endif
+}
+
+bool HardwareRandomGenerator::hasRdSeed() {
+#if defined(HAVE_X86_RNG_INSTRUCTIONS)
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        return false;
+    }
+    return (ebx & (1u << 18)) != 0;
+#else
+    return false;
+#endif
+}
+
+int HardwareRandomGenerator::generate(int min, int max) {
+    if (min > max) {
+        throw std::invalid_argument("min must be <= max");
+    }
+    uint32_t value = static_cast<uint32_t>(max - min + 1);
+    pImpl->sample(&value, 1);
+    return min + static_cast<int>(value);
+}
+
+void HardwareRandomGenerator::generateBounded(uint32_t* values, size_t count) {
+    pImpl->sample(values, count);
+}
+
+void HardwareRandomGenerator::generateIndices(uint32_t* out, size_t count, uint32_t bound) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = bound;
+    }
+    pImpl->sample(out, count);
+}
+
+void HardwareRandomGenerator::fillBytes(void* out, size_t length) {
+    pImpl->take(out, length);
+}
+
+HardwareRandomGenerator::Source HardwareRandomGenerator::getSource() const {
+    return pImpl->source;
+}
+
+HardwareRandomGenerator::Statistics HardwareRandomGenerator::getStatistics() const {
+    Statistics stats = pImpl->stats;
+    const auto& counters = pImpl->health.getCounters();
+    stats.samplesTested = counters.samples;
+    stats.rctFailures = counters.rctFailures;
+    stats.aptFailures = counters.aptFailures;
+    return stats;
+}
+
+SamplerStats HardwareRandomGenerator::getSamplerStats() const {
+    return pImpl->samplerStats;
+}
+
+} // namespace utils
+} // namespace password_generator
@@ -0,0 +1,43 @@
+#include "utils/KeyedRandomGenerator.h"
+#include <stdexcept>
+
+namespace password_generator {
+namespace utils {
+
+KeyedRandomGenerator::KeyedRandomGenerator(const uint8_t (&key)[ChaCha20Drbg::KEY_SIZE])
+    : drbg_(key) {}
+
+KeyedRandomGenerator::~KeyedRandomGenerator() = default;
+
+int KeyedRandomGenerator::generate(int min, int max) {
+    if (min > max) {
+        throw std::invalid_argument("min must be <= max");
+    }
+
+    uint32_t value = static_cast<uint32_t>(max - min + 1);
+    generateBounded(&value, 1);
+    return min + static_cast<int>(value);
+}
+
+void KeyedRandomGenerator::generateBounded(uint32_t* values, size_t count) {
+    auto next = [this]() { return drbg_.next64(); };
+    sampleBounded(next, values, count, stats_);
+}
+
+void KeyedRandomGenerator::generateIndices(uint32_t* out, size_t count, uint32_t bound) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = bound;
+    }
+    generateBounded(out, count);
+}
+
+void KeyedRandomGenerator::fillBytes(void* out, size_t length) {
+    drbg_.fill(out, length);
+}
+
+void KeyedRandomGenerator::rekey(const uint8_t (&key)[ChaCha20Drbg::KEY_SIZE]) {
+    drbg_.rekey(key);
+}
+
+} // namespace utils
+} // namespace password_generator
@@ -0,0 +1,258 @@
+#include "utils/PasswordBatch.h"
+#include "utils/SecureMemory.h"
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#define HAVE_ANONYMOUS_MAPPINGS 1
+#endif
+
+namespace password_generator {
+namespace utils {
+
+namespace {
+
+constexpr size_t HUGE_PAGE = size_t(2) << 20;
+
+// Staging buffer for writeLines()
+constexpr size_t WRITE_BLOCK = size_t(64) << 10;
+
+struct Arena {
+    char* data;
+    size_t capacity;
+    bool mapped;
+    bool hugePages;
+};
+
+Arena allocateArena(size_t bytes, PasswordBatch::Backing backing) {
+#if defined(HAVE_ANONYMOUS_MAPPINGS)
+    if (bytes >= PasswordBatch::ARENA_MAP_THRESHOLD) {
+        const bool huge = backing == PasswordBatch::Backing::HugePages;
+        const size_t size = huge ? (bytes + HUGE_PAGE - 1) / HUGE_PAGE * HUGE_PAGE : bytes;
+        void* mem = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+                           -1, 0);
+        if (mem == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+#if defined(MADV_DONTDUMP)
+        ::madvise(mem, size, MADV_DONTDUMP);
+#endif
+        bool hugePages = false;
+#if defined(MADV_HUGEPAGE)
+        hugePages = huge && ::madvise(mem, size, MADV_HUGEPAGE) == 0;
+#endif
+        return {static_cast<char*>(mem), size, true, hugePages};
+    }
+#else
+    (void)backing;
+#endif
+    void* mem = std::calloc(bytes > 0 ? bytes : 1, 1);
+    if (!mem) {
+        throw std::bad_alloc();
+    }
+    return {static_cast<char*>(mem), bytes, false, false};
+}
+
+void freeArena(char* data, size_t capacity, bool mapped) noexcept {
+#if defined(HAVE_ANONYMOUS_MAPPINGS)
+    if (mapped) {
+        ::munmap(data, capacity);
+        return;
+    }
+#else
+    (void)capacity;
+    (void)mapped;
+#endif
+    std::free(data);
+}
+
+} // namespace
+
+PasswordBatch::PasswordBatch(size_t count, size_t length, Backing backing)
+    : backing_(backing) {
+    if (length > 0 && count > SIZE_MAX / length) {
+        throw std::bad_alloc();
+    }
+    grow(count * length);
+    used_ = count * length;
+    count_ = count;
+    length_ = length;
+}
+
+PasswordBatch::~PasswordBatch() {
+    release();
+}
+
+PasswordBatch::PasswordBatch(PasswordBatch&& other) noexcept
+    : arena_(std::exchange(other.arena_, nullptr)),
+      capacity_(std::exchange(other.capacity_, 0)),
+      used_(std::exchange(other.used_, 0)),
+      count_(std::exchange(other.count_, 0)),
+      length_(std::exchange(other.length_, 0)),
+      reservedCount_(std::exchange(other.reservedCount_, 0)),
+      backing_(other.backing_),
+      mapped_(std::exchange(other.mapped_, false)),
+      hugePages_(std::exchange(other.hugePages_, false)),
+      offsets_(std::move(other.offsets_)) {
+    other.offsets_.clear();
+}
+
+PasswordBatch& PasswordBatch::operator=(PasswordBatch&& other) noexcept {
+    if (this != &other) {
+        release();
+        arena_ = std::exchange(other.arena_, nullptr);
+        capacity_ = std::exchange(other.capacity_, 0);
+        used_ = std::exchange(other.used_, 0);
+        count_ = std::exchange(other.count_, 0);
+        length_ = std::exchange(other.length_, 0);
+        reservedCount_ = std::exchange(other.reservedCount_, 0);
+        backing_ = other.backing_;
+        mapped_ = std::exchange(other.mapped_, false);
+        hugePages_ = std::exchange(other.hugePages_, false);
+        offsets_ = std::move(other.offsets_);
+        other.offsets_.clear();
+    }
+    return *this;
+}
+
+void PasswordBatch::reserve(size_t count, size_t bytes) {
+    if (bytes > SIZE_MAX - used_ || count > SIZE_MAX - count_) {
+        throw std::bad_alloc();
+    }
+    if (used_ + bytes > capacity_ || !arena_) {
+        grow(used_ + bytes);
+    }
+    reservedCount_ = count_ + count;
+    if (!offsets_.empty()) {
+        offsets_.reserve(reservedCount_);
+    }
+}
+
+char* PasswordBatch::append(size_t length) {
+    ensureRoom(length);
+
+    if (offsets_.empty() && count_ > 0 && length != length_) {
+        // First odd length: spell out the offsets implied so far
+        offsets_.reserve(reservedCount_ > count_ ? reservedCount_ : count_ + 1);
+        for (size_t i = 1; i <= count_; ++i) {
+            offsets_.push_back(static_cast<uint64_t>(i * length_));
+        }
+    }
+    if (!offsets_.empty()) {
+        offsets_.push_back(static_cast<uint64_t>(used_ + length));
+    } else {
+        length_ = length;
+    }
+
+    char* slot = arena_ + used_;
+    used_ += length;
+    ++count_;
+    return slot;
+}
+
+void PasswordBatch::append(std::string_view password) {
+    char* slot = append(password.size());
+    std::memcpy(slot, password.data(), password.size());
+}
+
+char* PasswordBatch::appendUniform(size_t count, size_t length) {
+    if (length > 0 && count > (SIZE_MAX - used_) / length) {
+        throw std::bad_alloc();
+    }
+    if (!offsets_.empty() || (count_ > 0 && length != length_)) {
+        // Mixed lengths: every password gets its offset
+        reserve(count, count * length);
+        char* slot = arena_ + used_;
+        for (size_t i = 0; i < count; ++i) {
+            append(length);
+        }
+        return slot;
+    }
+    ensureRoom(count * length);
+    char* slot = arena_ + used_;
+    used_ += count * length;
+    count_ += count;
+    length_ = length;
+    return slot;
+}
+
+void PasswordBatch::writeLines(std::ostream& out, char separator) const {
+    char block[WRITE_BLOCK];
+    size_t filled = 0;
+    for (size_t i = 0; i < count_; ++i) {
+        const std::string_view password = (*this)[i];
+        if (filled + password.size() + 1 > WRITE_BLOCK) {
+            out.write(block, static_cast<std::streamsize>(filled));
+            filled = 0;
+        }
+        if (password.size() + 1 > WRITE_BLOCK) {
+            out.write(password.data(), static_cast<std::streamsize>(password.size()));
+            out.put(separator);
+            continue;
+        }
+        std::memcpy(block + filled, password.data(), password.size());
+        filled += password.size();
+        block[filled++] = separator;
+    }
+    out.write(block, static_cast<std::streamsize>(filled));
+    secureWipe(block, sizeof(block));
+}
+
+void PasswordBatch::wipe() noexcept {
+    if (arena_) {
+        secureWipe(arena_, used_);
+    }
+}
+
+void PasswordBatch::clear() noexcept {
+    wipe();
+    used_ = 0;
+    count_ = 0;
+    length_ = 0;
+    reservedCount_ = 0;
+    offsets_.clear();
+}
+
+void PasswordBatch::ensureRoom(size_t bytes) {
+    if (bytes > SIZE_MAX - used_) {
+        throw std::bad_alloc();
+    }
+    if (used_ + bytes > capacity_ || !arena_) {
+        // Doubling keeps appends amortized constant
+        const size_t doubled = capacity_ > SIZE_MAX / 2 ? SIZE_MAX : capacity_ * 2;
+        grow(used_ + bytes > doubled ? used_ + bytes : doubled);
+    }
+}
+
+void PasswordBatch::grow(size_t bytes) {
+    const Arena arena = allocateArena(bytes, backing_);
+    if (arena_) {
+        std::memcpy(arena.data, arena_, used_);
+        secureWipe(arena_, used_);
+        freeArena(arena_, capacity_, mapped_);
+    }
+    arena_ = arena.data;
+    capacity_ = arena.capacity;
+    mapped_ = arena.mapped;
+    hugePages_ = arena.hugePages;
+}
+
+void PasswordBatch::release() noexcept {
+    if (arena_) {
+        secureWipe(arena_, used_);
+        freeArena(arena_, capacity_, mapped_);
+        arena_ = nullptr;
+    }
+    capacity_ = 0;
+    used_ = 0;
+    count_ = 0;
+    length_ = 0;
+    reservedCount_ = 0;
+    offsets_.clear();
+}
+
+} // namespace utils
+} // namespace password_generator
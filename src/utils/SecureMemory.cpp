@@ -0,0 +1,27 @@
+#include "utils/SecureMemory.h"
+#include <cstring>
+
+#if defined(__GLIBC__) || defined(__OpenBSD__) || defined(__FreeBSD__)
+#include <strings.h>
+#define HAVE_EXPLICIT_BZERO 1
+#endif
+
+namespace password_generator {
+namespace utils {
+
+void secureWipe(void* data, size_t length) noexcept {
+    if (data == nullptr || length == 0) {
+        return;
+    }
+#if defined(HAVE_EXPLICIT_BZERO)
+    ::explicit_bzero(data, length);
+#else
+    volatile unsigned char* p = static_cast<volatile unsigned char*>(data);
+    while (length--) {
+        *p++ = 0;
+    }
+#endif
+}
+
+} // namespace utils
+} // namespace password_generator
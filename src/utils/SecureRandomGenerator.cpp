@@ -1,29 +1,95 @@
 #include "utils/SecureRandomGenerator.h"
+#include "utils/ChaCha20Drbg.h"
+#include "utils/HardwareRandomGenerator.h"
+#include "utils/IndexSampler.h"
 #include <random>
 #include <stdexcept>
 #include <cstdint>
+#include <cstring>
 
 namespace password_generator {
 namespace utils {
 
 class SecureRandomGenerator::Impl {
 public:
-    std::random_device rd;
+    Backend backend;
+    std::unique_ptr<ChaCha20Drbg> drbg;
+    std::unique_ptr<HardwareRandomGenerator> hw;
+    std::unique_ptr<std::random_device> rd;
+    SamplerStats stats;
     
-    Impl() {
-        // Verify random_device entropy
-        if (rd.entropy() == 0) {
-            throw std::runtime_error("Hardware random number generator not available");
+    explicit Impl(Backend b) : backend(b) {
+        switch (backend) {
+            case Backend::ChaCha20:
+                drbg = std::make_unique<ChaCha20Drbg>();
+                break;
+            case Backend::Hardware:
+                hw = std::make_unique<HardwareRandomGenerator>(
+                    HardwareRandomGenerator::Source::RdRand);
+                break;
+            case Backend::HardwareSeed:
+                hw = std::make_unique<HardwareRandomGenerator>(
+                    HardwareRandomGenerator::Source::RdSeed);
+                break;
+            case Backend::RandomDevice:
+                // random_device::entropy() is only an estimate (libstdc++ reports 0
+                // for several healthy sources), so it is not checked. The
+                // constructor already throws if the device cannot be opened.
+                rd = std::make_unique<std::random_device>();
+                break;
+        }
+    }
+    
+    void fill(void* out, size_t length) {
+        if (drbg) {
+            drbg->fill(out, length);
+            return;
+        }
+        if (hw) {
+            hw->fillBytes(out, length);
+            return;
+        }
+        auto* bytes = static_cast<uint8_t*>(out);
+        while (length > 0) {
+            uint32_t value = static_cast<uint32_t>((*rd)());
+            size_t chunk = length < sizeof(value) ? length : sizeof(value);
+            std::memcpy(bytes, &value, chunk);
+            bytes += chunk;
+            length -= chunk;
+        }
+    }
+    
+    // Pack as many draws as possible into each 64-bit word from the backend
+    void sample(uint32_t* values, size_t count) {
+        if (drbg) {
+            auto next = [this]() { return drbg->next64(); };
+            sampleBounded(next, values, count, stats);
+        } else if (hw) {
+            auto next = [this]() {
+                uint64_t word;
+                hw->fillBytes(&word, sizeof(word));
+                return word;
+            };
+            sampleBounded(next, values, count, stats);
+        } else {
+            auto next = [this]() {
+                uint64_t hi = static_cast<uint32_t>((*rd)());
+                return (hi << 32) | static_cast<uint32_t>((*rd)());
+            };
+            sampleBounded(next, values, count, stats);
         }
     }
     
     void reseed() {
         // Random device doesn't need reseeding - each call is independent
+        if (drbg) {
+            drbg->reseed();
+        }
     }
 };
 
-SecureRandomGenerator::SecureRandomGenerator()
-    : pImpl(std::make_unique<Impl>()) {}
+SecureRandomGenerator::SecureRandomGenerator(Backend backend)
+    : pImpl(std::make_unique<Impl>(backend)) {}
 
 SecureRandomGenerator::~SecureRandomGenerator() = default;
 
@@ -32,22 +98,38 @@ int SecureRandomGenerator::generate(int min, int max) {
         throw std::invalid_argument("min must be <= max");
     }
     
-    // Use random_device directly for cryptographic security
     // Generate uniformly distributed random number in range [min, max]
-    const uint32_t range = static_cast<uint32_t>(max - min + 1);
-    const uint32_t max_valid = UINT32_MAX - (UINT32_MAX % range);
-    
-    uint32_t value;
-    do {
-        value = pImpl->rd();
-    } while (value >= max_valid); // Reject bias-inducing values
-    
-    return min + (value % range);
+    uint32_t value = static_cast<uint32_t>(max - min + 1);
+    pImpl->sample(&value, 1);
+    return min + static_cast<int>(value);
+}
+
+void SecureRandomGenerator::generateBounded(uint32_t* values, size_t count) {
+    pImpl->sample(values, count);
+}
+
+void SecureRandomGenerator::generateIndices(uint32_t* out, size_t count, uint32_t bound) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = bound;
+    }
+    pImpl->sample(out, count);
+}
+
+void SecureRandomGenerator::fillBytes(void* out, size_t length) {
+    pImpl->fill(out, length);
 }
 
 void SecureRandomGenerator::reseed() {
     pImpl->reseed();
 }
 
+SecureRandomGenerator::Backend SecureRandomGenerator::getBackend() const {
+    return pImpl->backend;
+}
+
+SamplerStats SecureRandomGenerator::getSamplerStats() const {
+    return pImpl->stats;
+}
+
 } // namespace utils
-} // namespace password_generator
\ No newline at end of file
+} // namespace password_generator
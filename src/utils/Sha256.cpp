@@ -0,0 +1,232 @@
+#include "utils/Sha256.h"
+#include "utils/SecureMemory.h"
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace password_generator {
+namespace utils {
+
+namespace {
+
+const uint32_t K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+inline uint32_t rotr32(uint32_t x, int n) {
+    return (x >> n) | (x << (32 - n));
+}
+
+inline uint32_t load32be(const uint8_t* p) {
+    return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) |
+           (static_cast<uint32_t>(p[2]) << 8) | static_cast<uint32_t>(p[3]);
+}
+
+inline void store32be(uint8_t* p, uint32_t v) {
+    p[0] = static_cast<uint8_t>(v >> 24);
+    p[1] = static_cast<uint8_t>(v >> 16);
+    p[2] = static_cast<uint8_t>(v >> 8);
+    p[3] = static_cast<uint8_t>(v);
+}
+
+} // namespace
+
+Sha256::Sha256() : buffered_(0), totalLength_(0) {
+    static const uint32_t initial[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+    };
+    std::memcpy(state_, initial, sizeof(state_));
+}
+
+Sha256::~Sha256() {
+    secureWipe(state_, sizeof(state_));
+    secureWipe(buffer_, sizeof(buffer_));
+}
+
+void Sha256::compress(const uint8_t* block) {
+    uint32_t w[64];
+    for (int i = 0; i < 16; ++i) {
+        w[i] = load32be(block + 4 * i);
+    }
+    for (int i = 16; i < 64; ++i) {
+        uint32_t s0 = rotr32(w[i - 15], 7) ^ rotr32(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = rotr32(w[i - 2], 17) ^ rotr32(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = state_[0], b = state_[1], c = state_[2], d = state_[3];
+    uint32_t e = state_[4], f = state_[5], g = state_[6], h = state_[7];
+
+    for (int i = 0; i < 64; ++i) {
+        uint32_t S1 = rotr32(e, 6) ^ rotr32(e, 11) ^ rotr32(e, 25);
+        uint32_t ch = (e & f) ^ (~e & g);
+        uint32_t t1 = h + S1 + ch + K[i] + w[i];
+        uint32_t S0 = rotr32(a, 2) ^ rotr32(a, 13) ^ rotr32(a, 22);
+        uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+        uint32_t t2 = S0 + maj;
+        h = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + t2;
+    }
+
+    state_[0] += a; state_[1] += b; state_[2] += c; state_[3] += d;
+    state_[4] += e; state_[5] += f; state_[6] += g; state_[7] += h;
+
+    secureWipe(w, sizeof(w));
+}
+
+void Sha256::update(const void* data, size_t length) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    totalLength_ += length;
+
+    if (buffered_ > 0) {
+        size_t take = BLOCK_SIZE - buffered_;
+        if (take > length) {
+            take = length;
+        }
+        std::memcpy(buffer_ + buffered_, bytes, take);
+        buffered_ += take;
+        bytes += take;
+        length -= take;
+        if (buffered_ == BLOCK_SIZE) {
+            compress(buffer_);
+            buffered_ = 0;
+        }
+    }
+
+    while (length >= BLOCK_SIZE) {
+        compress(bytes);
+        bytes += BLOCK_SIZE;
+        length -= BLOCK_SIZE;
+    }
+
+    if (length > 0) {
+        std::memcpy(buffer_, bytes, length);
+        buffered_ = length;
+    }
+}
+
+Sha256::Digest Sha256::finish() {
+    const uint64_t bitLength = totalLength_ * 8;
+
+    uint8_t padding[BLOCK_SIZE * 2] = {0x80};
+    size_t padLength = (buffered_ < 56 ? 56 : 120) - buffered_;
+    update(padding, padLength);
+
+    uint8_t lengthBytes[8];
+    for (int i = 0; i < 8; ++i) {
+        lengthBytes[i] = static_cast<uint8_t>(bitLength >> (56 - 8 * i));
+    }
+    update(lengthBytes, sizeof(lengthBytes));
+
+    Digest digest;
+    for (int i = 0; i < 8; ++i) {
+        store32be(digest.data() + 4 * i, state_[i]);
+    }
+    return digest;
+}
+
+Sha256::Digest Sha256::hash(const void* data, size_t length) {
+    Sha256 sha;
+    sha.update(data, length);
+    return sha.finish();
+}
+
+namespace {
+
+/**
+ * HMAC with the padded key schedules computed once, so PBKDF2 iterations
+ * only pay for the two compression runs per block.
+ */
+class HmacSha256 {
+public:
+    HmacSha256(const void* key, size_t keyLength) {
+        uint8_t block[Sha256::BLOCK_SIZE] = {0};
+        if (keyLength > Sha256::BLOCK_SIZE) {
+            Sha256::Digest hashed = Sha256::hash(key, keyLength);
+            std::memcpy(block, hashed.data(), hashed.size());
+            secureWipe(hashed.data(), hashed.size());
+        } else if (keyLength > 0) {
+            std::memcpy(block, key, keyLength);
+        }
+
+        uint8_t pad[Sha256::BLOCK_SIZE];
+        for (size_t i = 0; i < Sha256::BLOCK_SIZE; ++i) {
+            pad[i] = block[i] ^ 0x36;
+        }
+        inner_.update(pad, sizeof(pad));
+        for (size_t i = 0; i < Sha256::BLOCK_SIZE; ++i) {
+            pad[i] = block[i] ^ 0x5c;
+        }
+        outer_.update(pad, sizeof(pad));
+
+        secureWipe(pad, sizeof(pad));
+        secureWipe(block, sizeof(block));
+    }
+
+    Sha256::Digest mac(const void* data, size_t length) const {
+        Sha256 inner = inner_;
+        inner.update(data, length);
+        Sha256::Digest innerDigest = inner.finish();
+
+        Sha256 outer = outer_;
+        outer.update(innerDigest.data(), innerDigest.size());
+        secureWipe(innerDigest.data(), innerDigest.size());
+        return outer.finish();
+    }
+
+private:
+    Sha256 inner_;
+    Sha256 outer_;
+};
+
+} // namespace
+
+Sha256::Digest hmacSha256(const void* key, size_t keyLength,
+                          const void* data, size_t dataLength) {
+    return HmacSha256(key, keyLength).mac(data, dataLength);
+}
+
+void pbkdf2HmacSha256(const void* password, size_t passwordLength,
+                      const void* salt, size_t saltLength,
+                      uint32_t iterations, uint8_t* out, size_t outLength) {
+    if (iterations == 0) {
+        throw std::invalid_argument("PBKDF2 requires at least one iteration");
+    }
+
+    const HmacSha256 prf(password, passwordLength);
+    std::vector<uint8_t> saltBlock(static_cast<const uint8_t*>(salt),
+                                   static_cast<const uint8_t*>(salt) + saltLength);
+    saltBlock.resize(saltLength + 4);
+
+    for (uint32_t blockIndex = 1; outLength > 0; ++blockIndex) {
+        store32be(saltBlock.data() + saltLength, blockIndex);
+
+        Sha256::Digest u = prf.mac(saltBlock.data(), saltBlock.size());
+        Sha256::Digest t = u;
+        for (uint32_t i = 1; i < iterations; ++i) {
+            u = prf.mac(u.data(), u.size());
+            for (size_t j = 0; j < t.size(); ++j) {
+                t[j] ^= u[j];
+            }
+        }
+
+        size_t take = outLength < t.size() ? outLength : t.size();
+        std::memcpy(out, t.data(), take);
+        out += take;
+        outLength -= take;
+
+        secureWipe(u.data(), u.size());
+        secureWipe(t.data(), t.size());
+    }
+}
+
+} // namespace utils
+} // namespace password_generator
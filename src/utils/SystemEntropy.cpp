@@ -0,0 +1,57 @@
+#include "utils/SystemEntropy.h"
+#include <stdexcept>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(__linux__)
+#include <sys/random.h>
+#elif defined(__APPLE__)
+#include <sys/random.h>
+#else
+#include <random>
+#endif
+
+namespace password_generator {
+namespace utils {
+
+void fillSystemEntropy(void* buffer, size_t length) {
+    auto* out = static_cast<uint8_t*>(buffer);
+
+#if defined(__linux__)
+    while (length > 0) {
+        ssize_t n = ::getrandom(out, length, 0);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::runtime_error("getrandom failed: " + std::string(std::strerror(errno)));
+        }
+        out += n;
+        length -= static_cast<size_t>(n);
+    }
+#elif defined(__APPLE__)
+    // getentropy is limited to 256 bytes per call
+    while (length > 0) {
+        size_t chunk = length < 256 ? length : 256;
+        if (::getentropy(out, chunk) != 0) {
+            throw std::runtime_error("getentropy failed: " + std::string(std::strerror(errno)));
+        }
+        out += chunk;
+        length -= chunk;
+    }
+#else
+    std::random_device rd;
+    while (length > 0) {
+        uint32_t value = rd();
+        size_t chunk = length < sizeof(value) ? length : sizeof(value);
+        std::memcpy(out, &value, chunk);
+        out += chunk;
+        length -= chunk;
+    }
+#endif
+}
+
+} // namespace utils
+} // namespace password_generator
@@ -0,0 +1,168 @@
+#include "utils/ThreadLocalRandomGenerator.h"
+#include "utils/IndexSampler.h"
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define HAVE_POSIX_FORK 1
+#endif
+
+namespace password_generator {
+namespace utils {
+
+namespace {
+
+// Bumped in the child after every fork(); states from an older generation reseed
+std::atomic<uint64_t> g_forkGeneration{0};
+std::atomic<size_t> g_liveStates{0};
+
+#if defined(HAVE_POSIX_FORK)
+void onForkChild() {
+    g_forkGeneration.fetch_add(1, std::memory_order_relaxed);
+}
+
+void registerForkHandler() {
+    static const int registered = pthread_atfork(nullptr, nullptr, onForkChild);
+    (void)registered;
+}
+#endif
+
+/**
+ * Per-thread state. A zeroed instance means "not initialized", which is
+ * exactly what a MADV_WIPEONFORK page looks like in a forked child.
+ */
+struct ThreadState {
+    ChaCha20Drbg drbg;
+    uint64_t forkGeneration;
+    uint32_t live;
+};
+
+class ThreadStateHolder {
+public:
+    ThreadStateHolder() : state_(allocate()) {
+        g_liveStates.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    ~ThreadStateHolder() {
+        if (state_->live) {
+            state_->drbg.~ChaCha20Drbg();
+        }
+        release(state_);
+        g_liveStates.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    ChaCha20Drbg& get() {
+        if (!state_->live ||
+            state_->forkGeneration != g_forkGeneration.load(std::memory_order_relaxed)) {
+            initialize();
+        }
+        return state_->drbg;
+    }
+
+private:
+    void initialize() {
+        if (state_->live) {
+            // Still mapped after fork (no MADV_WIPEONFORK): mix in fresh entropy
+            state_->drbg.reseed();
+        } else {
+            new (&state_->drbg) ChaCha20Drbg();
+            state_->live = 1;
+        }
+        state_->forkGeneration = g_forkGeneration.load(std::memory_order_relaxed);
+    }
+
+    static ThreadState* allocate() {
+#if defined(HAVE_POSIX_FORK)
+        registerForkHandler();
+        const size_t size = mappedSize();
+        void* mem = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mem == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+#if defined(MADV_WIPEONFORK)
+        // Best effort: older kernels fall back to the atfork generation check
+        ::madvise(mem, size, MADV_WIPEONFORK);
+#endif
+        return static_cast<ThreadState*>(mem);
+#else
+        void* mem = ::operator new(sizeof(ThreadState), std::align_val_t(alignof(ThreadState)));
+        std::memset(mem, 0, sizeof(ThreadState));
+        return static_cast<ThreadState*>(mem);
+#endif
+    }
+
+    static void release(ThreadState* state) {
+#if defined(HAVE_POSIX_FORK)
+        ::munmap(state, mappedSize());
+#else
+        ::operator delete(state, std::align_val_t(alignof(ThreadState)));
+#endif
+    }
+
+#if defined(HAVE_POSIX_FORK)
+    static size_t mappedSize() {
+        static const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        return (sizeof(ThreadState) + page - 1) / page * page;
+    }
+#endif
+
+    ThreadState* state_;
+};
+
+// Sampler accounting for the calling thread
+thread_local SamplerStats t_samplerStats;
+
+void sample(uint32_t* values, size_t count) {
+    ChaCha20Drbg& drbg = ThreadLocalRandomGenerator::current();
+    auto next = [&drbg]() { return drbg.next64(); };
+    sampleBounded(next, values, count, t_samplerStats);
+}
+
+} // namespace
+
+ChaCha20Drbg& ThreadLocalRandomGenerator::current() {
+    thread_local ThreadStateHolder holder;
+    return holder.get();
+}
+
+SamplerStats ThreadLocalRandomGenerator::samplerStats() {
+    return t_samplerStats;
+}
+
+size_t ThreadLocalRandomGenerator::liveStates() {
+    return g_liveStates.load(std::memory_order_relaxed);
+}
+
+int ThreadLocalRandomGenerator::generate(int min, int max) {
+    if (min > max) {
+        throw std::invalid_argument("min must be <= max");
+    }
+    uint32_t value = static_cast<uint32_t>(max - min + 1);
+    sample(&value, 1);
+    return min + static_cast<int>(value);
+}
+
+void ThreadLocalRandomGenerator::generateBounded(uint32_t* values, size_t count) {
+    sample(values, count);
+}
+
+void ThreadLocalRandomGenerator::generateIndices(uint32_t* out, size_t count, uint32_t bound) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = bound;
+    }
+    sample(out, count);
+}
+
+void ThreadLocalRandomGenerator::fillBytes(void* out, size_t length) {
+    current().fill(out, length);
+}
+
+} // namespace utils
+} // namespace password_generator
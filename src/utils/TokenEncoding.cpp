@@ -0,0 +1,373 @@
+#include "utils/TokenEncoding.h"
+#include <cmath>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define HAVE_X86_SIMD 1
+#endif
+
+namespace password_generator {
+namespace utils {
+
+namespace {
+
+constexpr char HEX_DIGITS[] = "0123456789abcdef";
+constexpr char BASE32_DIGITS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567";
+constexpr char BASE58_DIGITS[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+constexpr char BASE64URL_DIGITS[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+size_t radixOf(TokenEncoding encoding) {
+    switch (encoding) {
+    case TokenEncoding::Hex:
+        return 16;
+    case TokenEncoding::Base32:
+        return 32;
+    case TokenEncoding::Base58:
+        return 58;
+    case TokenEncoding::Base64Url:
+        return 64;
+    }
+    return 0;
+}
+
+// Each loop takes whole groups from position i and returns the first byte
+// it left for the scalar tail
+
+size_t hexScalar(const uint8_t* bytes, size_t count, char* out, size_t i) {
+    for (; i < count; ++i) {
+        out[2 * i] = HEX_DIGITS[bytes[i] >> 4];
+        out[2 * i + 1] = HEX_DIGITS[bytes[i] & 0x0F];
+    }
+    return i;
+}
+
+void base32Group(const uint8_t* group, size_t available, char* out) {
+    uint64_t bits = 0;
+    for (size_t k = 0; k < 5; ++k) {
+        bits = (bits << 8) | (k < available ? group[k] : 0);
+    }
+    const size_t characters = (available * 8 + 4) / 5;
+    for (size_t k = 0; k < characters; ++k) {
+        out[k] = BASE32_DIGITS[(bits >> (35 - 5 * k)) & 0x1F];
+    }
+}
+
+void base32Scalar(const uint8_t* bytes, size_t count, char* out, size_t i) {
+    for (; i + 5 <= count; i += 5) {
+        base32Group(bytes + i, 5, out + i / 5 * 8);
+    }
+    if (i < count) {
+        base32Group(bytes + i, count - i, out + i / 5 * 8);
+    }
+}
+
+void base64Group(const uint8_t* group, size_t available, char* out) {
+    uint32_t bits = 0;
+    for (size_t k = 0; k < 3; ++k) {
+        bits = (bits << 8) | (k < available ? group[k] : 0);
+    }
+    const size_t characters = available + 1;
+    for (size_t k = 0; k < characters; ++k) {
+        out[k] = BASE64URL_DIGITS[(bits >> (18 - 6 * k)) & 0x3F];
+    }
+}
+
+void base64Scalar(const uint8_t* bytes, size_t count, char* out, size_t i) {
+    for (; i + 3 <= count; i += 3) {
+        base64Group(bytes + i, 3, out + i / 3 * 4);
+    }
+    if (i < count) {
+        base64Group(bytes + i, count - i, out + i / 3 * 4);
+    }
+}
+
+#if defined(HAVE_X86_SIMD)
+
+bool hasSsse3() {
+    static const bool supported = __builtin_cpu_supports("ssse3");
+    return supported;
+}
+
+bool hasAvx2() {
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+__attribute__((target("ssse3")))
+size_t hexSsse3(const uint8_t* bytes, size_t count, char* out) {
+    const __m128i digits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(HEX_DIGITS));
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+        const __m128i high = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(in, 4), nibble));
+        const __m128i low = _mm_shuffle_epi8(digits, _mm_and_si128(in, nibble));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i), _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i + 16), _mm_unpackhi_epi8(high, low));
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+size_t hexAvx2(const uint8_t* bytes, size_t count, char* out) {
+    const __m256i digits = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(HEX_DIGITS)));
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + i));
+        const __m256i high = _mm256_shuffle_epi8(
+            digits, _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble));
+        const __m256i low = _mm256_shuffle_epi8(digits, _mm256_and_si256(in, nibble));
+        // Unpacking works within 128-bit lanes, so the halves come out as
+        // bytes 0-7 and 16-23, then 8-15 and 24-31
+        const __m256i first = _mm256_unpacklo_epi8(high, low);
+        const __m256i second = _mm256_unpackhi_epi8(high, low);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * i),
+                            _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * i + 32),
+                            _mm256_permute2x128_si256(first, second, 0x31));
+    }
+    return i;
+}
+
+// Character j of a 5-byte group starts at bit 5j. Its lane holds bytes
+// k = 5j / 8 and k + 1 as a big-endian 16-bit word, and multiplying by
+// 2^(5 + 5j % 8) and keeping the high half shifts the field down to bit 0
+#define BASE32_GATHER(g) \
+    1 + (g), 0 + (g), 1 + (g), 0 + (g), 2 + (g), 1 + (g), 2 + (g), 1 + (g), \
+    3 + (g), 2 + (g), 4 + (g), 3 + (g), 4 + (g), 3 + (g), 5 + (g), 4 + (g)
+#define BASE32_SHIFTS 32, 1024, 128, 4096, 512, 64, 2048, 256
+
+__attribute__((target("ssse3")))
+inline __m128i base32Map(__m128i values) {
+    // A-Z for 0-25, then 2-7 for 26-31
+    const __m128i letters = _mm_add_epi8(values, _mm_set1_epi8('A'));
+    const __m128i isDigit = _mm_cmpgt_epi8(values, _mm_set1_epi8(25));
+    return _mm_sub_epi8(letters, _mm_and_si128(isDigit, _mm_set1_epi8('A' - '2' + 26)));
+}
+
+__attribute__((target("ssse3")))
+size_t base32Ssse3(const uint8_t* bytes, size_t count, char* out) {
+    const __m128i firstGroup = _mm_setr_epi8(BASE32_GATHER(0));
+    const __m128i secondGroup = _mm_setr_epi8(BASE32_GATHER(5));
+    const __m128i shifts = _mm_setr_epi16(BASE32_SHIFTS);
+    const __m128i field = _mm_set1_epi16(0x1F);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 10) {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+        const __m128i first = _mm_and_si128(
+            _mm_mulhi_epu16(_mm_shuffle_epi8(in, firstGroup), shifts), field);
+        const __m128i second = _mm_and_si128(
+            _mm_mulhi_epu16(_mm_shuffle_epi8(in, secondGroup), shifts), field);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i / 5 * 8),
+                         base32Map(_mm_packus_epi16(first, second)));
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+size_t base32Avx2(const uint8_t* bytes, size_t count, char* out) {
+    const __m256i firstGroup = _mm256_broadcastsi128_si256(_mm_setr_epi8(BASE32_GATHER(0)));
+    const __m256i secondGroup = _mm256_broadcastsi128_si256(_mm_setr_epi8(BASE32_GATHER(5)));
+    const __m256i shifts = _mm256_broadcastsi128_si256(_mm_setr_epi16(BASE32_SHIFTS));
+    const __m256i field = _mm256_set1_epi16(0x1F);
+    size_t i = 0;
+    for (; i + 26 <= count; i += 20) {
+        // Lane 0 holds groups 0-1 and lane 1 groups 2-3, so the lane-wise
+        // pack leaves the 32 characters in order
+        const __m256i in = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i))),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i + 10)), 1);
+        const __m256i first = _mm256_and_si256(
+            _mm256_mulhi_epu16(_mm256_shuffle_epi8(in, firstGroup), shifts), field);
+        const __m256i second = _mm256_and_si256(
+            _mm256_mulhi_epu16(_mm256_shuffle_epi8(in, secondGroup), shifts), field);
+        const __m256i values = _mm256_packus_epi16(first, second);
+        const __m256i letters = _mm256_add_epi8(values, _mm256_set1_epi8('A'));
+        const __m256i isDigit = _mm256_cmpgt_epi8(values, _mm256_set1_epi8(25));
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(out + i / 5 * 8),
+            _mm256_sub_epi8(letters, _mm256_and_si256(isDigit, _mm256_set1_epi8('A' - '2' + 26))));
+    }
+    return i;
+}
+
+#undef BASE32_GATHER
+#undef BASE32_SHIFTS
+
+// pshufb index per 32-bit lane: bytes b1 b0 b2 b1 of each 3-byte group
+#define BASE64_SPREAD 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10
+// Offset from each field to its character, indexed by the field's range:
+// 0 for 52-61 and 1-10 (digits), 11 for '-', 12 for '_', 13 for A-Z and
+// 0 again for a-z
+#define BASE64_OFFSETS \
+    'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, \
+    '0' - 52, '0' - 52, '0' - 52, '-' - 62, '_' - 63, 'A', 0, 0
+
+__attribute__((target("ssse3")))
+size_t base64Ssse3(const uint8_t* bytes, size_t count, char* out) {
+    const __m128i spread = _mm_setr_epi8(BASE64_SPREAD);
+    const __m128i offsets = _mm_setr_epi8(BASE64_OFFSETS);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 12) {
+        const __m128i in = _mm_shuffle_epi8(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i)), spread);
+        // Fields 0 and 2 move down with a high multiply, 1 and 3 up with a
+        // low one, each landing in its own byte
+        const __m128i high = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)),
+                                             _mm_set1_epi32(0x04000040));
+        const __m128i low = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)),
+                                            _mm_set1_epi32(0x01000010));
+        const __m128i fields = _mm_or_si128(high, low);
+
+        __m128i range = _mm_subs_epu8(fields, _mm_set1_epi8(51));
+        const __m128i upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), fields);
+        range = _mm_or_si128(range, _mm_and_si128(upper, _mm_set1_epi8(13)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i / 3 * 4),
+                         _mm_add_epi8(fields, _mm_shuffle_epi8(offsets, range)));
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+size_t base64Avx2(const uint8_t* bytes, size_t count, char* out) {
+    const __m256i spread = _mm256_broadcastsi128_si256(_mm_setr_epi8(BASE64_SPREAD));
+    const __m256i offsets = _mm256_broadcastsi128_si256(_mm_setr_epi8(BASE64_OFFSETS));
+    size_t i = 0;
+    for (; i + 28 <= count; i += 24) {
+        const __m256i in = _mm256_shuffle_epi8(
+            _mm256_inserti128_si256(
+                _mm256_castsi128_si256(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i + 12)), 1),
+            spread);
+        const __m256i high = _mm256_mulhi_epu16(
+            _mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+        const __m256i low = _mm256_mullo_epi16(
+            _mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+        const __m256i fields = _mm256_or_si256(high, low);
+
+        __m256i range = _mm256_subs_epu8(fields, _mm256_set1_epi8(51));
+        const __m256i upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), fields);
+        range = _mm256_or_si256(range, _mm256_and_si256(upper, _mm256_set1_epi8(13)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i / 3 * 4),
+                            _mm256_add_epi8(fields, _mm256_shuffle_epi8(offsets, range)));
+    }
+    return i;
+}
+
+#undef BASE64_SPREAD
+#undef BASE64_OFFSETS
+
+#endif
+
+} // namespace
+
+const char* tokenAlphabet(TokenEncoding encoding) {
+    switch (encoding) {
+    case TokenEncoding::Hex:
+        return HEX_DIGITS;
+    case TokenEncoding::Base32:
+        return BASE32_DIGITS;
+    case TokenEncoding::Base58:
+        return BASE58_DIGITS;
+    case TokenEncoding::Base64Url:
+        return BASE64URL_DIGITS;
+    }
+    return HEX_DIGITS;
+}
+
+size_t encodedLength(TokenEncoding encoding, size_t byteCount) {
+    switch (encoding) {
+    case TokenEncoding::Hex:
+        return 2 * byteCount;
+    case TokenEncoding::Base32:
+        return (8 * byteCount + 4) / 5;
+    case TokenEncoding::Base64Url:
+        return (8 * byteCount + 5) / 6;
+    case TokenEncoding::Base58:
+        // log2(58) is irrational, so the product is never an exact integer
+        return static_cast<size_t>(
+            std::ceil(8.0 * static_cast<double>(byteCount) / std::log2(58.0)));
+    }
+    return 0;
+}
+
+void encodeHex(const uint8_t* bytes, size_t count, char* out) {
+    size_t i = 0;
+#if defined(HAVE_X86_SIMD)
+    if (hasAvx2()) {
+        i = hexAvx2(bytes, count, out);
+    } else if (hasSsse3()) {
+        i = hexSsse3(bytes, count, out);
+    }
+#endif
+    hexScalar(bytes, count, out, i);
+}
+
+void encodeBase32(const uint8_t* bytes, size_t count, char* out) {
+    size_t i = 0;
+#if defined(HAVE_X86_SIMD)
+    if (hasAvx2()) {
+        i = base32Avx2(bytes, count, out);
+    } else if (hasSsse3()) {
+        i = base32Ssse3(bytes, count, out);
+    }
+#endif
+    base32Scalar(bytes, count, out, i);
+}
+
+void encodeBase64Url(const uint8_t* bytes, size_t count, char* out) {
+    size_t i = 0;
+#if defined(HAVE_X86_SIMD)
+    if (hasAvx2()) {
+        i = base64Avx2(bytes, count, out);
+    } else if (hasSsse3()) {
+        i = base64Ssse3(bytes, count, out);
+    }
+#endif
+    base64Scalar(bytes, count, out, i);
+}
+
+void encodeHexScalar(const uint8_t* bytes, size_t count, char* out) {
+    hexScalar(bytes, count, out, 0);
+}
+
+void encodeBase32Scalar(const uint8_t* bytes, size_t count, char* out) {
+    base32Scalar(bytes, count, out, 0);
+}
+
+void encodeBase64UrlScalar(const uint8_t* bytes, size_t count, char* out) {
+    base64Scalar(bytes, count, out, 0);
+}
+
+void encodeFixedWidth(TokenEncoding encoding, uint64_t value, size_t width, char* out) {
+    const char* digits = tokenAlphabet(encoding);
+    const uint64_t radix = radixOf(encoding);
+    for (size_t k = width; k-- > 0;) {
+        out[k] = digits[value % radix];
+        value /= radix;
+    }
+}
+
+bool decodeFixedWidth(TokenEncoding encoding, const char* digits, size_t width, uint64_t& value) {
+    const char* alphabet = tokenAlphabet(encoding);
+    const size_t radix = radixOf(encoding);
+    value = 0;
+    for (size_t k = 0; k < width; ++k) {
+        size_t digit = 0;
+        while (digit < radix && alphabet[digit] != digits[k]) {
+            ++digit;
+        }
+        if (digit == radix) {
+            return false;
+        }
+        value = value * radix + digit;
+    }
+    return true;
+}
+
+} // namespace utils
+} // namespace password_generator
@@ -0,0 +1,96 @@
+#include "utils/UnicodeCategory.h"
+#include <algorithm>
+#include <iterator>
+
+namespace password_generator {
+namespace utils {
+
+namespace {
+
+// In Latin Extended-A most letters come in upper/lower pairs on adjacent
+// code points, so one range covers a run of pairs
+enum Case : uint8_t {
+    FIXED,
+    UPPER_EVEN,  // upper case on even code points, lower on odd
+    UPPER_ODD    // upper case on odd code points, lower on even
+};
+
+struct CategoryRange {
+    char32_t first;
+    char32_t last;
+    UnicodeCategory category;
+    Case pairs;
+};
+
+constexpr UnicodeCategory U = UnicodeCategory::UPPERCASE;
+constexpr UnicodeCategory L = UnicodeCategory::LOWERCASE;
+constexpr UnicodeCategory D = UnicodeCategory::DIGIT;
+constexpr UnicodeCategory O = UnicodeCategory::OTHER;
+
+// Sorted and disjoint; code points in no range are symbols
+constexpr CategoryRange RANGES[] = {
+    {0x0000, 0x0020, O, FIXED},       // C0 controls, space
+    {0x0030, 0x0039, D, FIXED},
+    {0x0041, 0x005a, U, FIXED},
+    {0x0061, 0x007a, L, FIXED},
+    {0x007f, 0x00a0, O, FIXED},       // DEL, C1 controls, no-break space
+    {0x00aa, 0x00aa, L, FIXED},       // feminine ordinal
+    {0x00ad, 0x00ad, O, FIXED},       // soft hyphen
+    {0x00b5, 0x00b5, L, FIXED},       // micro sign
+    {0x00ba, 0x00ba, L, FIXED},       // masculine ordinal
+    {0x00c0, 0x00d6, U, FIXED},
+    {0x00d8, 0x00de, U, FIXED},
+    {0x00df, 0x00f6, L, FIXED},
+    {0x00f8, 0x00ff, L, FIXED},
+    {0x0100, 0x0137, U, UPPER_EVEN},
+    {0x0138, 0x0138, L, FIXED},
+    {0x0139, 0x0148, U, UPPER_ODD},
+    {0x0149, 0x0149, L, FIXED},
+    {0x014a, 0x0177, U, UPPER_EVEN},
+    {0x0178, 0x0178, U, FIXED},
+    {0x0179, 0x017e, U, UPPER_ODD},
+    {0x017f, 0x017f, L, FIXED},
+    {0x0386, 0x0386, U, FIXED},
+    {0x0388, 0x038a, U, FIXED},
+    {0x038c, 0x038c, U, FIXED},
+    {0x038e, 0x038f, U, FIXED},
+    {0x0390, 0x0390, L, FIXED},
+    {0x0391, 0x03a1, U, FIXED},
+    {0x03a3, 0x03ab, U, FIXED},
+    {0x03ac, 0x03ce, L, FIXED},
+    {0x0400, 0x042f, U, FIXED},
+    {0x0430, 0x045f, L, FIXED},
+    {0x2000, 0x200f, O, FIXED},       // spaces, zero-width and direction marks
+    {0x2028, 0x202f, O, FIXED},       // separators, embeddings
+    {0x205f, 0x206f, O, FIXED},
+    {0x3000, 0x3000, O, FIXED},       // ideographic space
+    {0xd800, 0xdfff, O, FIXED},       // surrogates
+    {0xfeff, 0xfeff, O, FIXED},       // byte order mark
+    {0xfffe, 0xffff, O, FIXED},       // noncharacters
+};
+
+} // namespace
+
+UnicodeCategory unicodeCategory(char32_t codePoint) {
+    if (codePoint > 0x10ffff) {
+        return UnicodeCategory::OTHER;
+    }
+    const CategoryRange* end = std::end(RANGES);
+    const CategoryRange* range = std::upper_bound(
+        std::begin(RANGES), end, codePoint,
+        [](char32_t value, const CategoryRange& r) { return value < r.first; });
+    if (range == std::begin(RANGES) || codePoint > (--range)->last) {
+        return UnicodeCategory::SYMBOL;
+    }
+    switch (range->pairs) {
+    case UPPER_EVEN:
+        return codePoint % 2 == 0 ? U : L;
+    case UPPER_ODD:
+        return codePoint % 2 == 1 ? U : L;
+    default:
+        return range->category;
+    }
+}
+
+} // namespace utils
+} // namespace password_generator
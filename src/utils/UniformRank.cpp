@@ -0,0 +1,41 @@
+#include "utils/UniformRank.h"
+#include "utils/BulkRandomGenerator.h"
+#include "utils/SecureMemory.h"
+#include <vector>
+
+namespace password_generator {
+namespace utils {
+
+BigUint drawBelow(core::interfaces::IRandomGenerator& rng, const BigUint& bound) {
+    const size_t bits = bound.bitLength();
+    std::vector<uint8_t> bytes((bits + 7) / 8);
+    const uint8_t topMask = static_cast<uint8_t>(0xff >> (bytes.size() * 8 - bits));
+    while (true) {
+        fillBytes(rng, bytes.data(), bytes.size());
+        bytes[0] &= topMask;
+        BigUint value = BigUint::fromBytes(bytes.data(), bytes.size());
+        if (value < bound) {
+            secureWipe(bytes.data(), bytes.size());
+            return value;
+        }
+    }
+}
+
+uint32_t quotientBelow(const BigUint& rank, const BigUint& unit, uint32_t limit) {
+    uint32_t low = 0;
+    uint32_t high = limit - 1;
+    while (low < high) {
+        uint32_t mid = (low + high + 1) / 2;
+        BigUint scaled = unit;
+        scaled *= mid;
+        if (scaled <= rank) {
+            low = mid;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return low;
+}
+
+} // namespace utils
+} // namespace password_generator
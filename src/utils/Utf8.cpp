@@ -0,0 +1,99 @@
+#include "utils/Utf8.h"
+#include <cstdint>
+
+namespace password_generator {
+namespace utils {
+
+bool decodeUtf8(std::string_view text, size_t& pos, char32_t& codePoint) {
+    const auto lead = static_cast<unsigned char>(text[pos]);
+    size_t extra;
+    char32_t minimum;
+    if (lead < 0x80) {
+        codePoint = lead;
+        ++pos;
+        return true;
+    } else if ((lead & 0xe0) == 0xc0) {
+        extra = 1;
+        minimum = 0x80;
+        codePoint = lead & 0x1f;
+    } else if ((lead & 0xf0) == 0xe0) {
+        extra = 2;
+        minimum = 0x800;
+        codePoint = lead & 0x0f;
+    } else if ((lead & 0xf8) == 0xf0) {
+        extra = 3;
+        minimum = 0x10000;
+        codePoint = lead & 0x07;
+    } else {
+        codePoint = lead;
+        ++pos;
+        return false;
+    }
+
+    if (text.size() - pos <= extra) {
+        codePoint = lead;
+        ++pos;
+        return false;
+    }
+    for (size_t i = 1; i <= extra; ++i) {
+        const auto next = static_cast<unsigned char>(text[pos + i]);
+        if ((next & 0xc0) != 0x80) {
+            codePoint = lead;
+            ++pos;
+            return false;
+        }
+        codePoint = (codePoint << 6) | (next & 0x3f);
+    }
+    if (codePoint < minimum || codePoint > 0x10ffff ||
+        (codePoint >= 0xd800 && codePoint <= 0xdfff)) {
+        codePoint = lead;
+        ++pos;
+        return false;
+    }
+    pos += extra + 1;
+    return true;
+}
+
+size_t encodeUtf8(char32_t codePoint, char* out) {
+    auto* bytes = reinterpret_cast<unsigned char*>(out);
+    if (codePoint < 0x80) {
+        bytes[0] = static_cast<unsigned char>(codePoint);
+        return 1;
+    }
+    if (codePoint < 0x800) {
+        bytes[0] = static_cast<unsigned char>(0xc0 | (codePoint >> 6));
+        bytes[1] = static_cast<unsigned char>(0x80 | (codePoint & 0x3f));
+        return 2;
+    }
+    if (codePoint >= 0xd800 && codePoint <= 0xdfff) {
+        return 0;
+    }
+    if (codePoint < 0x10000) {
+        bytes[0] = static_cast<unsigned char>(0xe0 | (codePoint >> 12));
+        bytes[1] = static_cast<unsigned char>(0x80 | ((codePoint >> 6) & 0x3f));
+        bytes[2] = static_cast<unsigned char>(0x80 | (codePoint & 0x3f));
+        return 3;
+    }
+    if (codePoint <= 0x10ffff) {
+        bytes[0] = static_cast<unsigned char>(0xf0 | (codePoint >> 18));
+        bytes[1] = static_cast<unsigned char>(0x80 | ((codePoint >> 12) & 0x3f));
+        bytes[2] = static_cast<unsigned char>(0x80 | ((codePoint >> 6) & 0x3f));
+        bytes[3] = static_cast<unsigned char>(0x80 | (codePoint & 0x3f));
+        return 4;
+    }
+    return 0;
+}
+
+size_t utf8Length(std::string_view text) {
+    size_t count = 0;
+    size_t pos = 0;
+    char32_t codePoint;
+    while (pos < text.size()) {
+        decodeUtf8(text, pos, codePoint);
+        ++count;
+    }
+    return count;
+}
+
+} // namespace utils
+} // namespace password_generator
@@ -0,0 +1,128 @@
+#include "utils/Utf8Alphabet.h"
+#include "utils/UnicodeCategory.h"
+#include "utils/Utf8.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace password_generator {
+namespace utils {
+
+namespace {
+
+struct NamedRange {
+    const char* name;
+    char32_t first;
+    char32_t last;
+};
+
+// An alphabet is the union of its name's ranges, minus invisible code
+// points; "symbols" keeps only the SYMBOL category of its range
+const NamedRange NAMED_RANGES[] = {
+    {"latin1", 0x00c0, 0x00d6},
+    {"latin1", 0x00d8, 0x00f6},
+    {"latin1", 0x00f8, 0x00ff},
+    {"latin-ext", 0x0100, 0x017f},
+    {"greek", 0x0391, 0x03a1},
+    {"greek", 0x03a3, 0x03a9},
+    {"greek", 0x03b1, 0x03c9},
+    {"cyrillic", 0x0401, 0x0401},
+    {"cyrillic", 0x0410, 0x044f},
+    {"cyrillic", 0x0451, 0x0451},
+    {"symbols", 0x00a1, 0x00bf},
+};
+
+} // namespace
+
+Utf8Alphabet Utf8Alphabet::fromString(std::string_view utf8) {
+    Utf8Alphabet alphabet;
+    size_t pos = 0;
+    char32_t codePoint;
+    while (pos < utf8.size()) {
+        if (!decodeUtf8(utf8, pos, codePoint)) {
+            throw std::invalid_argument("Alphabet is not valid UTF-8");
+        }
+        if (unicodeCategory(codePoint) == UnicodeCategory::OTHER) {
+            throw std::invalid_argument("Alphabet contains a control or invisible character");
+        }
+        alphabet.codePoints_.push_back(codePoint);
+    }
+    alphabet.rebuild();
+    return alphabet;
+}
+
+Utf8Alphabet Utf8Alphabet::fromRange(char32_t first, char32_t last) {
+    if (first > last || last > 0x10ffff) {
+        throw std::invalid_argument("Invalid code point range");
+    }
+    Utf8Alphabet alphabet;
+    for (char32_t codePoint = first; codePoint <= last; ++codePoint) {
+        if (unicodeCategory(codePoint) != UnicodeCategory::OTHER) {
+            alphabet.codePoints_.push_back(codePoint);
+        }
+    }
+    alphabet.rebuild();
+    return alphabet;
+}
+
+Utf8Alphabet Utf8Alphabet::named(const std::string& name) {
+    Utf8Alphabet alphabet;
+    for (const NamedRange& range : NAMED_RANGES) {
+        if (name != range.name) {
+            continue;
+        }
+        for (char32_t codePoint = range.first; codePoint <= range.last; ++codePoint) {
+            const UnicodeCategory category = unicodeCategory(codePoint);
+            if (category != UnicodeCategory::OTHER &&
+                (name != "symbols" || category == UnicodeCategory::SYMBOL)) {
+                alphabet.codePoints_.push_back(codePoint);
+            }
+        }
+    }
+    if (alphabet.codePoints_.empty()) {
+        throw std::invalid_argument("Unknown alphabet '" + name + "'");
+    }
+    alphabet.rebuild();
+    return alphabet;
+}
+
+const std::vector<std::string>& Utf8Alphabet::names() {
+    static const std::vector<std::string> NAMES = {
+        "latin1", "latin-ext", "greek", "cyrillic", "symbols"};
+    return NAMES;
+}
+
+void Utf8Alphabet::merge(const Utf8Alphabet& other) {
+    codePoints_.insert(codePoints_.end(), other.codePoints_.begin(), other.codePoints_.end());
+    rebuild();
+}
+
+std::string Utf8Alphabet::toString() const {
+    std::string text;
+    text.reserve(slots_.size() * maxLength_);
+    for (size_t i = 0; i < slots_.size(); ++i) {
+        text.append(slots_[i].bytes, lengths_[i]);
+    }
+    return text;
+}
+
+void Utf8Alphabet::rebuild() {
+    std::sort(codePoints_.begin(), codePoints_.end());
+    codePoints_.erase(std::unique(codePoints_.begin(), codePoints_.end()), codePoints_.end());
+
+    slots_.assign(codePoints_.size(), Slot{{0, 0, 0, 0}});
+    lengths_.resize(codePoints_.size());
+    maxLength_ = 0;
+    stride_ = 0;
+    for (size_t i = 0; i < codePoints_.size(); ++i) {
+        lengths_[i] = static_cast<uint8_t>(encodeUtf8(codePoints_[i], slots_[i].bytes));
+        maxLength_ = std::max<size_t>(maxLength_, lengths_[i]);
+    }
+    if (!codePoints_.empty() &&
+        std::all_of(lengths_.begin(), lengths_.end(),
+                    [this](uint8_t length) { return length == lengths_.front(); })) {
+        stride_ = lengths_.front();
+    }
+}
+
+} // namespace utils
+} // namespace password_generator
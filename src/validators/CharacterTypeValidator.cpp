@@ -1,5 +1,6 @@
 #include "validators/CharacterTypeValidator.h"
-#include <cctype>
+#include "utils/UnicodeCategory.h"
+#include "utils/Utf8.h"
 
 namespace password_generator {
 namespace validators {
@@ -9,20 +10,36 @@ CharacterTypeValidator::CharacterTypeValidator(
     : requireUpper_(requireUpper), requireLower_(requireLower),
       requireDigit_(requireDigit), requireSymbol_(requireSymbol) {}
 
+CharacterTypeValidator::Type CharacterTypeValidator::typeOf(char32_t codePoint) {
+    switch (utils::unicodeCategory(codePoint)) {
+    case utils::UnicodeCategory::UPPERCASE: return UPPERCASE;
+    case utils::UnicodeCategory::LOWERCASE: return LOWERCASE;
+    case utils::UnicodeCategory::DIGIT: return DIGIT;
+    default: return SYMBOL;
+    }
+}
+
 bool CharacterTypeValidator::validate(const std::string& password) const {
-    bool hasUpper = false, hasLower = false, hasDigit = false, hasSymbol = false;
-    
-    for (char c : password) {
-        if (std::isupper(c)) hasUpper = true;
-        else if (std::islower(c)) hasLower = true;
-        else if (std::isdigit(c)) hasDigit = true;
-        else hasSymbol = true;
+    return validate(password.data(), password.size());
+}
+
+bool CharacterTypeValidator::validate(const char* password, size_t length) const {
+    const std::string_view text(password, length);
+    const unsigned required = getRequiredTypes();
+    unsigned present = 0;
+    size_t pos = 0;
+    char32_t codePoint;
+    while (pos < text.size()) {
+        const auto byte = static_cast<unsigned char>(text[pos]);
+        if (byte < 0x80) {
+            present |= typeOf(text[pos++]);
+        } else if (utils::decodeUtf8(text, pos, codePoint)) {
+            present |= typeOf(codePoint);
+        } else {
+            present |= SYMBOL;
+        }
     }
-    
-    return (!requireUpper_ || hasUpper) &&
-           (!requireLower_ || hasLower) &&
-           (!requireDigit_ || hasDigit) &&
-           (!requireSymbol_ || hasSymbol);
+    return (present & required) == required;
 }
 
 std::string CharacterTypeValidator::getErrorMessage() const {
@@ -69,5 +86,10 @@ void CharacterTypeValidator::setRequireSymbol(bool require) {
     requireSymbol_ = require;
 }
 
+unsigned CharacterTypeValidator::getRequiredTypes() const {
+    return (requireUpper_ ? UPPERCASE : 0u) | (requireLower_ ? LOWERCASE : 0u) |
+           (requireDigit_ ? DIGIT : 0u) | (requireSymbol_ ? SYMBOL : 0u);
+}
+
 } // namespace validators
 } // namespace password_generator
\ No newline at end of file
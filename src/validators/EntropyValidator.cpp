@@ -1,15 +1,35 @@
 #include "validators/EntropyValidator.h"
+#include "utils/Utf8.h"
 #include <cmath>
-#include <unordered_map>
+#include <cstdint>
 
 namespace password_generator {
 namespace validators {
 
+namespace {
+
+size_t countCodePoint(std::string_view text, size_t from, size_t to, char32_t target) {
+    size_t count = 0;
+    size_t pos = from;
+    char32_t codePoint;
+    while (pos < to) {
+        utils::decodeUtf8(text, pos, codePoint);
+        count += codePoint == target;
+    }
+    return count;
+}
+
+} // namespace
+
 EntropyValidator::EntropyValidator(double minEntropy)
     : minEntropy_(minEntropy) {}
 
 bool EntropyValidator::validate(const std::string& password) const {
-    double entropy = calculateEntropy(password);
+    return validate(password.data(), password.size());
+}
+
+bool EntropyValidator::validate(const char* password, size_t length) const {
+    double entropy = calculateEntropy(std::string_view(password, length));
     return entropy >= minEntropy_;
 }
 
@@ -25,27 +45,41 @@ double EntropyValidator::getMinEntropy() const {
     return minEntropy_;
 }
 
-double EntropyValidator::calculateEntropy(const std::string& password) const {
+double EntropyValidator::calculateEntropy(std::string_view password) const {
     if (password.empty()) {
         return 0.0;
     }
     
-    // Count character frequencies
-    std::unordered_map<char, int> frequencies;
-    for (char c : password) {
-        frequencies[c]++;
+    // Shannon entropy times the length is count * log2(count) minus the sum
+    // of n * log2(n) over each code point's frequency n. Code points below
+    // 256, including malformed bytes, which stand for themselves, are
+    // tallied in a table; any other is counted by rescanning the text at
+    // its first occurrence, so nothing is allocated.
+    uint32_t frequencies[256] = {};
+    double weighted = 0.0;
+    size_t count = 0;
+    size_t pos = 0;
+    char32_t codePoint;
+    while (pos < password.size()) {
+        const size_t start = pos;
+        utils::decodeUtf8(password, pos, codePoint);
+        ++count;
+        if (codePoint < 256) {
+            frequencies[codePoint]++;
+        } else if (countCodePoint(password, 0, start, codePoint) == 0) {
+            const double n = 1.0 + countCodePoint(password, pos, password.size(), codePoint);
+            weighted += n * std::log2(n);
+        }
     }
-    
-    // Calculate Shannon entropy
-    double entropy = 0.0;
-    double length = static_cast<double>(password.length());
-    
-    for (const auto& pair : frequencies) {
-        double probability = static_cast<double>(pair.second) / length;
-        entropy -= probability * std::log2(probability);
+    for (uint32_t frequency : frequencies) {
+        if (frequency > 0) {
+            const double n = static_cast<double>(frequency);
+            weighted += n * std::log2(n);
+        }
     }
     
-    return entropy * length;
+    const double length = static_cast<double>(count);
+    return length * std::log2(length) - weighted;
 }
 
 } // namespace validators
@@ -1,4 +1,5 @@
 #include "validators/MaxLengthValidator.h"
+#include "utils/Utf8.h"
 
 namespace password_generator {
 namespace validators {
@@ -7,7 +8,12 @@ MaxLengthValidator::MaxLengthValidator(size_t maxLength)
     : maxLength_(maxLength) {}
 
 bool MaxLengthValidator::validate(const std::string& password) const {
-    return password.length() <= maxLength_;
+    return validate(password.data(), password.size());
+}
+
+bool MaxLengthValidator::validate(const char* password, size_t length) const {
+    // Limits are in code points, so a multi-byte character counts once
+    return utils::utf8Length(std::string_view(password, length)) <= maxLength_;
 }
 
 std::string MaxLengthValidator::getErrorMessage() const {
@@ -1,4 +1,5 @@
 #include "validators/MinLengthValidator.h"
+#include "utils/Utf8.h"
 
 namespace password_generator {
 namespace validators {
@@ -7,7 +8,12 @@ MinLengthValidator::MinLengthValidator(size_t minLength)
     : minLength_(minLength) {}
 
 bool MinLengthValidator::validate(const std::string& password) const {
-    return password.length() >= minLength_;
+    return validate(password.data(), password.size());
+}
+
+bool MinLengthValidator::validate(const char* password, size_t length) const {
+    // Limits are in code points, so a multi-byte character counts once
+    return utils::utf8Length(std::string_view(password, length)) >= minLength_;
 }
 
 std::string MinLengthValidator::getErrorMessage() const {
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include "helpers/AllocationCounter.h"
+#include "strategies/StandardPasswordStrategy.h"
+#include "strategies/PronounceablePasswordStrategy.h"
+#include "strategies/PatternPasswordStrategy.h"
+#include "providers/LowercaseProvider.h"
+#include "providers/UppercaseProvider.h"
+#include "providers/DigitProvider.h"
+#include "providers/SymbolProvider.h"
+#include "validators/CharacterTypeValidator.h"
+#include "validators/EntropyValidator.h"
+#include "validators/MaxLengthValidator.h"
+#include "validators/MinLengthValidator.h"
+#include "utils/CharacterFilter.h"
+
+// Built as its own executable: AllocationCounter.h replaces global
+// operator new for every test linked alongside it
+
+using namespace password_generator::strategies;
+using namespace password_generator::providers;
+using namespace password_generator::validators;
+using password_generator::support::allocationCount;
+
+namespace {
+
+// Generate and validate into a stack buffer; returns the allocations made
+size_t allocationsFor(IBatchPasswordStrategy& strategy, size_t length) {
+    const CharacterTypeValidator types(true, true, true, false);
+    const EntropyValidator entropy(1.0);
+    const MinLengthValidator minLength(length);
+    const MaxLengthValidator maxLength(length);
+
+    char password[64];
+    strategy.generateInto(password, length); // warm up thread-local state
+    const size_t before = allocationCount().load();
+    for (int i = 0; i < 100; ++i) {
+        strategy.generateInto(password, length);
+        EXPECT_TRUE(minLength.validate(password, length));
+        EXPECT_TRUE(maxLength.validate(password, length));
+        entropy.validate(password, length);
+        types.validate(password, length);
+    }
+    return allocationCount().load() - before;
+}
+
+} // namespace
+
+TEST(GenerateIntoTest, HotPathDoesNotAllocate) {
+    StandardPasswordStrategy standard;
+    standard.addCharacterSet(std::make_unique<LowercaseProvider>());
+    standard.addCharacterSet(std::make_unique<UppercaseProvider>());
+    standard.addCharacterSet(std::make_unique<DigitProvider>());
+    standard.addCharacterSet(std::make_unique<SymbolProvider>(), 2.0);
+    EXPECT_EQ(allocationsFor(standard, 32), 0u);
+
+    password_generator::utils::CharacterFilter filter;
+    filter.setNoAdjacentRepeat(true);
+    standard.setFilter(filter);
+    EXPECT_EQ(allocationsFor(standard, 32), 0u);
+
+    PronounceablePasswordStrategy pronounceable;
+    EXPECT_EQ(allocationsFor(pronounceable, 24), 0u);
+
+    PatternPasswordStrategy pattern("ULLL-DDDD-?s?a");
+    EXPECT_EQ(allocationsFor(pattern, 14), 0u);
+}
+
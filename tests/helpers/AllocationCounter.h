@@ -0,0 +1,46 @@
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+/**
+ * @file
+ * @brief Counts heap allocations made through global operator new
+ *
+ * Defines replacement allocation functions for the whole executable, so
+ * include it from exactly one translation unit of an executable of its
+ * own: each benchmark, and the allocation tests, never the main test
+ * binary. Only differences taken around the code under test matter.
+ */
+
+namespace password_generator {
+namespace support {
+
+inline std::atomic<size_t>& allocationCount() {
+    static std::atomic<size_t> count{0};
+    return count;
+}
+
+} // namespace support
+} // namespace password_generator
+
+void* operator new(std::size_t size) {
+    password_generator::support::allocationCount().fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+#endif // ALLOCATION_COUNTER_H
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include "strategies/StandardPasswordStrategy.h"
+#include "providers/LowercaseProvider.h"
+#include "providers/UppercaseProvider.h"
+#include "providers/DigitProvider.h"
+#include "providers/SymbolProvider.h"
+#include "utils/ThreadLocalRandomGenerator.h"
+#include <cstring>
+#include <set>
+#include <string>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace password_generator;
+
+namespace {
+
+std::unique_ptr<strategies::StandardPasswordStrategy> makeStrategy() {
+    auto strategy = std::make_unique<strategies::StandardPasswordStrategy>();
+    strategy->addCharacterSet(std::make_unique<providers::LowercaseProvider>());
+    strategy->addCharacterSet(std::make_unique<providers::UppercaseProvider>());
+    strategy->addCharacterSet(std::make_unique<providers::DigitProvider>());
+    strategy->addCharacterSet(std::make_unique<providers::SymbolProvider>());
+    return strategy;
+}
+
+} // namespace
+
+TEST(ConcurrentGenerationTest, ThreadsDrawIndependentStreams) {
+    const size_t threadCount = 8;
+    std::vector<std::string> streams(threadCount);
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&streams, t]() {
+            std::string bytes(32, '\0');
+            utils::ThreadLocalRandomGenerator().fillBytes(&bytes[0], bytes.size());
+            streams[t] = bytes;
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::set<std::string> unique(streams.begin(), streams.end());
+    EXPECT_EQ(unique.size(), threadCount);
+}
+
+TEST(ConcurrentGenerationTest, ForkedChildDoesNotShareKeystream) {
+    utils::ThreadLocalRandomGenerator rng;
+    uint8_t warmup[16];
+    rng.fillBytes(warmup, sizeof(warmup)); // Make sure the parent state exists
+
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+
+    pid_t pid = ::fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+        uint8_t childBytes[32];
+        utils::ThreadLocalRandomGenerator().fillBytes(childBytes, sizeof(childBytes));
+        ssize_t written = ::write(fds[1], childBytes, sizeof(childBytes));
+        ::_exit(written == static_cast<ssize_t>(sizeof(childBytes)) ? 0 : 1);
+    }
+
+    uint8_t parentBytes[32];
+    rng.fillBytes(parentBytes, sizeof(parentBytes));
+
+    uint8_t childBytes[32];
+    ssize_t received = ::read(fds[0], childBytes, sizeof(childBytes));
+    int status = 0;
+    ::waitpid(pid, &status, 0);
+    ::close(fds[0]);
+    ::close(fds[1]);
+
+    ASSERT_EQ(received, static_cast<ssize_t>(sizeof(childBytes)));
+    ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    EXPECT_NE(std::memcmp(parentBytes, childBytes, sizeof(parentBytes)), 0);
+}
+
+TEST(ConcurrentGenerationTest, SharedStrategyStaysValidAcrossThreads) {
+    // Throughput is measured by benchmarks/SharedStrategyBenchmark
+    auto strategy = makeStrategy();
+    const size_t threadCount = 8;
+    const size_t passwordsPerThread = 2000;
+    std::vector<std::vector<std::string>> passwords(threadCount);
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&strategy, &passwords, t, passwordsPerThread]() {
+            for (size_t i = 0; i < passwordsPerThread; ++i) {
+                passwords[t].push_back(strategy->generate(16));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const std::string alphabet = providers::LowercaseProvider().getCharacters() +
+                                 providers::UppercaseProvider().getCharacters() +
+                                 providers::DigitProvider().getCharacters() +
+                                 providers::SymbolProvider().getCharacters();
+    std::set<std::string> unique;
+    for (const auto& batch : passwords) {
+        for (const auto& password : batch) {
+            ASSERT_EQ(password.size(), 16u);
+            EXPECT_EQ(password.find_first_not_of(alphabet), std::string::npos) << password;
+            unique.insert(password);
+        }
+    }
+    // 16 characters from 94 leave no realistic chance of a collision
+    EXPECT_EQ(unique.size(), threadCount * passwordsPerThread);
+}
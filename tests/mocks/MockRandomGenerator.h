@@ -1,14 +1,25 @@
 #ifndef MOCK_RANDOM_GENERATOR_H
 #define MOCK_RANDOM_GENERATOR_H
 
-#include "core/interfaces/IRandomGenerator.h"
+#include "utils/BulkRandomGenerator.h"
+#include <cstdint>
 #include <vector>
 #include <stdexcept>
 
 namespace password_generator {
 namespace tests {
 
-class MockRandomGenerator : public core::interfaces::IRandomGenerator {
+/**
+ * @brief Replays a fixed sequence of values, clamped to each draw's range
+ *
+ * Bulk calls take values from the sequence in order, one per requested
+ * draw. A strategy's sequence therefore follows its own draw layout, which
+ * need not match the order of its older per-call code. For example,
+ * PronounceablePasswordStrategy draws all (length + 1) / 2 steps up front.
+ * Each step is a single value combining syllable, capital and digit, and
+ * every step is consumed, even the ones the password fills before using.
+ */
+class MockRandomGenerator : public utils::IBulkRandomGenerator {
 private:
     std::vector<int> sequence;
     mutable size_t index = 0;
@@ -30,6 +41,26 @@ public:
         return value;
     }
     
+    // One sequence value per draw, in the order the draws are laid out
+    void generateBounded(uint32_t* values, size_t count) override {
+        for (size_t i = 0; i < count; ++i) {
+            values[i] = static_cast<uint32_t>(generate(0, static_cast<int>(values[i]) - 1));
+        }
+    }
+    
+    void generateIndices(uint32_t* out, size_t count, uint32_t bound) override {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = static_cast<uint32_t>(generate(0, static_cast<int>(bound) - 1));
+        }
+    }
+    
+    void fillBytes(void* out, size_t length) override {
+        auto* bytes = static_cast<uint8_t*>(out);
+        for (size_t i = 0; i < length; ++i) {
+            bytes[i] = static_cast<uint8_t>(generate(0, 255));
+        }
+    }
+    
     void reset() {
         index = 0;
     }
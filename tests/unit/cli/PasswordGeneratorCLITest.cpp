@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include "cli/PasswordGeneratorCLI.h"
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using password_generator::cli::PasswordGeneratorCLI;
+
+namespace {
+
+int run(std::vector<std::string> args) {
+    args.insert(args.begin(), "dbgpass");
+    std::vector<char*> argv;
+    for (std::string& arg : args) {
+        argv.push_back(&arg[0]);
+    }
+    PasswordGeneratorCLI cli;
+    return cli.processArgs(static_cast<int>(argv.size()), argv.data());
+}
+
+} // namespace
+
+TEST(PasswordGeneratorCLITest, RejectsCharsetFileThatEmptiesRequiredSet) {
+    // The default config requires digits; a charset without any used to
+    // drop the digit set and exit 0
+    const std::string path = testing::TempDir() + "cli_charset_test.txt";
+    {
+        std::ofstream out(path);
+        out << "abcdefXYZ";
+    }
+    for (const std::vector<std::string>& mode : {std::vector<std::string>{"-b", "5"},
+                                                 std::vector<std::string>{"--weight", "digits=2", "-b", "5"},
+                                                 std::vector<std::string>{"--compliant", "-g"}}) {
+        std::vector<std::string> args = {"-q", "--charset-file", path, "-l", "12"};
+        args.insert(args.end(), mode.begin(), mode.end());
+        testing::internal::CaptureStdout();
+        testing::internal::CaptureStderr();
+        const int result = run(args);
+        const std::string output = testing::internal::GetCapturedStdout();
+        const std::string errors = testing::internal::GetCapturedStderr();
+        EXPECT_NE(result, 0) << mode.front();
+        EXPECT_TRUE(output.empty()) << output;
+        EXPECT_NE(errors.find("'Digits'"), std::string::npos) << errors;
+    }
+
+    // Without the requirement the set is simply left out
+    testing::internal::CaptureStdout();
+    EXPECT_EQ(run({"-q", "--no-digits", "--no-symbols", "--charset-file", path, "-l", "12", "-b", "3"}), 0);
+    const std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(output.size(), 3u * 13u);
+    EXPECT_EQ(output.find_first_not_of("abcdefXYZ\n"), std::string::npos) << output;
+    std::remove(path.c_str());
+}
+
+TEST(PasswordGeneratorCLITest, ReportsUniquePositionOnlyWithKeyFile) {
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+    EXPECT_EQ(run({"-q", "-u", "-l", "12", "-b", "3"}), 0);
+    testing::internal::GetCapturedStdout();
+    EXPECT_EQ(testing::internal::GetCapturedStderr(), "");
+
+    const std::string key = testing::TempDir() + "cli_unique_test.key";
+    {
+        std::ofstream out(key, std::ios::binary);
+        out << "0123456789abcdef0123456789abcdef";
+    }
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+    EXPECT_EQ(run({"-q", "-u", "--key-file", key, "-l", "12", "-b", "3"}), 0);
+    testing::internal::GetCapturedStdout();
+    const std::string errors = testing::internal::GetCapturedStderr();
+    EXPECT_NE(errors.find("(continue with --start "), std::string::npos) << errors;
+
+    // A run that exhausts the 10^8 digit passwords still says where it stopped
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+    EXPECT_NE(run({"-q", "-u", "--key-file", key, "--no-uppercase", "--no-lowercase", "--no-symbols",
+                   "-l", "8", "--start", "99999995", "-b", "20"}), 0);
+    testing::internal::GetCapturedStdout();
+    const std::string failed = testing::internal::GetCapturedStderr();
+    EXPECT_NE(failed.find("Error: "), std::string::npos) << failed;
+    EXPECT_NE(failed.find("Next unique position: "), std::string::npos) << failed;
+    std::remove(key.c_str());
+}
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include "providers/LowercaseProvider.h"
+#include "providers/UppercaseProvider.h"
+#include "providers/DigitProvider.h"
+#include "providers/SymbolProvider.h"
+#include "utils/CharacterTable.h"
+
+using namespace password_generator::providers;
+using namespace password_generator::utils;
+
+namespace {
+
+// A provider that only implements the plain string contract
+class PlainProvider : public password_generator::core::interfaces::ICharacterSetProvider {
+public:
+    std::string getCharacters() const override { return "xyz"; }
+    std::string getName() const override { return "Plain"; }
+};
+
+} // namespace
+
+TEST(CharacterProvidersTest, BuiltInProvidersShareConstantTables) {
+    static_assert(tables::DIGITS.size() == 10, "digit table is built at compile time");
+    static_assert(tables::LOWERCASE.contains('q') && !tables::LOWERCASE.contains('Q'),
+                  "membership is available at compile time");
+
+    LowercaseProvider lower;
+    UppercaseProvider upper;
+    DigitProvider digits;
+
+    EXPECT_EQ(&lower.getTable(), &tables::LOWERCASE);
+    EXPECT_EQ(&upper.getTable(), &tables::UPPERCASE);
+    EXPECT_EQ(&digits.getTable(), &tables::DIGITS);
+    EXPECT_EQ(lower.getCharacters(), "abcdefghijklmnopqrstuvwxyz");
+    EXPECT_EQ(digits.getCharacters(), "0123456789");
+}
+
+TEST(CharacterProvidersTest, SymbolTableTracksOwnedStorage) {
+    SymbolProvider symbols("!@#");
+    EXPECT_TRUE(symbols.getTable().contains('@'));
+    EXPECT_FALSE(symbols.getTable().contains('a'));
+
+    symbols.setSymbols("a long symbol set that defeats small-string storage");
+    EXPECT_TRUE(symbols.getTable().contains('a'));
+    EXPECT_FALSE(symbols.getTable().contains('@'));
+    EXPECT_EQ(symbols.getTable().characters().data(), symbols.getSymbols().data());
+
+    SymbolProvider copy(symbols);
+    symbols.setSymbols("$");
+    EXPECT_EQ(copy.getTable().characters(), copy.getSymbols());
+    EXPECT_NE(copy.getTable().characters().data(), symbols.getSymbols().data());
+
+    copy = symbols;
+    EXPECT_EQ(copy.getCharacters(), "$");
+    EXPECT_TRUE(copy.getTable().contains('$'));
+}
+
+TEST(CharacterProvidersTest, TableLookupFallsBackForPlainProviders) {
+    PlainProvider plain;
+    DigitProvider digits;
+
+    EXPECT_EQ(characterTableOf(plain), nullptr);
+    EXPECT_EQ(characterTableOf(digits), &tables::DIGITS);
+}
+
+TEST(CharacterProvidersTest, MembershipCoversAllByteValues) {
+    CharacterTable table("\x01\x7f\x80\xff");
+    int members = 0;
+    for (int byte = 0; byte < 256; ++byte) {
+        members += table.contains(static_cast<char>(byte));
+    }
+    EXPECT_EQ(members, 4);
+    EXPECT_TRUE(table.contains('\xff'));
+    EXPECT_FALSE(table.contains('\0'));
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include "strategies/BatchPasswordStrategy.h"
+#include "strategies/StandardPasswordStrategy.h"
+#include "strategies/PronounceablePasswordStrategy.h"
+#include "strategies/PatternPasswordStrategy.h"
+#include "providers/LowercaseProvider.h"
+#include "providers/DigitProvider.h"
+#include "providers/SymbolProvider.h"
+#include "utils/BulkRandomGenerator.h"
+#include <memory>
+#include <string>
+
+using namespace password_generator::strategies;
+using namespace password_generator::providers;
+
+namespace {
+
+// The n-th value drawn depends only on n, however draws are grouped into
+// calls, so batched and sequential generation can be compared exactly
+class CounterRandomGenerator : public password_generator::utils::IBulkRandomGenerator {
+public:
+    int generate(int min, int max) override {
+        return min + static_cast<int>(next() % static_cast<uint64_t>(max - min + 1));
+    }
+
+    void generateBounded(uint32_t* values, size_t count) override {
+        for (size_t i = 0; i < count; ++i) {
+            values[i] = static_cast<uint32_t>(next() % values[i]);
+        }
+    }
+
+    void generateIndices(uint32_t* out, size_t count, uint32_t bound) override {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = static_cast<uint32_t>(next() % bound);
+        }
+    }
+
+    void fillBytes(void* out, size_t length) override {
+        auto* bytes = static_cast<uint8_t*>(out);
+        for (size_t i = 0; i < length; ++i) {
+            bytes[i] = static_cast<uint8_t>(next());
+        }
+    }
+
+private:
+    uint64_t counter_ = 0;
+
+    // splitmix64
+    uint64_t next() {
+        uint64_t z = (counter_ += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+};
+
+// A batch from one generator must equal generate() calls on a twin
+template <typename Make>
+void expectBatchMatchesSequential(Make make, size_t count, size_t length) {
+    auto batched = make();
+    auto sequential = make();
+    std::string buffer(count * length, '\0');
+    batched->generateBatch(&buffer[0], count, length);
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_EQ(buffer.substr(i * length, length), sequential->generate(length)) << i;
+    }
+}
+
+// Counts generate() calls for the fallback path
+class SequenceStrategy : public password_generator::core::interfaces::IPasswordStrategy {
+public:
+    int calls = 0;
+
+    std::string generate(size_t length) override {
+        return std::string(length, static_cast<char>('a' + calls++));
+    }
+};
+
+} // namespace
+
+TEST(BatchPasswordStrategyTest, StandardBatchMatchesSequentialDraws) {
+    auto make = []() {
+        auto strategy = std::make_unique<StandardPasswordStrategy>(std::make_unique<CounterRandomGenerator>());
+        strategy->addCharacterSet(std::make_unique<LowercaseProvider>());
+        strategy->addCharacterSet(std::make_unique<DigitProvider>(), 2.0);
+        strategy->addCharacterSet(std::make_unique<SymbolProvider>());
+        return strategy;
+    };
+    // 16384 / 31 draws per password = 528 per chunk, so this spans chunks
+    expectBatchMatchesSequential(make, 1200, 16);
+    expectBatchMatchesSequential(make, 3, 1);
+}
+
+TEST(BatchPasswordStrategyTest, PronounceableAndPatternBatchesMatchSequentialDraws) {
+    expectBatchMatchesSequential([]() {
+        return std::make_unique<PronounceablePasswordStrategy>(std::make_unique<CounterRandomGenerator>());
+    }, 3000, 11);
+    expectBatchMatchesSequential([]() {
+        return std::make_unique<PatternPasswordStrategy>("Ull-DD{2}S?d", std::make_unique<CounterRandomGenerator>());
+    }, 2000, 14);
+}
+
+TEST(BatchPasswordStrategyTest, FallsBackToGenerate) {
+    SequenceStrategy strategy;
+    char buffer[9];
+    generateBatch(strategy, buffer, 3, 3);
+    EXPECT_EQ(std::string(buffer, 9), "aaabbbccc");
+    EXPECT_EQ(strategy.calls, 3);
+
+    StandardPasswordStrategy empty;
+    EXPECT_THROW(generateBatch(empty, buffer, 1, 8), std::runtime_error);
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include "strategies/CompliantPasswordStrategy.h"
+#include "providers/DigitProvider.h"
+#include "providers/LowercaseProvider.h"
+#include "providers/SymbolProvider.h"
+#include "providers/UppercaseProvider.h"
+#include "validators/CharacterTypeValidator.h"
+#include <map>
+
+using namespace password_generator::strategies;
+using namespace password_generator::providers;
+using password_generator::utils::BigUint;
+using password_generator::validators::CharacterTypeValidator;
+
+TEST(CompliantPasswordStrategyTest, GeneratesOnlyCompliantPasswords) {
+    CompliantPasswordStrategy strategy;
+    strategy.addCharacterSet(std::make_unique<LowercaseProvider>());
+    strategy.addCharacterSet(std::make_unique<UppercaseProvider>());
+    strategy.addCharacterSet(std::make_unique<DigitProvider>());
+    strategy.addCharacterSet(std::make_unique<SymbolProvider>("!@#"));
+
+    CharacterTypeValidator validator(true, true, true, true);
+    strategy.setRequirements(validator);
+    for (int i = 0; i < 500; ++i) {
+        std::string password = strategy.generate(8);
+        EXPECT_EQ(password.size(), 8u);
+        EXPECT_TRUE(validator.validate(password)) << password;
+    }
+}
+
+TEST(CompliantPasswordStrategyTest, CountsByInclusionExclusion) {
+    CompliantPasswordStrategy strategy;
+    strategy.addCharacterSet(std::make_unique<LowercaseProvider>());
+    strategy.addCharacterSet(std::make_unique<DigitProvider>());
+    strategy.setRequiredTypes(CharacterTypeValidator::LOWERCASE | CharacterTypeValidator::DIGIT);
+
+    // 36^3 - 26^3 - 10^3
+    EXPECT_EQ(strategy.getKeyspace(3).toString(), "28080");
+    EXPECT_TRUE(strategy.getKeyspace(1).isZero());
+    EXPECT_EQ(strategy.getKeyspace(16), BigUint::pow(36, 16) - BigUint::pow(26, 16) -
+                                            BigUint::pow(10, 16));
+    EXPECT_NEAR(strategy.getEntropyBits(16), strategy.getKeyspace(16).log2(), 1e-12);
+
+    // A type with no characters can never be satisfied
+    strategy.setRequiredTypes(CharacterTypeValidator::UPPERCASE);
+    EXPECT_TRUE(strategy.getKeyspace(8).isZero());
+    EXPECT_THROW(strategy.generate(8), std::runtime_error);
+}
+
+TEST(CompliantPasswordStrategyTest, SamplesUniformly) {
+    // "Ab1" with all three types required: the 6 permutations of length 3
+    CompliantPasswordStrategy strategy;
+    strategy.addCharacterSet(std::make_unique<SymbolProvider>("Ab1"));
+    strategy.setRequiredTypes(CharacterTypeValidator::UPPERCASE |
+                              CharacterTypeValidator::LOWERCASE | CharacterTypeValidator::DIGIT);
+    strategy.setLengthRange(1, 3);
+    ASSERT_EQ(strategy.getKeyspace(3).toString(), "6");
+
+    std::map<std::string, int> seen;
+    const int draws = 12000;
+    for (int i = 0; i < draws; ++i) {
+        ++seen[strategy.generate(3)];
+    }
+    ASSERT_EQ(seen.size(), 6u);
+    for (const auto& entry : seen) {
+        EXPECT_NEAR(entry.second, draws / 6, 250) << entry.first;
+    }
+}
+
+TEST(CompliantPasswordStrategyTest, WeightsLengthsByTheirCounts) {
+    // Upper case required over "Ab": "A" plus "AA", "Ab", "bA"
+    CompliantPasswordStrategy strategy;
+    strategy.addCharacterSet(std::make_unique<SymbolProvider>("Ab"));
+    strategy.setRequiredTypes(CharacterTypeValidator::UPPERCASE);
+    strategy.setLengthRange(1, 2);
+    ASSERT_EQ(strategy.getKeyspace().toString(), "4");
+    EXPECT_DOUBLE_EQ(strategy.getEntropyBits(), 2.0);
+
+    std::map<std::string, int> seen;
+    const int draws = 12000;
+    for (int i = 0; i < draws; ++i) {
+        ++seen[strategy.generateInRange()];
+    }
+    ASSERT_EQ(seen.size(), 4u);
+    for (const auto& entry : seen) {
+        EXPECT_NEAR(entry.second, draws / 4, 300) << entry.first;
+    }
+
+    EXPECT_THROW(strategy.generate(3), std::invalid_argument);
+    EXPECT_THROW(strategy.setLengthRange(3, 2), std::invalid_argument);
+    EXPECT_THROW(strategy.setLengthRange(0, 2), std::invalid_argument);
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include "strategies/FixedAlphabetStrategy.h"
+#include "validators/CharacterTypeValidator.h"
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace password_generator::strategies;
+using password_generator::validators::CharacterTypeValidator;
+
+namespace {
+
+// Replays fixed words
+struct SequenceWords {
+    std::vector<uint64_t> words;
+    size_t next = 0;
+
+    uint64_t next64() {
+        return words.at(next++);
+    }
+};
+
+inline constexpr char LOWER_AND_DIGITS[] = "ab01";
+
+constexpr unsigned ALL_TYPES = CharacterTypeValidator::UPPERCASE |
+                               CharacterTypeValidator::LOWERCASE |
+                               CharacterTypeValidator::DIGIT | CharacterTypeValidator::SYMBOL;
+
+} // namespace
+
+TEST(FixedAlphabetStrategyTest, ComputesPolicyAtCompileTime) {
+    using Hex = FixedAlphabetStrategy<alphabets::HEX, 8>;
+    static_assert(Hex::ALPHABET_SIZE == 16);
+    static_assert(Hex::CHARACTERS_PER_WORD == 15);
+    static_assert(FixedAlphabetStrategy<alphabets::PRINTABLE, 16>::ALPHABET_SIZE == 88);
+    static_assert(FixedAlphabetStrategy<alphabets::PRINTABLE, 16>::CHARACTERS_PER_WORD == 9);
+
+    EXPECT_NEAR((FixedAlphabetStrategy<alphabets::ALPHANUMERIC, 8>::getEntropyBits()),
+                8 * std::log2(62.0), 1e-9);
+
+    // 4^2 strings over "ab01", minus 2^2 without a letter and 2^2 without a digit
+    EXPECT_NEAR((FixedAlphabetStrategy<LOWER_AND_DIGITS, 2,
+                 CharacterTypeValidator::LOWERCASE | CharacterTypeValidator::DIGIT>
+                 ::getEntropyBits()), std::log2(8.0), 1e-9);
+}
+
+TEST(FixedAlphabetStrategyTest, PeelsCharactersFromEachWord) {
+    // A power-of-two alphabet takes the word's bits from the top down
+    FixedAlphabetStrategy<alphabets::HEX, 20, 0, SequenceWords> strategy(
+        SequenceWords{{0x0123456789ABCDEFull, 0xFEDCBA9876543210ull}});
+    char password[20];
+    strategy.generateFixed(password);
+    EXPECT_EQ(std::string(password, 20), "0123456789abcdefedcb");
+}
+
+TEST(FixedAlphabetStrategyTest, RedrawsPasswordsMissingARequiredType) {
+    // "ab" lacks a digit and is redrawn; "a0" complies
+    FixedAlphabetStrategy<LOWER_AND_DIGITS, 2,
+                          CharacterTypeValidator::LOWERCASE | CharacterTypeValidator::DIGIT,
+                          SequenceWords> strategy(
+        SequenceWords{{0x1000000000000000ull, 0x2000000000000000ull}});
+    char password[2];
+    strategy.generateFixed(password);
+    EXPECT_EQ(std::string(password, 2), "a0");
+}
+
+TEST(FixedAlphabetStrategyTest, PlugsIntoPasswordStrategyInterface) {
+    FixedAlphabetStrategy<alphabets::PRINTABLE, 12, ALL_TYPES> fixed;
+    password_generator::core::interfaces::IPasswordStrategy& strategy = fixed;
+    const CharacterTypeValidator validator(true, true, true, true);
+    for (int i = 0; i < 200; ++i) {
+        std::string password = strategy.generate(12);
+        ASSERT_EQ(password.size(), 12u);
+        EXPECT_TRUE(validator.validate(password)) << password;
+        EXPECT_EQ(password.find_first_not_of(alphabets::PRINTABLE), std::string::npos);
+    }
+    EXPECT_THROW(strategy.generate(11), std::invalid_argument);
+}
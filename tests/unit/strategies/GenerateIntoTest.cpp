@@ -0,0 +1,27 @@
+#include <gtest/gtest.h>
+#include "strategies/PatternPasswordStrategy.h"
+#include "validators/EntropyValidator.h"
+#include <string>
+
+using namespace password_generator::strategies;
+using namespace password_generator::validators;
+
+TEST(GenerateIntoTest, StringApiWrapsBuffer) {
+    PatternPasswordStrategy pattern("abc-D");
+    char buffer[10];
+    pattern.generateInto(buffer, 10);
+    EXPECT_EQ(std::string(buffer, 4), "abc-");
+    EXPECT_EQ(pattern.generate(7).substr(0, 4), "abc-");
+}
+
+TEST(GenerateIntoTest, EntropyCountsRepeatedCodePointsWithoutTables) {
+    // Six code points with e-acute twice: 6 * log2(6) - 2 * log2(2) = 13.51 bits
+    const std::string text = "\xC3\xA9x\xCE\xB1\xC3\xA9y!";
+    EXPECT_TRUE(EntropyValidator(13.5).validate(text.data(), text.size()));
+    EXPECT_FALSE(EntropyValidator(13.6).validate(text.data(), text.size()));
+
+    // Malformed bytes stand for themselves
+    const std::string malformed = "\xFF\xFF";
+    EXPECT_TRUE(EntropyValidator(0.0).validate(malformed.data(), malformed.size()));
+    EXPECT_FALSE(EntropyValidator(0.1).validate(malformed.data(), malformed.size()));
+}
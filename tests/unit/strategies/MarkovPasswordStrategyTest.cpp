@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include "strategies/MarkovPasswordStrategy.h"
+#include "strategies/MarkovTrainer.h"
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+using namespace password_generator::strategies;
+
+namespace {
+
+std::string writeModel(const MarkovTrainer& trainer, const std::string& name) {
+    std::string path = ::testing::TempDir() + name;
+    trainer.write(path);
+    return path;
+}
+
+} // namespace
+
+TEST(MarkovPasswordStrategyTest, GeneratesWordsFromTheModelAlphabet) {
+    MarkovTrainer trainer(3);
+    std::istringstream corpus("Alpha bravo, charlie delta echo foxtrot golf hotel india juliet kilo");
+    trainer.addText(corpus, {true, true});
+    EXPECT_EQ(trainer.wordCount(), 11u);
+
+    MarkovPasswordStrategy strategy(writeModel(trainer, "markov-alphabet.bin"));
+    EXPECT_EQ(strategy.getModel().order(), 3u);
+    for (int i = 0; i < 50; ++i) {
+        std::string password = strategy.generate(20);
+        ASSERT_EQ(password.size(), 20u);
+        EXPECT_NE(password[0], '-');
+        for (char c : password) {
+            EXPECT_TRUE((c >= 'a' && c <= 'z') || c == '-') << password;
+        }
+        EXPECT_NEAR(strategy.getModel().surprisalBits(password, '-'),
+                    strategy.getLastEntropyBits(), 1e-9) << password;
+    }
+}
+
+TEST(MarkovPasswordStrategyTest, ReportsExactEntropy) {
+    // After 'a': b with 3/4, c with 1/4; every word then ends
+    MarkovTrainer trainer(2);
+    for (const char* word : {"ab", "ab", "ab", "ac"}) {
+        trainer.addWord(word);
+    }
+    MarkovPasswordStrategy strategy(writeModel(trainer, "markov-exact.bin"));
+
+    std::map<std::string, int> seen;
+    for (int i = 0; i < 4000; ++i) {
+        std::string password = strategy.generate(6);
+        ++seen[password.substr(0, 2)];
+        double expected = 0.0;
+        for (size_t w = 0; w < 2; ++w) {
+            expected += password[3 * w + 1] == 'b' ? std::log2(4.0 / 3.0) : 2.0;
+        }
+        EXPECT_NEAR(strategy.getLastEntropyBits(), expected, 1e-9) << password;
+    }
+    ASSERT_EQ(seen.size(), 2u);
+    EXPECT_NEAR(seen["ab"], 3000, 150);
+
+    EXPECT_TRUE(std::isinf(strategy.getModel().surprisalBits("ad", '-')));
+    EXPECT_TRUE(std::isinf(strategy.getModel().surprisalBits("abc", '-')));
+}
+
+TEST(MarkovPasswordStrategyTest, AliasTablesAreExact) {
+    MarkovTrainer trainer(2);
+    for (const char* word : {"xa", "xa", "xa", "xa", "xa", "xb", "xb", "xc", "xd", "xd", "xd"}) {
+        trainer.addWord(word);
+    }
+    auto model = MarkovModel::load(writeModel(trainer, "markov-alias.bin"));
+
+    MarkovModel::Table table;
+    ASSERT_TRUE(model->lookup(model->symbolOf('x'), table));
+    ASSERT_EQ(table.size, 4u);
+    ASSERT_EQ(table.total, 11u);
+
+    // Every (column, u) pair is equally likely, so the tallies are exact
+    std::map<char, uint32_t> tally;
+    for (uint32_t column = 0; column < table.size; ++column) {
+        for (uint32_t u = 0; u < table.total; ++u) {
+            ++tally[model->symbolChar(model->sample(table, column, u).symbol)];
+        }
+    }
+    EXPECT_EQ(tally['a'], 5u * 4);
+    EXPECT_EQ(tally['b'], 2u * 4);
+    EXPECT_EQ(tally['c'], 1u * 4);
+    EXPECT_EQ(tally['d'], 3u * 4);
+}
+
+TEST(MarkovPasswordStrategyTest, EnforcesMinimumEntropyAndSeparator) {
+    MarkovTrainer trainer(2);
+    trainer.addWord("abc");
+    MarkovPasswordStrategy strategy(writeModel(trainer, "markov-fixed.bin"));
+
+    EXPECT_EQ(strategy.generate(10), "abc-abc-ab");
+    EXPECT_DOUBLE_EQ(strategy.getLastEntropyBits(), 0.0);
+
+    strategy.setSeparator('.');
+    EXPECT_EQ(strategy.generate(5), "abc.a");
+    EXPECT_THROW(strategy.setSeparator('b'), std::invalid_argument);
+
+    strategy.setMinEntropyBits(1.0);
+    EXPECT_THROW(strategy.generate(8), std::runtime_error);
+}
+
+TEST(MarkovPasswordStrategyTest, RejectsInvalidInput) {
+    EXPECT_THROW(MarkovTrainer(1), std::invalid_argument);
+    EXPECT_THROW(MarkovTrainer(5), std::invalid_argument);
+    EXPECT_THROW(MarkovTrainer(2).compile(), std::runtime_error);
+    EXPECT_THROW(MarkovTrainer(2).addWord("a b"), std::invalid_argument);
+
+    EXPECT_THROW(MarkovPasswordStrategy(::testing::TempDir() + "markov-missing.bin"),
+                 std::runtime_error);
+
+    std::string path = ::testing::TempDir() + "markov-corrupt.bin";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << std::string(400, 'x');
+    }
+    EXPECT_THROW(MarkovModel::load(path), std::runtime_error);
+
+    // A truncated file keeps its header but loses the tables
+    MarkovTrainer trainer(2);
+    trainer.addWord("abc");
+    std::vector<uint8_t> bytes = trainer.compile();
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(bytes.data()),
+                  static_cast<std::streamsize>(bytes.size() - 4));
+    }
+    MarkovPasswordStrategy truncated(path);
+    EXPECT_THROW(truncated.generate(12), std::runtime_error);
+}
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "strategies/ParallelBatchGenerator.h"
+#include "strategies/StandardPasswordStrategy.h"
+#include "providers/LowercaseProvider.h"
+#include "providers/DigitProvider.h"
+#include <atomic>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+
+using namespace password_generator;
+using namespace password_generator::strategies;
+
+namespace {
+
+ParallelBatchGenerator::StrategyFactory standardFactory(std::atomic<size_t>* calls = nullptr) {
+    return [calls](std::unique_ptr<core::interfaces::IRandomGenerator> rng)
+               -> std::unique_ptr<core::interfaces::IPasswordStrategy> {
+        if (calls) {
+            ++*calls;
+        }
+        auto strategy = std::make_unique<StandardPasswordStrategy>(std::move(rng));
+        strategy->addCharacterSet(std::make_unique<providers::LowercaseProvider>());
+        strategy->addCharacterSet(std::make_unique<providers::DigitProvider>());
+        return strategy;
+    };
+}
+
+std::string seededBatch(size_t threads, uint8_t seedByte, size_t count, size_t length) {
+    ParallelBatchGenerator generator(standardFactory(), threads);
+    uint8_t seed[32];
+    for (uint8_t& byte : seed) {
+        byte = seedByte;
+    }
+    generator.setSeed(seed);
+    std::string batch(count * length, '\0');
+    generator.generate(&batch[0], count, length);
+    return batch;
+}
+
+class FailingStrategy : public core::interfaces::IPasswordStrategy {
+public:
+    std::string generate(size_t) override {
+        throw std::runtime_error("generation failed");
+    }
+};
+
+} // namespace
+
+TEST(ParallelBatchGeneratorTest, SeededBatchIsTheSameForAnyThreadCount) {
+    // Several slices plus a partial one
+    const size_t count = 5 * ParallelBatchGenerator::SLICE_PASSWORDS + 17;
+    const std::string single = seededBatch(1, 7, count, 12);
+    EXPECT_EQ(seededBatch(3, 7, count, 12), single);
+    EXPECT_EQ(seededBatch(8, 7, count, 12), single);
+    EXPECT_NE(seededBatch(3, 8, count, 12), single);
+}
+
+TEST(ParallelBatchGeneratorTest, FillsEverySlotWithDistinctPasswords) {
+    std::atomic<size_t> calls{0};
+    ParallelBatchGenerator generator(standardFactory(&calls), 4);
+    const size_t count = 20000;
+    const size_t length = 16;
+    for (int round = 0; round < 2; ++round) {
+        std::string batch(count * length, '\0');
+        generator.generate(&batch[0], count, length);
+        EXPECT_EQ(batch.find('\0'), std::string::npos);
+
+        std::set<std::string> unique;
+        for (size_t i = 0; i < count; ++i) {
+            unique.insert(batch.substr(i * length, length));
+        }
+        EXPECT_EQ(unique.size(), count);
+    }
+    // Strategies persist across batches, at most one per worker
+    EXPECT_LE(calls.load(), generator.threadCount());
+}
+
+TEST(ParallelBatchGeneratorTest, RethrowsWorkerErrors) {
+    ParallelBatchGenerator generator([](std::unique_ptr<core::interfaces::IRandomGenerator>)
+                                         -> std::unique_ptr<core::interfaces::IPasswordStrategy> {
+        return std::make_unique<FailingStrategy>();
+    }, 4);
+    std::string batch(10000 * 8, '\0');
+    EXPECT_THROW(generator.generate(&batch[0], 10000, 8), std::runtime_error);
+    // The pool is still usable after a failed batch
+    EXPECT_THROW(generator.generate(&batch[0], 10000, 8), std::runtime_error);
+}
@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include "strategies/PassphrasePasswordStrategy.h"
+#include "mocks/MockRandomGenerator.h"
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <regex>
+
+using namespace password_generator::strategies;
+using password_generator::tests::MockRandomGenerator;
+using password_generator::utils::BigUint;
+
+namespace {
+
+std::string writeList(std::vector<std::string> words, const std::string& name) {
+    std::string path = ::testing::TempDir() + name;
+    WordList::write(std::move(words), path);
+    return path;
+}
+
+} // namespace
+
+TEST(PassphrasePasswordStrategyTest, CompilesSortedDistinctWords) {
+    auto list = WordList::load(writeList({"delta", "alpha", "charlie", "alpha", "bravo"},
+                                         "wordlist-basic.bin"));
+    ASSERT_EQ(list->size(), 4u);
+    EXPECT_EQ((*list)[0], "alpha");
+    EXPECT_EQ((*list)[3], "delta");
+    EXPECT_EQ(list->maxWordLength(), 7u);
+
+    EXPECT_THROW(WordList::compile({"one", "one"}), std::invalid_argument);
+    EXPECT_THROW(WordList::compile({"two words", "three"}), std::invalid_argument);
+    EXPECT_THROW(WordList::compile({"", "x", "y"}), std::invalid_argument);
+}
+
+TEST(PassphrasePasswordStrategyTest, GeneratesWordsWithSeparators) {
+    std::string path = writeList({"apple", "berry", "cherry", "damson", "elder", "fig"},
+                                 "wordlist-fruit.bin");
+    PassphrasePasswordStrategy strategy(path);
+    const std::regex shape("(apple|berry|cherry|damson|elder|fig)(-(apple|berry|cherry|damson|elder|fig)){5}");
+    for (int i = 0; i < 20; ++i) {
+        std::string passphrase = strategy.generate(0);
+        EXPECT_TRUE(std::regex_match(passphrase, shape)) << passphrase;
+    }
+
+    strategy.setWordCount(3);
+    strategy.setSeparator(" ");
+    strategy.setCapitalize(true);
+    strategy.setDigitCount(2);
+    const std::regex decorated("[A-Z][a-z]+[0-9]?( [A-Z][a-z]+[0-9]?){2}");
+    for (int i = 0; i < 20; ++i) {
+        std::string passphrase = strategy.generate(0);
+        EXPECT_TRUE(std::regex_match(passphrase, decorated)) << passphrase;
+        EXPECT_EQ(std::count_if(passphrase.begin(), passphrase.end(), ::isdigit), 2) << passphrase;
+    }
+}
+
+TEST(PassphrasePasswordStrategyTest, DecodesBulkDraws) {
+    // Words 2, 0, 1; digit slots: word 2 (swapped to front), then word 1; digits 7, 3
+    auto rng = std::make_unique<MockRandomGenerator>(std::vector<int>{2, 0, 1, 2, 0, 7, 3});
+    PassphrasePasswordStrategy strategy(
+        WordList::load(writeList({"ant", "bee", "cat"}, "wordlist-mock.bin")), std::move(rng));
+    strategy.setWordCount(3);
+    strategy.setDigitCount(2);
+    EXPECT_EQ(strategy.generate(0), "cat-ant3-bee7");
+}
+
+TEST(PassphrasePasswordStrategyTest, ReportsExactKeyspace) {
+    std::vector<std::string> words;
+    for (int i = 0; i < 7776; ++i) {
+        words.push_back("w" + std::to_string(i) + "x");
+    }
+    PassphrasePasswordStrategy strategy(WordList::load(writeList(words, "wordlist-7776.bin")));
+    EXPECT_EQ(strategy.getKeyspace(), BigUint::pow(7776, 6));
+    EXPECT_NEAR(strategy.getEntropyBits(), 6 * std::log2(7776.0), 1e-9);
+
+    strategy.setDigitCount(2);   // C(6,2) * 100 = 1500
+    EXPECT_EQ(strategy.getKeyspace(), BigUint::pow(7776, 6) * BigUint(1500));
+    EXPECT_THROW(strategy.setDigitCount(7), std::invalid_argument);
+    EXPECT_THROW(strategy.setWordCount(1), std::invalid_argument);
+}
+
+TEST(PassphrasePasswordStrategyTest, RejectsOptionsThatPrintTwoChoicesAlike) {
+    PassphrasePasswordStrategy strategy(WordList::load(
+        writeList({"apple", "Apple", "pear", "plum2", "t-shirt"}, "wordlist-ambiguous.bin")));
+    EXPECT_THROW(strategy.getKeyspace(), std::invalid_argument);   // "t-shirt" holds "-"
+
+    strategy.setSeparator(" ");
+    EXPECT_NO_THROW(strategy.generate(0));
+    strategy.setCapitalize(true);    // "apple" prints as "Apple"
+    EXPECT_THROW(strategy.generate(0), std::invalid_argument);
+    strategy.setCapitalize(false);
+    strategy.setDigitCount(1);       // "plum2" reads as "plum" + 2
+    EXPECT_THROW(strategy.getKeyspace(), std::invalid_argument);
+    strategy.setDigitCount(0);
+    strategy.setSeparator("");
+    EXPECT_THROW(strategy.generate(0), std::invalid_argument);
+    strategy.setSeparator(".");
+    EXPECT_EQ(strategy.getKeyspace(), BigUint::pow(5, 6));
+}
+
+TEST(PassphrasePasswordStrategyTest, RecordsListFactsInHeader) {
+    auto plain = WordList::load(writeList({"kiwi", "lime", "mango"}, "wordlist-plain.bin"));
+    EXPECT_TRUE(plain->usesByte('k'));
+    EXPECT_FALSE(plain->usesByte('-'));
+    EXPECT_FALSE(plain->hasWordEndingInDigit());
+    EXPECT_FALSE(plain->hasCapitalCollision());
+
+    auto marked = WordList::load(writeList({"kiwi", "Kiwi", "lime7"}, "wordlist-marked.bin"));
+    EXPECT_TRUE(marked->usesByte('K'));
+    EXPECT_TRUE(marked->hasWordEndingInDigit());
+    EXPECT_TRUE(marked->hasCapitalCollision());
+
+    auto compile = [](std::vector<std::string> words) {
+        return WordList::load(writeList(std::move(words), "wordlist-capitals.bin"))->hasCapitalCollision();
+    };
+    EXPECT_FALSE(compile({"Apple", "Bee", "apples", "bees", "zebra"}));
+    EXPECT_TRUE(compile({"Apple", "Bee", "Zebra", "apples", "bee"}));
+    EXPECT_TRUE(compile({"Apples", "Zebra", "ant", "zebra"}));
+
+    // Only a multi-byte separator made of used bytes needs the words themselves
+    PassphrasePasswordStrategy strategy(plain);
+    strategy.setSeparator("im");
+    EXPECT_THROW(strategy.generate(0), std::invalid_argument);   // "lime"
+    strategy.setSeparator("mi");
+    EXPECT_NO_THROW(strategy.generate(0));
+    strategy.setSeparator("M");
+    EXPECT_NO_THROW(strategy.generate(0));
+    strategy.setCapitalize(true);                                 // "Mango"
+    EXPECT_THROW(strategy.generate(0), std::invalid_argument);
+    strategy.setSeparator("Ma");
+    EXPECT_THROW(strategy.generate(0), std::invalid_argument);
+    strategy.setSeparator("Ki");
+    EXPECT_THROW(strategy.generate(0), std::invalid_argument);
+    strategy.setSeparator("Li-");
+    EXPECT_NO_THROW(strategy.generate(0));
+}
+
+TEST(PassphrasePasswordStrategyTest, RejectsInvalidFiles) {
+    EXPECT_THROW(WordList::load(::testing::TempDir() + "wordlist-missing.bin"), std::runtime_error);
+
+    std::vector<uint8_t> bytes = WordList::compile({"alpha", "beta", "gamma"});
+    std::string path = ::testing::TempDir() + "wordlist-truncated.bin";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(bytes.data()),
+                  static_cast<std::streamsize>(bytes.size() - 1));
+    }
+    EXPECT_THROW(WordList::load(path), std::runtime_error);
+
+    // Lists from before the header facts must be recompiled
+    bytes[6] = '1';
+    {
+        std::ofstream out(path, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+    EXPECT_THROW(WordList::load(path), std::runtime_error);
+}
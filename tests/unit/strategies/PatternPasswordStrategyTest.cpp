@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include "strategies/PatternPasswordStrategy.h"
+#include <cmath>
+#include <regex>
+
+using namespace password_generator::strategies;
+
+TEST(PatternPasswordStrategyTest, KeepsClassicTokensAndRepeatsPattern) {
+    PatternPasswordStrategy strategy("ULL-DDD");
+
+    std::string password = strategy.generate(14);
+    EXPECT_TRUE(std::regex_match(password, std::regex("[A-Z][a-z]{2}-[0-9]{3}[A-Z][a-z]{2}-[0-9]{3}")))
+        << password;
+    EXPECT_EQ(strategy.getKeyspace(7).toString(), "17576000");
+}
+
+TEST(PatternPasswordStrategyTest, CompilesQuantifiersClassesAndEscapes) {
+    PatternPasswordStrategy strategy("\\L\\D-L{4}D{2}[a-f0-9]{3}");
+    EXPECT_EQ(strategy.getProgram().length(), 12u);
+
+    // Literal run, then one op per class run
+    ASSERT_EQ(strategy.getProgram().ops().size(), 4u);
+    EXPECT_EQ(strategy.getProgram().ops()[0].count, 3u);
+
+    for (int i = 0; i < 20; ++i) {
+        std::string password = strategy.generate(12);
+        EXPECT_TRUE(std::regex_match(password, std::regex("LD-[a-z]{4}[0-9]{2}[a-f0-9]{3}")))
+            << password;
+    }
+    EXPECT_EQ(strategy.getKeyspace(12),
+              password_generator::utils::BigUint::pow(26, 4) *
+              password_generator::utils::BigUint(100 * 16 * 16 * 16));
+}
+
+TEST(PatternPasswordStrategyTest, SupportsHashcatMasks) {
+    PatternPasswordStrategy strategy("?u?l?l?d?s??");
+    std::string password = strategy.generate(6);
+    EXPECT_TRUE(std::regex_match(password, std::regex("[A-Z][a-z]{2}[0-9][ -/:-@\\[-`{-~]\\?")))
+        << password;
+
+    strategy.setCustomCharset(1, "?dXY");
+    strategy.setPattern("?1{8}?h?H");
+    for (int i = 0; i < 20; ++i) {
+        password = strategy.generate(10);
+        EXPECT_TRUE(std::regex_match(password, std::regex("[0-9XY]{8}[0-9a-f][0-9A-F]"))) << password;
+    }
+    EXPECT_NEAR(strategy.getEntropyBits(10), 8 * std::log2(12.0) + 8.0, 1e-9);
+
+    strategy.setPattern("?a");
+    EXPECT_EQ(strategy.getKeyspace(1).toString(), "95");
+}
+
+TEST(PatternPasswordStrategyTest, RejectsMalformedPatterns) {
+    PatternPasswordStrategy strategy("LL");
+    for (const char* bad : {"{3}", "L{0}", "L{x}", "L{2}{2}", "L{1}{2}", "[a-", "[]", "[z-a]",
+                            "[^a]", "?x", "?1", "L\\", "?"}) {
+        EXPECT_THROW(strategy.setPattern(bad), std::invalid_argument) << bad;
+    }
+    EXPECT_EQ(strategy.getPattern(), "LL");
+    EXPECT_THROW(strategy.setCustomCharset(5, "abc"), std::invalid_argument);
+
+    strategy.setPattern("");
+    EXPECT_THROW(strategy.generate(8), std::runtime_error);
+}
@@ -0,0 +1,36 @@
+#include <gtest/gtest.h>
+#include "strategies/PronounceablePasswordStrategy.h"
+#include "mocks/MockRandomGenerator.h"
+#include <regex>
+
+using namespace password_generator::strategies;
+using password_generator::tests::MockRandomGenerator;
+
+TEST(PronounceablePasswordStrategyTest, WritesExactLength) {
+    PronounceablePasswordStrategy strategy;
+    const std::regex shape("([A-Za-z][aeiou][0-9]?)*[A-Za-z]?");
+    for (size_t length = 0; length <= 40; ++length) {
+        std::string password = strategy.generate(length);
+        EXPECT_EQ(password.size(), length);
+        EXPECT_TRUE(std::regex_match(password, shape)) << password;
+    }
+}
+
+TEST(PronounceablePasswordStrategyTest, DecodesOneDrawPerSyllable) {
+    // value = syllable + 95 * (capital + 3 * number); capital 0 capitalizes,
+    // number < 10 appends that digit
+    auto rng = std::make_unique<MockRandomGenerator>(
+        std::vector<int>{0, 1 + 95 * (1 + 3 * 12), 94 + 95 * (2 + 3 * 7)});
+    PronounceablePasswordStrategy strategy(std::move(rng));
+    EXPECT_EQ(strategy.generate(6), "Ba0bez");
+}
+
+TEST(PronounceablePasswordStrategyTest, HonoursDisabledOptions) {
+    PronounceablePasswordStrategy strategy;
+    strategy.setIncludeNumbers(false);
+    strategy.setIncludeCapitals(false);
+    for (int i = 0; i < 20; ++i) {
+        std::string password = strategy.generate(15);
+        EXPECT_TRUE(std::regex_match(password, std::regex("([b-z][aeiou]){7}[b-z]"))) << password;
+    }
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include "strategies/RegexPasswordStrategy.h"
+#include <map>
+#include <regex>
+
+using namespace password_generator::strategies;
+using password_generator::utils::BigUint;
+
+TEST(RegexPasswordStrategyTest, GeneratesOnlyMatchingPasswords) {
+    const std::string policy = "^[A-Z][a-z]{3,6}(-[0-9]{2}|_[!#%]+)[a-f0-9]*$";
+    RegexPasswordStrategy strategy(policy);
+    const std::regex reference("[A-Z][a-z]{3,6}(-[0-9]{2}|_[!#%]+)[a-f0-9]*");
+
+    for (size_t length : {7u, 10u, 16u}) {
+        for (int i = 0; i < 50; ++i) {
+            std::string password = strategy.generate(length);
+            EXPECT_EQ(password.size(), length);
+            EXPECT_TRUE(std::regex_match(password, reference)) << password;
+            EXPECT_TRUE(strategy.getDfa().matches(password)) << password;
+        }
+    }
+}
+
+TEST(RegexPasswordStrategyTest, CountsMatchingStringsExactly) {
+    RegexPasswordStrategy strategy("[a-z]{4}\\d\\d");
+    EXPECT_EQ(strategy.getKeyspace(6), BigUint::pow(26, 4) * BigUint(100));
+    EXPECT_TRUE(strategy.getKeyspace(5).isZero());
+    EXPECT_THROW(strategy.generate(5), std::runtime_error);
+
+    // Overlapping alternatives are counted once: "aa" plus 95 "?b"
+    strategy.setRegex("a+|a{2}b?|.b");
+    EXPECT_EQ(strategy.getKeyspace(2).toString(), "96");
+    EXPECT_EQ(strategy.getKeyspace(3).toString(), "2");
+
+    strategy.setRegex("(?:[0-9a-f]{2}:){3}[0-9a-f]{2}");
+    EXPECT_NEAR(strategy.getEntropyBits(11), 32.0, 1e-9);
+}
+
+TEST(RegexPasswordStrategyTest, SamplesUniformly) {
+    // 2 + 4 + 3 = 9 strings of length 2, from alternatives of unequal size
+    RegexPasswordStrategy strategy("a[xy]|[b-e]z|f[0-2]");
+    ASSERT_EQ(strategy.getKeyspace(2).toString(), "9");
+
+    std::map<std::string, int> seen;
+    const int draws = 18000;
+    for (int i = 0; i < draws; ++i) {
+        ++seen[strategy.generate(2)];
+    }
+    ASSERT_EQ(seen.size(), 9u);
+    for (const auto& entry : seen) {
+        EXPECT_NEAR(entry.second, draws / 9, 250) << entry.first;
+    }
+}
+
+TEST(RegexPasswordStrategyTest, RejectsMalformedExpressions) {
+    RegexPasswordStrategy strategy("ab");
+    for (const char* bad : {"(ab", "ab)", "[a-", "[z-a]", "*a", "a{2,1}", "a{1001}", "a\\",
+                            "[^ -~]", "caf\xc3\xa9"}) {
+        EXPECT_THROW(strategy.setRegex(bad), std::invalid_argument) << bad;
+    }
+    EXPECT_EQ(strategy.getRegex(), "ab");
+
+    // (a|b)*a(a|b){n} needs 2^(n+1) states
+    EXPECT_THROW(RegexDfa::compile("[ab]*a[ab]{14}"), std::invalid_argument);
+}
+
+TEST(RegexPasswordStrategyTest, SharesCompiledAutomata) {
+    RegexPasswordStrategy first("[a-z]{8}[0-9]");
+    RegexPasswordStrategy second("[a-z]{8}[0-9]");
+    EXPECT_EQ(&first.getDfa(), &second.getDfa());
+
+    // Only the distinctions the expression makes become classes
+    EXPECT_EQ(first.getDfa().classCount(), 3u);
+}
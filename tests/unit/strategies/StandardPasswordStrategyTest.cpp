@@ -3,7 +3,11 @@
 #include "providers/LowercaseProvider.h"
 #include "providers/UppercaseProvider.h"
 #include "providers/DigitProvider.h"
+#include "providers/SymbolProvider.h"
+#include "utils/CharacterFilter.h"
 #include "mocks/MockRandomGenerator.h"
+#include <cctype>
+#include <cmath>
 
 using namespace password_generator::strategies;
 using namespace password_generator::providers;
@@ -40,4 +44,174 @@ TEST(StandardPasswordStrategyTest, ThrowsWhenNoCharacterSets) {
     StandardPasswordStrategy strategy;
     
     EXPECT_THROW(strategy.generate(10), std::runtime_error);
-}
\ No newline at end of file
+}
+
+namespace {
+
+// Counts virtual calls to verify that passwords are drawn in bulk
+class CountingRandomGenerator : public password_generator::utils::IBulkRandomGenerator {
+public:
+    int generateCalls = 0;
+    int bulkCalls = 0;
+
+    int generate(int min, int) override {
+        ++generateCalls;
+        return min;
+    }
+
+    void generateBounded(uint32_t* values, size_t count) override {
+        ++bulkCalls;
+        for (size_t i = 0; i < count; ++i) {
+            values[i] = values[i] - 1;
+        }
+    }
+
+    void generateIndices(uint32_t* out, size_t count, uint32_t bound) override {
+        ++bulkCalls;
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = bound - 1;
+        }
+    }
+
+    void fillBytes(void*, size_t) override {
+        ++bulkCalls;
+    }
+};
+
+} // namespace
+
+TEST(StandardPasswordStrategyTest, DrawsWholePasswordInOneCall) {
+    auto rng = std::make_unique<CountingRandomGenerator>();
+    CountingRandomGenerator* counter = rng.get();
+
+    StandardPasswordStrategy strategy(std::move(rng));
+    strategy.addCharacterSet(std::make_unique<LowercaseProvider>());
+    strategy.addCharacterSet(std::make_unique<DigitProvider>());
+
+    std::string password = strategy.generate(64);
+
+    EXPECT_EQ(password.length(), 64u);
+    EXPECT_EQ(counter->bulkCalls, 1);
+    EXPECT_EQ(counter->generateCalls, 0);
+}
+
+TEST(StandardPasswordStrategyTest, WeightsCharacterSets) {
+    StandardPasswordStrategy strategy;
+    strategy.addCharacterSet(std::make_unique<LowercaseProvider>());
+    strategy.addCharacterSet(std::make_unique<DigitProvider>(), 2.6);
+
+    // Each digit is 2.6 times as likely as each letter: 26 : 26 overall
+    size_t digits = 0, total = 0;
+    for (int i = 0; i < 400; ++i) {
+        for (char c : strategy.generate(50)) {
+            digits += std::isdigit(static_cast<unsigned char>(c)) ? 1 : 0;
+            ++total;
+        }
+    }
+    EXPECT_NEAR(static_cast<double>(digits) / total, 0.5, 0.02);
+
+    // Letters 1/52 each, digits 1/20 each, half the mass on either side
+    EXPECT_NEAR(strategy.getEntropyBits(10), 10 * (0.5 * std::log2(52.0) + 0.5 * std::log2(20.0)), 1e-6);
+
+    EXPECT_THROW(strategy.addCharacterSet(std::make_unique<UppercaseProvider>(), 0.0),
+                 std::invalid_argument);
+    strategy.clearCharacterSets();
+    strategy.addCharacterSet(std::make_unique<DigitProvider>());
+    EXPECT_NEAR(strategy.getEntropyBits(4), 4 * std::log2(10.0), 1e-9);
+}
+
+TEST(StandardPasswordStrategyTest, AppliesCharacterFilters) {
+    password_generator::utils::CharacterFilter filter;
+    filter.excludeAmbiguous();
+    filter.setMaxRepeat(2);
+    filter.setNoAdjacentRepeat(true);
+
+    StandardPasswordStrategy strategy;
+    strategy.addCharacterSet(std::make_unique<LowercaseProvider>());
+    strategy.addCharacterSet(std::make_unique<UppercaseProvider>());
+    strategy.addCharacterSet(std::make_unique<DigitProvider>());
+    strategy.setFilter(filter);
+    EXPECT_NEAR(strategy.getEntropyBits(1), std::log2(57.0), 1e-12);
+
+    for (int i = 0; i < 300; ++i) {
+        std::string password = strategy.generate(40);
+        ASSERT_EQ(password.size(), 40u);
+        int counts[256] = {0};
+        for (size_t j = 0; j < password.size(); ++j) {
+            EXPECT_TRUE(filter.allows(password[j])) << password;
+            EXPECT_LE(++counts[static_cast<unsigned char>(password[j])], 2) << password;
+            if (j > 0) {
+                EXPECT_NE(password[j], password[j - 1]) << password;
+            }
+        }
+    }
+    EXPECT_THROW(strategy.generate(115), std::runtime_error);
+}
+
+TEST(StandardPasswordStrategyTest, RedrawsOnlyRejectedCharacters) {
+    // Draws: set 'a', fills 'a' 'a', swaps 2 and 0; the shuffle puts the
+    // second fill next to the first, so it alone is redrawn, as 'b'
+    auto mockRng = std::make_unique<MockRandomGenerator>(std::vector<int>{0, 0, 0, 0, 0, 1});
+    StandardPasswordStrategy strategy(std::move(mockRng));
+    strategy.addCharacterSet(std::make_unique<LowercaseProvider>());
+
+    password_generator::utils::CharacterFilter filter;
+    filter.setNoAdjacentRepeat(true);
+    strategy.setFilter(filter);
+    EXPECT_EQ(strategy.generate(3), "aba");
+}
+
+TEST(StandardPasswordStrategyTest, PlacesSingleCharacterSetsUnderSequenceRules) {
+    // A fill drawing '!' next to the symbol set's guaranteed slot used to
+    // leave that slot with no legal character
+    for (size_t maxRepeat : {0, 1}) {
+        password_generator::utils::CharacterFilter filter;
+        filter.setNoAdjacentRepeat(true);
+        filter.setMaxRepeat(maxRepeat);
+
+        StandardPasswordStrategy strategy;
+        strategy.addCharacterSet(std::make_unique<LowercaseProvider>());
+        strategy.addCharacterSet(std::make_unique<SymbolProvider>("!"));
+        strategy.setFilter(filter);
+
+        for (int i = 0; i < 500; ++i) {
+            std::string password;
+            ASSERT_NO_THROW(password = strategy.generate(26));
+            ASSERT_EQ(password.size(), 26u);
+            EXPECT_NE(password.find('!'), std::string::npos) << password;
+            for (size_t j = 1; j < password.size(); ++j) {
+                EXPECT_NE(password[j], password[j - 1]) << password;
+            }
+        }
+    }
+
+    password_generator::utils::CharacterFilter filter;
+    filter.setNoAdjacentRepeat(true);
+    StandardPasswordStrategy single;
+    single.addCharacterSet(std::make_unique<SymbolProvider>("!"));
+    single.setFilter(filter);
+    EXPECT_EQ(single.generate(1), "!");
+    EXPECT_THROW(single.generate(2), std::runtime_error);
+}
+
+TEST(StandardPasswordStrategyTest, RejectsFilterThatEmptiesSet) {
+    StandardPasswordStrategy strategy;
+    strategy.addCharacterSet(std::make_unique<LowercaseProvider>());
+    strategy.addCharacterSet(std::make_unique<DigitProvider>());
+
+    password_generator::utils::CharacterFilter filter;
+    filter.allowOnly("abcdef");
+    EXPECT_THROW(strategy.setFilter(filter), std::invalid_argument);
+    EXPECT_NEAR(strategy.getEntropyBits(1), std::log2(36.0), 1e-12);
+
+    // With the filter in place, adding a set it empties is refused too
+    password_generator::utils::CharacterFilter wider;
+    wider.allowOnly("abcdef0");
+    strategy.setFilter(wider);
+    EXPECT_THROW(strategy.addCharacterSet(std::make_unique<UppercaseProvider>()), std::invalid_argument);
+    for (int i = 0; i < 50; ++i) {
+        const std::string password = strategy.generate(8);
+        EXPECT_NE(password.find('0'), std::string::npos) << password;
+        EXPECT_EQ(password.find_first_not_of("abcdef0"), std::string::npos) << password;
+    }
+}
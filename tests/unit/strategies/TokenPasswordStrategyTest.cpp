@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include "strategies/TokenPasswordStrategy.h"
+#include "utils/BulkRandomGenerator.h"
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+using namespace password_generator::strategies;
+using password_generator::utils::TokenEncoding;
+
+namespace {
+
+// Every byte is zero
+class ZeroRandomGenerator : public password_generator::utils::IBulkRandomGenerator {
+public:
+    int generate(int min, int) override { return min; }
+
+    void generateBounded(uint32_t* values, size_t count) override {
+        for (size_t i = 0; i < count; ++i) {
+            values[i] = 0;
+        }
+    }
+
+    void generateIndices(uint32_t* out, size_t count, uint32_t) override {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = 0;
+        }
+    }
+
+    void fillBytes(void* out, size_t length) override {
+        auto* bytes = static_cast<uint8_t*>(out);
+        for (size_t i = 0; i < length; ++i) {
+            bytes[i] = 0;
+        }
+    }
+};
+
+} // namespace
+
+TEST(TokenPasswordStrategyTest, AppendsChecksumOfBody) {
+    TokenPasswordStrategy strategy(std::make_unique<ZeroRandomGenerator>());
+    strategy.setPrefix("xyz_");
+    // CRC-32 of 64 '0' characters is 0x34b1e4cb
+    EXPECT_EQ(strategy.generateToken(), "xyz_" + std::string(64, '0') + "34b1e4cb");
+    EXPECT_EQ(strategy.tokenLength(), 4u + 64u + 8u);
+    EXPECT_DOUBLE_EQ(strategy.getEntropyBits(), 256.0);
+}
+
+TEST(TokenPasswordStrategyTest, TokensVerifyAndTamperingIsDetected) {
+    const TokenEncoding encodings[] = {TokenEncoding::Hex, TokenEncoding::Base32,
+                                       TokenEncoding::Base58, TokenEncoding::Base64Url};
+    for (TokenEncoding encoding : encodings) {
+        for (auto checksum : {TokenPasswordStrategy::Checksum::Crc32,
+                              TokenPasswordStrategy::Checksum::Crc32c}) {
+            TokenPasswordStrategy strategy;
+            strategy.setEncoding(encoding);
+            strategy.setChecksum(checksum);
+            strategy.setPrefix("ghp_");
+            strategy.setBytes(30);
+
+            std::string token = strategy.generateToken();
+            ASSERT_EQ(token.size(), strategy.tokenLength());
+            EXPECT_EQ(token.compare(0, 4, "ghp_"), 0);
+            EXPECT_TRUE(strategy.verifyChecksum(token)) << token;
+
+            token[10] = token[10] == 'A' ? 'B' : 'A';
+            EXPECT_FALSE(strategy.verifyChecksum(token)) << token;
+            EXPECT_FALSE(strategy.verifyChecksum(token.substr(1)));
+        }
+    }
+}
+
+TEST(TokenPasswordStrategyTest, BatchesLongTokens) {
+    TokenPasswordStrategy strategy;
+    strategy.setEncoding(TokenEncoding::Base64Url);
+    strategy.setBytes(3000);
+    strategy.setPrefix("sk-");
+    const size_t length = strategy.tokenLength();
+    EXPECT_EQ(length, 3u + 4000u + 6u);
+
+    std::string batch(10 * length, '\0');
+    strategy.generateBatch(&batch[0], 10, length);
+    for (size_t i = 0; i < 10; ++i) {
+        EXPECT_TRUE(strategy.verifyChecksum(std::string_view(batch).substr(i * length, length)));
+    }
+    EXPECT_NE(batch.substr(3, 100), batch.substr(length + 3, 100));
+
+    EXPECT_THROW(strategy.generate(40), std::invalid_argument);
+}
+
+TEST(TokenPasswordStrategyTest, ValidatesConfiguration) {
+    TokenPasswordStrategy strategy;
+    EXPECT_THROW(strategy.setBytes(TokenPasswordStrategy::MIN_BYTES - 1), std::invalid_argument);
+    EXPECT_THROW(strategy.setBytes(TokenPasswordStrategy::MAX_BYTES + 1), std::invalid_argument);
+    EXPECT_THROW(strategy.setPrefix("has space"), std::invalid_argument);
+    EXPECT_THROW(strategy.setPrefix(std::string(65, 'p')), std::invalid_argument);
+    EXPECT_THROW(TokenPasswordStrategy::parseEncoding("base64"), std::invalid_argument);
+    EXPECT_THROW(TokenPasswordStrategy::parseChecksum("md5"), std::invalid_argument);
+    EXPECT_EQ(TokenPasswordStrategy::parseEncoding("base58"), TokenEncoding::Base58);
+
+    strategy.setEncoding(TokenEncoding::Base58);
+    strategy.setChecksum(TokenPasswordStrategy::Checksum::None);
+    EXPECT_EQ(strategy.tokenLength(), 44u);
+    EXPECT_NEAR(strategy.getEntropyBits(), 44 * std::log2(58.0), 1e-9);
+    EXPECT_FALSE(strategy.verifyChecksum(strategy.generateToken()));
+}
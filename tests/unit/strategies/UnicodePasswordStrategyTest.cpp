@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include "strategies/UnicodePasswordStrategy.h"
+#include "providers/DigitProvider.h"
+#include "mocks/MockRandomGenerator.h"
+#include "utils/Utf8.h"
+#include "validators/MaxLengthValidator.h"
+#include "validators/MinLengthValidator.h"
+#include <cmath>
+#include <set>
+
+using namespace password_generator::strategies;
+using namespace password_generator::tests;
+using password_generator::utils::Utf8Alphabet;
+
+TEST(UnicodePasswordStrategyTest, GeneratesCodePoints) {
+    UnicodePasswordStrategy strategy;
+    strategy.addAlphabet(Utf8Alphabet::named("cyrillic"));
+    strategy.addCharacterSet(std::make_unique<password_generator::providers::DigitProvider>());
+    ASSERT_EQ(strategy.getAlphabet().size(), 76u);
+    EXPECT_NEAR(strategy.getEntropyBits(12), 12 * std::log2(76.0), 1e-9);
+
+    password_generator::validators::MinLengthValidator minLength(12);
+    password_generator::validators::MaxLengthValidator maxLength(12);
+    for (int i = 0; i < 200; ++i) {
+        std::string password = strategy.generate(12);
+        EXPECT_EQ(password_generator::utils::utf8Length(password), 12u);
+        EXPECT_TRUE(minLength.validate(password));
+        EXPECT_TRUE(maxLength.validate(password));
+
+        // Every code point decodes and belongs to the alphabet
+        std::set<char32_t> members;
+        for (size_t j = 0; j < strategy.getAlphabet().size(); ++j) {
+            members.insert(strategy.getAlphabet().codePoint(j));
+        }
+        size_t pos = 0;
+        char32_t codePoint;
+        while (pos < password.size()) {
+            ASSERT_TRUE(password_generator::utils::decodeUtf8(password, pos, codePoint));
+            EXPECT_TRUE(members.count(codePoint)) << password;
+        }
+    }
+}
+
+TEST(UnicodePasswordStrategyTest, CopiesMixedLengthEncodings) {
+    // Sorted alphabet: a, é, €
+    auto mockRng = std::make_unique<MockRandomGenerator>(std::vector<int>{2, 0, 1, 2});
+    UnicodePasswordStrategy strategy(std::move(mockRng));
+    strategy.addAlphabet(Utf8Alphabet::fromString("\xe2\x82\xac" "a\xc3\xa9"));
+    EXPECT_EQ(strategy.generate(4), "\xe2\x82\xac" "a\xc3\xa9\xe2\x82\xac");
+
+    UnicodePasswordStrategy empty;
+    EXPECT_THROW(empty.generate(4), std::runtime_error);
+}
+
+TEST(UnicodePasswordStrategyTest, PlacesOneCodePointOfEachRequiredType) {
+    using password_generator::validators::CharacterTypeValidator;
+    UnicodePasswordStrategy strategy;
+    strategy.addAlphabet(Utf8Alphabet::named("cyrillic"));
+    strategy.addCharacterSet(std::make_unique<password_generator::providers::DigitProvider>());
+    const CharacterTypeValidator requirements(true, true, true, false);
+    strategy.setRequirements(requirements);
+    for (int i = 0; i < 500; ++i) {
+        const std::string password = strategy.generate(8);
+        EXPECT_EQ(password_generator::utils::utf8Length(password), 8u);
+        EXPECT_TRUE(requirements.validate(password)) << password;
+    }
+    EXPECT_THROW(strategy.generate(2), std::invalid_argument);
+
+    strategy.setRequirements(CharacterTypeValidator(false, false, true, true));
+    EXPECT_THROW(strategy.generate(8), std::invalid_argument);   // no symbols
+}
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include "strategies/UniquePasswordStrategy.h"
+#include "providers/LowercaseProvider.h"
+#include "providers/UppercaseProvider.h"
+#include "providers/DigitProvider.h"
+#include "providers/SymbolProvider.h"
+#include "validators/CharacterTypeValidator.h"
+#include <set>
+
+using namespace password_generator::strategies;
+using namespace password_generator::providers;
+using namespace password_generator::validators;
+
+namespace {
+
+std::unique_ptr<UniquePasswordStrategy> makeDigitStrategy(const std::string& key) {
+    auto strategy = std::make_unique<UniquePasswordStrategy>(key);
+    strategy->addCharacterSet(std::make_unique<DigitProvider>());
+    return strategy;
+}
+
+} // namespace
+
+TEST(UniquePasswordStrategyTest, EnumeratesWholeSpaceWithoutRepeats) {
+    auto strategy = makeDigitStrategy("key");
+
+    std::set<std::string> seen;
+    for (int i = 0; i < 1000; ++i) {
+        seen.insert(strategy->generate(3));
+    }
+    EXPECT_EQ(seen.size(), 1000u);
+    EXPECT_THROW(strategy->generate(3), std::runtime_error);
+}
+
+TEST(UniquePasswordStrategyTest, ShardsAreDisjointAndCoverTheSpace) {
+    std::set<std::string> all;
+    size_t total = 0;
+    for (uint64_t shard = 0; shard < 3; ++shard) {
+        auto strategy = makeDigitStrategy("shared key");
+        strategy->setShard(shard, 3);
+        try {
+            while (true) {
+                all.insert(strategy->generate(3));
+                ++total;
+            }
+        } catch (const std::runtime_error&) {
+        }
+    }
+    EXPECT_EQ(total, 1000u);
+    EXPECT_EQ(all.size(), 1000u);
+}
+
+TEST(UniquePasswordStrategyTest, IsReproducibleUnderOneKey) {
+    auto a = makeDigitStrategy("key");
+    auto b = makeDigitStrategy("key");
+    auto other = makeDigitStrategy("other key");
+
+    int differing = 0;
+    for (int i = 0; i < 20; ++i) {
+        std::string password = a->generate(12);
+        EXPECT_EQ(password, b->generate(12));
+        differing += password != other->generate(12);
+    }
+    EXPECT_GT(differing, 15);
+
+    a->setPosition(5);
+    b->setShard(0, 1);
+    b->setPosition(5);
+    EXPECT_EQ(a->generate(12), b->generate(12));
+}
+
+TEST(UniquePasswordStrategyTest, KeepsEverySetAndHandlesLongPasswords) {
+    UniquePasswordStrategy strategy("key");
+    strategy.addCharacterSet(std::make_unique<LowercaseProvider>());
+    strategy.addCharacterSet(std::make_unique<UppercaseProvider>());
+    strategy.addCharacterSet(std::make_unique<DigitProvider>());
+    strategy.addCharacterSet(std::make_unique<SymbolProvider>());
+    CharacterTypeValidator validator(true, true, true, true);
+
+    // 94^40 exceeds 2^128, so part of each password comes from the tail stream
+    std::set<std::string> seen;
+    for (int i = 0; i < 200; ++i) {
+        std::string password = strategy.generate(i % 2 ? 8 : 40);
+        EXPECT_TRUE(validator.validate(password)) << password;
+        seen.insert(password);
+    }
+    EXPECT_EQ(seen.size(), 200u);
+}
+
+TEST(UniquePasswordStrategyTest, RejectsInvalidConfiguration) {
+    UniquePasswordStrategy strategy;
+    EXPECT_THROW(strategy.generate(8), std::runtime_error);
+    EXPECT_THROW(strategy.setShard(3, 3), std::invalid_argument);
+    EXPECT_THROW(strategy.setShard(0, 0), std::invalid_argument);
+
+    strategy.addCharacterSet(std::make_unique<SymbolProvider>("!!"));
+    EXPECT_THROW(strategy.generate(8), std::runtime_error);
+}
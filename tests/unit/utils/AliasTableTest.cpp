@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include "utils/AliasTable.h"
+#include <cmath>
+#include <vector>
+
+using password_generator::utils::AliasTable;
+
+namespace {
+
+// Recover each column's threshold by binary search on u, and add up the
+// exact probability mass every index receives
+std::vector<uint64_t> massOf(const AliasTable& table) {
+    std::vector<uint64_t> mass(table.size(), 0);
+    const uint32_t shift = static_cast<uint32_t>(std::log2(table.unit()));
+    for (uint32_t column = 0; column < table.size(); ++column) {
+        const uint32_t base = column << shift;
+        uint32_t low = 0, high = table.unit();
+        while (low < high) {
+            uint32_t mid = low + (high - low) / 2;
+            if (table.sample(base | mid) == column) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        mass[column] += low;
+        if (low < table.unit()) {
+            mass[table.sample(base | (table.unit() - 1))] += table.unit() - low;
+        }
+    }
+    return mass;
+}
+
+} // namespace
+
+TEST(AliasTableTest, QuantizesWeightsToOneUnit) {
+    AliasTable table({1.0, 2.0, 3.0, 4.0});
+    uint64_t total = 0;
+    for (size_t i = 0; i < table.size(); ++i) {
+        total += table.quantizedWeight(i);
+    }
+    EXPECT_EQ(total, table.unit());
+    EXPECT_EQ(static_cast<uint64_t>(table.drawBound()), uint64_t(4) * table.unit());
+    EXPECT_NEAR(table.probability(3), 0.4, 1e-9);
+}
+
+TEST(AliasTableTest, ColumnsDeliverExactProbabilities) {
+    for (const auto& weights : std::vector<std::vector<double>>{
+             {1.0}, {5.0, 1.0}, {0.5, 0.5, 3.0, 1e-6, 7.25}, std::vector<double>(94, 1.0)}) {
+        AliasTable table(weights);
+        std::vector<uint64_t> mass = massOf(table);
+        for (size_t i = 0; i < table.size(); ++i) {
+            EXPECT_EQ(mass[i], uint64_t(table.quantizedWeight(i)) * table.size()) << i;
+        }
+    }
+}
+
+TEST(AliasTableTest, ReportsShannonEntropy) {
+    EXPECT_NEAR(AliasTable(std::vector<double>(64, 2.0)).entropyBits(), 6.0, 1e-9);
+    EXPECT_NEAR(AliasTable({1.0, 3.0}).entropyBits(),
+                -(0.25 * std::log2(0.25) + 0.75 * std::log2(0.75)), 1e-9);
+}
+
+TEST(AliasTableTest, RejectsInvalidWeights) {
+    EXPECT_THROW(AliasTable({}), std::invalid_argument);
+    EXPECT_THROW(AliasTable({1.0, 0.0}), std::invalid_argument);
+    EXPECT_THROW(AliasTable({1.0, -2.0}), std::invalid_argument);
+    EXPECT_THROW(AliasTable({1.0, std::nan("")}), std::invalid_argument);
+    EXPECT_THROW(AliasTable({1.0, INFINITY}), std::invalid_argument);
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include "utils/AlphabetKernel.h"
+#include "utils/ThreadLocalRandomGenerator.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace password_generator::utils;
+
+namespace {
+
+// Alphabets of 1 to 128 distinct printable-or-high bytes
+std::string alphabetOf(size_t size) {
+    std::string alphabet;
+    for (size_t i = 0; i < size; ++i) {
+        alphabet.push_back(static_cast<char>(33 + i));
+    }
+    return alphabet;
+}
+
+std::vector<uint8_t> randomBytes(size_t count, uint64_t seed) {
+    std::vector<uint8_t> bytes(count);
+    for (auto& byte : bytes) {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        byte = static_cast<uint8_t>(seed >> 56);
+    }
+    return bytes;
+}
+
+} // namespace
+
+TEST(AlphabetKernelTest, MasksAndRejectsBytesInOrder) {
+    AlphabetKernel kernel("abc");
+    const uint8_t bytes[] = {0, 1, 2, 3, 7, 5, 0x42};
+    char out[4];
+    size_t consumed;
+    EXPECT_EQ(kernel.map(AlphabetKernel::Isa::Scalar, bytes, sizeof(bytes), out, 4, consumed), 4u);
+    EXPECT_EQ(std::string(out, 4), "abcb");
+    EXPECT_EQ(consumed, 6u);
+
+    EXPECT_THROW(AlphabetKernel(""), std::invalid_argument);
+    EXPECT_THROW(AlphabetKernel("abca"), std::invalid_argument);
+    EXPECT_THROW(AlphabetKernel(alphabetOf(129)), std::invalid_argument);
+}
+
+TEST(AlphabetKernelTest, SimdKernelsMatchScalarReference) {
+    const std::vector<uint8_t> bytes = randomBytes(4099, 0x5EED);
+    for (size_t size : {1, 2, 3, 10, 16, 17, 32, 58, 62, 64, 65, 88, 100, 127, 128}) {
+        AlphabetKernel kernel(alphabetOf(size));
+        for (size_t outCount : {0, 1, 15, 16, 31, 33, 100, 1000, 5000}) {
+            for (size_t byteCount : {size_t(0), size_t(31), size_t(64), bytes.size()}) {
+                std::string expected(outCount, '\0');
+                size_t expectedConsumed;
+                const size_t expectedWritten = kernel.map(AlphabetKernel::Isa::Scalar,
+                    bytes.data(), byteCount, &expected[0], outCount, expectedConsumed);
+
+                for (auto isa : {AlphabetKernel::Isa::Sse41, AlphabetKernel::Isa::Avx2}) {
+                    if (!AlphabetKernel::isSupported(isa)) {
+                        continue;
+                    }
+                    std::string actual(outCount, '\0');
+                    size_t consumed;
+                    const size_t written = kernel.map(isa, bytes.data(), byteCount, &actual[0],
+                                                      outCount, consumed);
+                    ASSERT_EQ(written, expectedWritten) << size << " " << outCount;
+                    ASSERT_EQ(consumed, expectedConsumed) << size << " " << outCount;
+                    ASSERT_EQ(actual.substr(0, written), expected.substr(0, written))
+                        << size << " " << outCount;
+                }
+            }
+        }
+    }
+}
+
+TEST(AlphabetKernelTest, FillsUniformCharacters) {
+    const std::string alphabet = alphabetOf(88);
+    AlphabetKernel kernel(alphabet);
+    ThreadLocalRandomGenerator rng;
+    std::string out(88 * 500, '\0');
+    kernel.fill(rng, &out[0], out.size());
+
+    std::vector<size_t> counts(256);
+    for (char c : out) {
+        counts[static_cast<unsigned char>(c)]++;
+    }
+    for (char c : alphabet) {
+        // Expected 500 each; a spread this wide is a 6-sigma event
+        EXPECT_GT(counts[static_cast<unsigned char>(c)], 365u) << c;
+        EXPECT_LT(counts[static_cast<unsigned char>(c)], 635u) << c;
+    }
+}
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include "utils/AlphabetPlan.h"
+#include "providers/LowercaseProvider.h"
+#include "providers/DigitProvider.h"
+#include "providers/SymbolProvider.h"
+#include <stdexcept>
+#include <string>
+
+using namespace password_generator::utils;
+using namespace password_generator::providers;
+using password_generator::core::interfaces::ICharacterSetProvider;
+
+TEST(AlphabetPlanTest, LaysOutMergedTableThenEachSet) {
+    std::vector<std::unique_ptr<ICharacterSetProvider>> providers;
+    providers.push_back(std::make_unique<DigitProvider>());
+    providers.push_back(std::make_unique<SymbolProvider>("!@#"));
+
+    AlphabetPlan plan;
+    plan.build(providers);
+
+    ASSERT_EQ(plan.mergedSize(), 13u);
+    EXPECT_EQ(plan.merged().characters(), "0123456789!@#");
+    ASSERT_EQ(plan.setCount(), 2u);
+    EXPECT_EQ(plan.set(0).characters(), "0123456789");
+    EXPECT_EQ(plan.set(1).characters(), "!@#");
+    EXPECT_TRUE(plan.set(1).contains('@'));
+    EXPECT_FALSE(plan.set(1).contains('7'));
+}
+
+TEST(AlphabetPlanTest, DeduplicatesMergedTableAndSkipsEmptySets) {
+    std::vector<std::unique_ptr<ICharacterSetProvider>> providers;
+    providers.push_back(std::make_unique<SymbolProvider>("a1!"));
+    providers.push_back(std::make_unique<SymbolProvider>(""));
+    providers.push_back(std::make_unique<LowercaseProvider>());
+
+    AlphabetPlan plan;
+    plan.build(providers);
+
+    EXPECT_EQ(plan.mergedSize(), 28u);
+    std::string_view merged = plan.merged().characters();
+    EXPECT_EQ(merged.find('a'), merged.rfind('a'));
+    ASSERT_EQ(plan.setCount(), 2u);
+    EXPECT_EQ(plan.setSize(1), 26u);
+
+    plan.clear();
+    EXPECT_TRUE(plan.empty());
+    EXPECT_EQ(plan.setCount(), 0u);
+}
+
+TEST(AlphabetPlanTest, RejectsFilterThatEmptiesSet) {
+    std::vector<std::unique_ptr<ICharacterSetProvider>> providers;
+    providers.push_back(std::make_unique<LowercaseProvider>());
+    providers.push_back(std::make_unique<DigitProvider>());
+
+    AlphabetPlan plan;
+    plan.build(providers);
+    CharacterFilter filter;
+    filter.allowOnly("abc");
+    try {
+        plan.build(providers, &filter);
+        FAIL() << "expected std::invalid_argument";
+    } catch (const std::invalid_argument& e) {
+        EXPECT_NE(std::string(e.what()).find("'Digits'"), std::string::npos) << e.what();
+    }
+    EXPECT_EQ(plan.mergedSize(), 36u);
+    EXPECT_EQ(plan.setCount(), 2u);
+
+    CharacterFilter wider;
+    wider.allowOnly("abc1");
+    plan.build(providers, &wider);
+    EXPECT_EQ(plan.merged().characters(), "abc1");
+}
@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+#include "utils/BigUint.h"
+#include <cmath>
+
+using password_generator::utils::BigUint;
+
+TEST(BigUintTest, ArithmeticIsExact) {
+    BigUint a = BigUint::pow(94, 16);
+    EXPECT_EQ(a.toString(), "37157429083410091685945089785856");
+
+    BigUint b = BigUint::pow(2, 128);
+    EXPECT_EQ(b.toString(), "340282366920938463463374607431768211456");
+    EXPECT_EQ((b - BigUint(1)).toString(), "340282366920938463463374607431768211455");
+    EXPECT_EQ((b + b).toString(), "680564733841876926926749214863536422912");
+    EXPECT_EQ((BigUint(1000000000) * BigUint(1000000000)).toString(), "1000000000000000000");
+    EXPECT_EQ(BigUint(0).toString(), "0");
+    EXPECT_THROW(BigUint(1) - BigUint(2), std::underflow_error);
+}
+
+TEST(BigUintTest, ComparesAndConverts) {
+    BigUint small(123456789);
+    BigUint large = BigUint::pow(10, 30);
+
+    EXPECT_LT(small, large);
+    EXPECT_GE(large, large);
+    EXPECT_TRUE(small.fitsUint64());
+    EXPECT_FALSE(large.fitsUint64());
+    EXPECT_EQ(small.low64(), 123456789u);
+
+    BigUint value = large;
+    EXPECT_EQ(value.divideSmall(7), 1u);  // 10^30 = 3^30 = (3^6)^5 = 1 (mod 7)
+    EXPECT_EQ((value * BigUint(7) + BigUint(1)), large);
+    EXPECT_NEAR(BigUint::pow(94, 16).log2(), 16 * std::log2(94.0), 1e-9);
+    EXPECT_DOUBLE_EQ(BigUint(1024).log2(), 10.0);
+}
+
+TEST(BigUintTest, ReadsBigEndianBytes) {
+    const uint8_t bytes[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05};
+    BigUint value = BigUint::fromBytes(bytes, sizeof(bytes));
+    EXPECT_EQ(value.low64(), 0x0102030405ull);
+    EXPECT_EQ(value.bitLength(), 33u);
+    EXPECT_EQ(BigUint::pow(2, 100).bitLength(), 101u);
+    EXPECT_EQ(BigUint(0).bitLength(), 0u);
+    EXPECT_TRUE(BigUint::fromBytes(bytes, 1).isZero());
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include "utils/CharacterFilter.h"
+#include <cstdio>
+#include <fstream>
+
+using password_generator::utils::CharacterFilter;
+
+TEST(CharacterFilterTest, CompilesMasks) {
+    CharacterFilter filter;
+    EXPECT_TRUE(filter.isEmpty());
+    EXPECT_EQ(filter.apply("a0O1lIb"), "a0O1lIb");
+
+    filter.excludeAmbiguous();
+    EXPECT_TRUE(filter.hasMask());
+    EXPECT_FALSE(filter.hasSequenceRules());
+    EXPECT_EQ(filter.apply("a0O1lIb|2"), "ab2");
+
+    filter.allowOnly("abcdef0123");
+    EXPECT_EQ(filter.apply("abcxyz0123"), "abc23");
+    filter.exclude("c");
+    EXPECT_FALSE(filter.allows('c'));
+    EXPECT_TRUE(filter.allows('a'));
+}
+
+TEST(CharacterFilterTest, LoadsCharsetFiles) {
+    const std::string path = testing::TempDir() + "charset_filter_test.txt";
+    {
+        std::ofstream out(path);
+        out << "abc\nXYZ 789\n";
+    }
+    CharacterFilter filter;
+    filter.loadCharsetFile(path);
+    EXPECT_EQ(filter.apply("aXz7 9\n"), "aX79");
+
+    {
+        std::ofstream out(path);
+        out << " \n\t";
+    }
+    EXPECT_THROW(filter.loadCharsetFile(path), std::invalid_argument);
+    {
+        std::ofstream out(path);
+        out << "ab\x01";
+    }
+    EXPECT_THROW(filter.loadCharsetFile(path), std::invalid_argument);
+    std::remove(path.c_str());
+    EXPECT_THROW(filter.loadCharsetFile(path), std::runtime_error);
+}
+
+TEST(CharacterFilterTest, TracksSequenceRules) {
+    CharacterFilter filter;
+    filter.setMaxRepeat(2);
+    filter.setNoAdjacentRepeat(true);
+    EXPECT_TRUE(filter.hasSequenceRules());
+    EXPECT_FALSE(filter.hasMask());
+
+    CharacterFilter::Tracker tracker(filter);
+    EXPECT_TRUE(tracker.allows('a'));
+    tracker.push('a');
+    EXPECT_FALSE(tracker.allows('a'));
+    tracker.push('b');
+    EXPECT_TRUE(tracker.allows('a'));
+    tracker.push('a');
+    tracker.push('b');
+    EXPECT_FALSE(tracker.allows('a'));
+    EXPECT_FALSE(tracker.allows('b'));
+    EXPECT_TRUE(tracker.allows('c'));
+}
@@ -0,0 +1,26 @@
+#include <gtest/gtest.h>
+#include "utils/CpuQuota.h"
+#include <thread>
+
+using namespace password_generator::utils;
+
+TEST(CpuQuotaTest, ParsesCgroupQuotasRoundingUp) {
+    EXPECT_EQ(cpusFromCgroupV2("max 100000"), 0u);
+    EXPECT_EQ(cpusFromCgroupV2("200000 100000\n"), 2u);
+    EXPECT_EQ(cpusFromCgroupV2("150000 100000"), 2u);
+    EXPECT_EQ(cpusFromCgroupV2("50000 100000"), 1u);
+    EXPECT_EQ(cpusFromCgroupV2("garbage"), 0u);
+    EXPECT_EQ(cpusFromCgroupV2("x 100000"), 0u);
+
+    EXPECT_EQ(cpusFromCgroupV1(-1, 100000), 0u);
+    EXPECT_EQ(cpusFromCgroupV1(400000, 100000), 4u);
+    EXPECT_EQ(cpusFromCgroupV1(100000, 0), 0u);
+}
+
+TEST(CpuQuotaTest, AvailableCpusIsPositiveAndWithinTheMachine) {
+    const size_t cpus = availableCpus();
+    EXPECT_GE(cpus, 1u);
+    if (std::thread::hardware_concurrency() > 0) {
+        EXPECT_LE(cpus, std::thread::hardware_concurrency());
+    }
+}
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include "utils/EntropyHealthTests.h"
+#include "utils/HardwareRandomGenerator.h"
+#include "utils/ChaCha20Drbg.h"
+#include <algorithm>
+#include <vector>
+
+using namespace password_generator::utils;
+
+TEST(EntropyHealthTestsTest, PassesUniformStream) {
+    ChaCha20Drbg drbg;
+    std::vector<uint8_t> samples(1 << 16);
+    drbg.fill(samples.data(), samples.size());
+
+    EntropyHealthTests health;
+    EXPECT_TRUE(health.process(samples.data(), samples.size()));
+    EXPECT_EQ(health.getCounters().samples, samples.size());
+    EXPECT_EQ(health.getCounters().rctFailures, 0u);
+    EXPECT_EQ(health.getCounters().aptFailures, 0u);
+}
+
+TEST(EntropyHealthTestsTest, RepetitionCountFiresOnStuckSource) {
+    // The all-ones pattern returned by faulty RDRAND implementations
+    std::vector<uint8_t> samples(64, 0xFF);
+
+    EntropyHealthTests health;
+    EXPECT_FALSE(health.process(samples.data(), samples.size()));
+    EXPECT_GT(health.getCounters().rctFailures, 0u);
+}
+
+TEST(EntropyHealthTestsTest, AdaptiveProportionFiresOnBiasedSource) {
+    // Every fourth byte repeats the window's first sample: no long runs,
+    // but far more matches than a full-entropy source would produce
+    std::vector<uint8_t> samples(EntropyHealthTests::APT_WINDOW);
+    for (size_t i = 0; i < samples.size(); ++i) {
+        samples[i] = (i % 4 == 0) ? 0x42 : static_cast<uint8_t>(i);
+    }
+
+    EntropyHealthTests health;
+    EXPECT_FALSE(health.process(samples.data(), samples.size()));
+    EXPECT_EQ(health.getCounters().rctFailures, 0u);
+    EXPECT_GT(health.getCounters().aptFailures, 0u);
+}
+
+TEST(EntropyHealthTestsTest, WordPathMatchesSampleBySample) {
+    // Narrow alphabets make both tests fire at all offsets; a stream fed one
+    // sample per call never takes the eight-sample path
+    ChaCha20Drbg drbg;
+    for (unsigned alphabet : {2u, 5u, 16u, 40u, 256u}) {
+        std::vector<uint8_t> samples(20000);
+        drbg.fill(samples.data(), samples.size());
+        for (uint8_t& sample : samples) {
+            sample = static_cast<uint8_t>(sample % alphabet);
+        }
+
+        EntropyHealthTests whole;
+        EntropyHealthTests split;
+        EntropyHealthTests single;
+        whole.process(samples.data(), samples.size());
+        for (size_t i = 0; i < samples.size(); i += 37) {
+            split.process(samples.data() + i, std::min<size_t>(37, samples.size() - i));
+        }
+        for (uint8_t sample : samples) {
+            single.process(&sample, 1);
+        }
+        for (const EntropyHealthTests* health : {&whole, &split}) {
+            EXPECT_EQ(health->getCounters().samples, single.getCounters().samples);
+            EXPECT_EQ(health->getCounters().rctFailures, single.getCounters().rctFailures) << alphabet;
+            EXPECT_EQ(health->getCounters().aptFailures, single.getCounters().aptFailures) << alphabet;
+        }
+        if (alphabet <= 16) {
+            EXPECT_GT(single.getCounters().aptFailures, 0u) << alphabet;
+        }
+    }
+}
+
+TEST(HardwareRandomGeneratorTest, DrawsThroughHealthTests) {
+    HardwareRandomGenerator rng(HardwareRandomGenerator::Source::RdSeed);
+
+    for (int i = 0; i < 1000; ++i) {
+        int value = rng.generate(0, 93);
+        ASSERT_GE(value, 0);
+        ASSERT_LE(value, 93);
+    }
+
+    auto stats = rng.getStatistics();
+    EXPECT_GT(stats.samplesTested, 0u);
+    EXPECT_EQ(stats.rctFailures, 0u);
+    EXPECT_EQ(stats.aptFailures, 0u);
+    if (rng.getSource() != HardwareRandomGenerator::Source::System) {
+        EXPECT_GT(stats.wordsDrawn, 0u);
+    }
+}
+
+TEST(HardwareRandomGeneratorTest, SystemSourceWorksWithoutInstructions) {
+    HardwareRandomGenerator rng(HardwareRandomGenerator::Source::System);
+    EXPECT_EQ(rng.getSource(), HardwareRandomGenerator::Source::System);
+
+    uint8_t buffer[1000];
+    rng.fillBytes(buffer, sizeof(buffer));
+    EXPECT_EQ(rng.getStatistics().wordsDrawn, 0u);
+}
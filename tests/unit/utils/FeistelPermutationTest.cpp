@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include "utils/FeistelPermutation.h"
+#include <set>
+#include <vector>
+
+using namespace password_generator::utils;
+
+namespace {
+
+const uint8_t KEY[ChaCha20Drbg::KEY_SIZE] = {
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32
+};
+
+uint64_t permuteToValue(const FeistelPermutation& perm, uint64_t counter, uint32_t radix) {
+    std::vector<uint32_t> digits(perm.permutedDigits());
+    perm.permute(counter, digits.data());
+    uint64_t value = 0;
+    for (size_t i = digits.size(); i-- > 0;) {
+        EXPECT_LT(digits[i], radix);
+        value = value * radix + digits[i];
+    }
+    return value;
+}
+
+} // namespace
+
+TEST(FeistelPermutationTest, IsBijectionOnSmallDomains) {
+    // Odd sizes exercise cycle walking; 4^5 is an exact power of two
+    const std::vector<std::pair<uint32_t, size_t>> domains = {{10, 3}, {7, 4}, {4, 5}, {3, 1}};
+    for (const auto& domain : domains) {
+        FeistelPermutation perm(KEY, domain.first, domain.second);
+        uint64_t size = 1;
+        for (size_t i = 0; i < domain.second; ++i) {
+            size *= domain.first;
+        }
+
+        std::set<uint64_t> seen;
+        for (uint64_t counter = 0; counter < size; ++counter) {
+            seen.insert(permuteToValue(perm, counter, domain.first));
+        }
+        EXPECT_EQ(seen.size(), size);
+        EXPECT_LT(*seen.rbegin(), size);
+        EXPECT_FALSE(perm.contains(size));
+        EXPECT_THROW(permuteToValue(perm, size, domain.first), std::out_of_range);
+    }
+}
+
+TEST(FeistelPermutationTest, CapsDomainAt128Bits) {
+    FeistelPermutation hex(KEY, 16, 40);
+    EXPECT_EQ(hex.permutedDigits(), 31u);
+
+    // 255^16 needs all 128 bits, so each Feistel half is a full word
+    FeistelPermutation full(KEY, 255, 16);
+    EXPECT_EQ(full.permutedDigits(), 16u);
+    EXPECT_EQ(permuteToValue(full, 0, 255) == permuteToValue(full, 1, 255), false);
+
+    FeistelPermutation printable(KEY, 94, 16);
+    EXPECT_EQ(printable.permutedDigits(), 16u);
+    EXPECT_TRUE(printable.contains(~uint64_t(0)));
+
+    std::set<uint64_t> seen;
+    for (uint64_t counter = 0; counter < 1000; ++counter) {
+        seen.insert(permuteToValue(printable, counter, 94));
+    }
+    EXPECT_EQ(seen.size(), 1000u);
+}
+
+TEST(FeistelPermutationTest, DependsOnKey) {
+    uint8_t otherKey[ChaCha20Drbg::KEY_SIZE] = {0};
+    FeistelPermutation a(KEY, 62, 12);
+    FeistelPermutation b(otherKey, 62, 12);
+
+    int differing = 0;
+    for (uint64_t counter = 0; counter < 16; ++counter) {
+        differing += permuteToValue(a, counter, 62) != permuteToValue(b, counter, 62);
+    }
+    EXPECT_GT(differing, 12);
+}
+
+TEST(FeistelPermutationTest, RejectsDegenerateDomains) {
+    EXPECT_THROW(FeistelPermutation(KEY, 1, 8), std::invalid_argument);
+    EXPECT_THROW(FeistelPermutation(KEY, 10, 0), std::invalid_argument);
+}
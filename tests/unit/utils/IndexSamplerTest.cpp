@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include "utils/IndexSampler.h"
+#include "utils/ChaCha20Drbg.h"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <vector>
+
+using namespace password_generator::utils;
+
+namespace {
+
+const uint8_t kKey[ChaCha20Drbg::KEY_SIZE] = {42};
+
+} // namespace
+
+TEST(IndexSamplerTest, PacksSeveralCharactersPerWord) {
+    ChaCha20Drbg drbg(kKey);
+    auto next = [&drbg]() { return drbg.next64(); };
+
+    SamplerStats stats;
+    std::vector<uint32_t> indices(90000);
+    sampleIndices(next, indices.data(), indices.size(), 94, stats);
+
+    for (uint32_t index : indices) {
+        ASSERT_LT(index, 94u);
+    }
+
+    // 94^9 < 2^64, so nine characters share a word: ~7.1 bits instead of 32
+    EXPECT_EQ(stats.indicesProduced, indices.size());
+    EXPECT_LT(stats.bitsPerIndex(), 7.2);
+    EXPECT_GE(32.0 / stats.bitsPerIndex(), 4.0);
+}
+
+TEST(IndexSamplerTest, PowerOfTwoAlphabetsSliceBits) {
+    ChaCha20Drbg drbg(kKey);
+    auto next = [&drbg]() { return drbg.next64(); };
+
+    SamplerStats hex;
+    std::vector<uint32_t> indices(1600);
+    sampleIndices(next, indices.data(), indices.size(), 16, hex);
+    EXPECT_DOUBLE_EQ(hex.bitsPerIndex(), 4.0);
+
+    SamplerStats base64;
+    sampleIndices(next, indices.data(), 1000, 64, base64);
+    EXPECT_DOUBLE_EQ(base64.bitsPerIndex(), 6.4);
+    for (size_t i = 0; i < 1000; ++i) {
+        ASSERT_LT(indices[i], 64u);
+    }
+}
+
+TEST(IndexSamplerTest, MixedBoundsAreUniform) {
+    ChaCha20Drbg drbg(kKey);
+    auto next = [&drbg]() { return drbg.next64(); };
+
+    const uint32_t bounds[] = {3, 94, 7, 26, 10};
+    const size_t rounds = 30000;
+    std::vector<std::vector<size_t>> histograms;
+    for (uint32_t bound : bounds) {
+        histograms.emplace_back(bound, 0);
+    }
+
+    SamplerStats stats;
+    for (size_t r = 0; r < rounds; ++r) {
+        uint32_t values[5];
+        std::copy(std::begin(bounds), std::end(bounds), values);
+        sampleBounded(next, values, 5, stats);
+        for (size_t i = 0; i < 5; ++i) {
+            ASSERT_LT(values[i], bounds[i]);
+            ++histograms[i][values[i]];
+        }
+    }
+
+    // Every bucket within six standard deviations of its expectation
+    for (size_t i = 0; i < 5; ++i) {
+        const double expected = static_cast<double>(rounds) / bounds[i];
+        const double tolerance = 6.0 * std::sqrt(expected);
+        for (size_t count : histograms[i]) {
+            EXPECT_NEAR(static_cast<double>(count), expected, tolerance);
+        }
+    }
+}
+
+TEST(IndexSamplerTest, RejectsZeroBound) {
+    ChaCha20Drbg drbg(kKey);
+    auto next = [&drbg]() { return drbg.next64(); };
+
+    SamplerStats stats;
+    uint32_t values[] = {10, 0, 10};
+    EXPECT_THROW(sampleBounded(next, values, 3, stats), std::invalid_argument);
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include "utils/PasswordBatch.h"
+#include "validators/MinLengthValidator.h"
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace password_generator;
+using password_generator::utils::PasswordBatch;
+
+TEST(PasswordBatchTest, FixedLayoutIndexesByStride) {
+    PasswordBatch batch(3, 4);
+    ASSERT_EQ(batch.size(), 3u);
+    ASSERT_EQ(batch.bytes(), 12u);
+    EXPECT_EQ(batch.uniformLength(), 4u);
+    EXPECT_EQ(batch[1], std::string(4, '\0'));
+
+    std::copy_n("aaaabbbbcccc", 12, batch.data());
+    EXPECT_EQ(batch[0], "aaaa");
+    EXPECT_EQ(batch[1], "bbbb");
+    EXPECT_EQ(batch[2], "cccc");
+
+    std::vector<std::string> seen(batch.begin(), batch.end());
+    EXPECT_EQ(seen, (std::vector<std::string>{"aaaa", "bbbb", "cccc"}));
+}
+
+TEST(PasswordBatchTest, MixedLengthsSwitchToOffsetTable) {
+    PasswordBatch batch;
+    batch.append("one");
+    batch.append("two");
+    EXPECT_EQ(batch.uniformLength(), 3u);
+
+    batch.append("three");
+    batch.append("");
+    batch.append("four");
+    EXPECT_EQ(batch.uniformLength(), 0u);
+    ASSERT_EQ(batch.size(), 5u);
+    EXPECT_EQ(batch[0], "one");
+    EXPECT_EQ(batch[1], "two");
+    EXPECT_EQ(batch[2], "three");
+    EXPECT_EQ(batch[3], "");
+    EXPECT_EQ(batch[4], "four");
+    EXPECT_EQ(batch.bytes(), 15u);
+}
+
+TEST(PasswordBatchTest, GrowingKeepsEarlierPasswords) {
+    PasswordBatch batch;
+    std::vector<std::string> expected;
+    for (size_t i = 0; i < 100000; ++i) {
+        expected.push_back("pw" + std::to_string(i));
+        batch.append(expected.back());
+    }
+    ASSERT_EQ(batch.size(), expected.size());
+    EXPECT_GE(batch.bytes(), PasswordBatch::ARENA_MAP_THRESHOLD / 2);
+    for (size_t i = 0; i < expected.size(); i += 997) {
+        EXPECT_EQ(batch[i], expected[i]);
+    }
+    EXPECT_EQ(batch[expected.size() - 1], expected.back());
+}
+
+TEST(PasswordBatchTest, WritesOneLinePerPassword) {
+    PasswordBatch batch;
+    batch.append("alpha");
+    batch.append("be");
+    batch.append(std::string(70000, 'x'));
+    batch.append("gamma");
+
+    std::ostringstream out;
+    batch.writeLines(out);
+    EXPECT_EQ(out.str(), "alpha\nbe\n" + std::string(70000, 'x') + "\ngamma\n");
+}
+
+TEST(PasswordBatchTest, FindInvalidSweepsWithValidators) {
+    PasswordBatch batch;
+    for (const char* password : {"longenough", "short", "alsolongenough", "tiny"}) {
+        batch.append(password);
+    }
+    validators::MinLengthValidator validator(8);
+    EXPECT_EQ(batch.findInvalid(validator), (std::vector<size_t>{1, 3}));
+}
+
+TEST(PasswordBatchTest, WipeZeroesAndClearEmpties) {
+    PasswordBatch batch;
+    batch.append("secret");
+    batch.append("hunter2");
+    batch.wipe();
+    EXPECT_EQ(batch.size(), 2u);
+    EXPECT_EQ(batch[0], std::string(6, '\0'));
+    EXPECT_EQ(batch[1], std::string(7, '\0'));
+
+    batch.clear();
+    EXPECT_TRUE(batch.empty());
+    batch.append("again");
+    EXPECT_EQ(batch.uniformLength(), 5u);
+    EXPECT_EQ(batch[0], "again");
+}
+
+TEST(PasswordBatchTest, MoveTransfersTheArena) {
+    PasswordBatch source(2, 3);
+    std::copy_n("abcdef", 6, source.data());
+    const char* arena = source.data();
+
+    PasswordBatch moved(std::move(source));
+    EXPECT_EQ(moved.data(), arena);
+    EXPECT_EQ(moved[1], "def");
+    EXPECT_TRUE(source.empty());
+
+    PasswordBatch assigned;
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned[0], "abc");
+    EXPECT_TRUE(moved.empty());
+}
+
+TEST(PasswordBatchTest, HugePageBackingHoldsTheSameData) {
+    const size_t count = PasswordBatch::ARENA_MAP_THRESHOLD / 16 + 1;
+    PasswordBatch batch(count, 16, PasswordBatch::Backing::HugePages);
+    ASSERT_EQ(batch.bytes(), count * 16);
+    std::fill_n(batch.data(), batch.bytes(), 'z');
+    EXPECT_EQ(batch[count - 1], std::string(16, 'z'));
+}
+
+TEST(PasswordBatchTest, AppendUniformReusesTheArenaAfterClear) {
+    PasswordBatch batch(PasswordBatch::Backing::HugePages);
+    std::copy_n("aaabbb", 6, batch.appendUniform(2, 3));
+    std::copy_n("ccc", 3, batch.appendUniform(1, 3));
+    EXPECT_EQ(batch.uniformLength(), 3u);
+    EXPECT_EQ(batch[2], "ccc");
+
+    std::copy_n("dddddd", 6, batch.appendUniform(1, 6));
+    EXPECT_EQ(batch.uniformLength(), 0u);
+    EXPECT_EQ(batch[1], "bbb");
+    EXPECT_EQ(batch[3], "dddddd");
+
+    const char* arena = batch.data();
+    batch.clear();
+    std::copy_n("eeff", 4, batch.appendUniform(2, 2));
+    EXPECT_EQ(batch.data(), arena);
+    EXPECT_EQ(batch.uniformLength(), 2u);
+    EXPECT_EQ(batch[1], "ff");
+}
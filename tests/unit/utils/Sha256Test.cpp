@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include "utils/Sha256.h"
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+using namespace password_generator::utils;
+
+namespace {
+
+std::string toHex(const uint8_t* data, size_t length) {
+    std::string hex;
+    char byte[3];
+    for (size_t i = 0; i < length; ++i) {
+        std::snprintf(byte, sizeof(byte), "%02x", data[i]);
+        hex += byte;
+    }
+    return hex;
+}
+
+std::string toHex(const Sha256::Digest& digest) {
+    return toHex(digest.data(), digest.size());
+}
+
+} // namespace
+
+TEST(Sha256Test, MatchesFipsVectors) {
+    EXPECT_EQ(toHex(Sha256::hash("abc", 3)),
+              "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    EXPECT_EQ(toHex(Sha256::hash("", 0)),
+              "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+
+    const std::string twoBlocks =
+        "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    EXPECT_EQ(toHex(Sha256::hash(twoBlocks.data(), twoBlocks.size())),
+              "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+}
+
+TEST(Sha256Test, IncrementalUpdatesMatchOneShot) {
+    const std::string message(1000, 'x');
+    Sha256 sha;
+    for (size_t i = 0; i < message.size(); i += 37) {
+        sha.update(message.data() + i, std::min<size_t>(37, message.size() - i));
+    }
+    EXPECT_EQ(sha.finish(), Sha256::hash(message.data(), message.size()));
+}
+
+TEST(Sha256Test, HmacMatchesRfc4231) {
+    const std::string key(20, '\x0b');
+    EXPECT_EQ(toHex(hmacSha256(key.data(), key.size(), "Hi There", 8)),
+              "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7");
+
+    const std::string data = "what do ya want for nothing?";
+    EXPECT_EQ(toHex(hmacSha256("Jefe", 4, data.data(), data.size())),
+              "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843");
+}
+
+TEST(Sha256Test, Pbkdf2MatchesKnownVectors) {
+    uint8_t out[32];
+    pbkdf2HmacSha256("password", 8, "salt", 4, 1, out, sizeof(out));
+    EXPECT_EQ(toHex(out, sizeof(out)),
+              "120fb6cffcf8b32c43e7225256c4f837a86548c92ccc35480805987cb70be17b");
+
+    pbkdf2HmacSha256("password", 8, "salt", 4, 4096, out, sizeof(out));
+    EXPECT_EQ(toHex(out, sizeof(out)),
+              "c5e478d59288c841aa530db6845c4c8d962893a001ce4e11a4963873aa98134a");
+
+    EXPECT_THROW(pbkdf2HmacSha256("password", 8, "salt", 4, 0, out, sizeof(out)),
+                 std::invalid_argument);
+}
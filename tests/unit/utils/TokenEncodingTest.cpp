@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include "utils/Crc32.h"
+#include "utils/TokenEncoding.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace password_generator::utils;
+
+namespace {
+
+using Encoder = void (*)(const uint8_t*, size_t, char*);
+
+std::string encode(Encoder encoder, TokenEncoding encoding, const std::string& input) {
+    std::string out(encodedLength(encoding, input.size()), '\0');
+    encoder(reinterpret_cast<const uint8_t*>(input.data()), input.size(), &out[0]);
+    return out;
+}
+
+} // namespace
+
+TEST(TokenEncodingTest, Crc32MatchesCheckValues) {
+    EXPECT_EQ(crc32("123456789", 9), 0xCBF43926u);
+    EXPECT_EQ(crc32c("123456789", 9), 0xE3069283u);
+    EXPECT_EQ(crc32("", 0), 0u);
+
+    // A running checksum continues across calls
+    const std::string text(1000, 'q');
+    EXPECT_EQ(crc32(text.data() + 3, text.size() - 3, crc32(text.data(), 3)),
+              crc32(text.data(), text.size()));
+    EXPECT_EQ(crc32c(text.data() + 13, text.size() - 13, crc32c(text.data(), 13)),
+              crc32c(text.data(), text.size()));
+}
+
+TEST(TokenEncodingTest, MatchesRfc4648Vectors) {
+    const char* inputs[] = {"", "f", "fo", "foo", "foob", "fooba", "foobar"};
+    const char* base32[] = {"", "MY", "MZXQ", "MZXW6", "MZXW6YQ", "MZXW6YTB", "MZXW6YTBOI"};
+    const char* base64[] = {"", "Zg", "Zm8", "Zm9v", "Zm9vYg", "Zm9vYmE", "Zm9vYmFy"};
+    const char* hex[] = {"", "66", "666f", "666f6f", "666f6f62", "666f6f6261", "666f6f626172"};
+    for (size_t i = 0; i < 7; ++i) {
+        EXPECT_EQ(encode(encodeBase32, TokenEncoding::Base32, inputs[i]), base32[i]);
+        EXPECT_EQ(encode(encodeBase64Url, TokenEncoding::Base64Url, inputs[i]), base64[i]);
+        EXPECT_EQ(encode(encodeHex, TokenEncoding::Hex, inputs[i]), hex[i]);
+    }
+
+    // The URL-safe alphabet replaces + and /
+    EXPECT_EQ(encode(encodeBase64Url, TokenEncoding::Base64Url, "\xfb\xff\xbf"), "-_-_");
+}
+
+TEST(TokenEncodingTest, SimdPathsMatchScalarAtEveryLength) {
+    // Lengths around every block size and tail of the SSSE3 and AVX2 loops
+    std::string input(300, '\0');
+    uint32_t state = 12345;
+    for (char& c : input) {
+        state = state * 1664525u + 1013904223u;
+        c = static_cast<char>(state >> 24);
+    }
+    for (size_t length = 0; length <= input.size(); ++length) {
+        const std::string prefix = input.substr(0, length);
+        EXPECT_EQ(encode(encodeHex, TokenEncoding::Hex, prefix),
+                  encode(encodeHexScalar, TokenEncoding::Hex, prefix)) << length;
+        EXPECT_EQ(encode(encodeBase32, TokenEncoding::Base32, prefix),
+                  encode(encodeBase32Scalar, TokenEncoding::Base32, prefix)) << length;
+        EXPECT_EQ(encode(encodeBase64Url, TokenEncoding::Base64Url, prefix),
+                  encode(encodeBase64UrlScalar, TokenEncoding::Base64Url, prefix)) << length;
+    }
+}
+
+TEST(TokenEncodingTest, FixedWidthRoundTrips) {
+    const TokenEncoding encodings[] = {TokenEncoding::Hex, TokenEncoding::Base32,
+                                       TokenEncoding::Base58, TokenEncoding::Base64Url};
+    for (TokenEncoding encoding : encodings) {
+        for (uint64_t value : {uint64_t(0), uint64_t(57), uint64_t(0xFFFFFFFF)}) {
+            char digits[8];
+            encodeFixedWidth(encoding, value, 8, digits);
+            uint64_t decoded;
+            ASSERT_TRUE(decodeFixedWidth(encoding, digits, 8, decoded));
+            EXPECT_EQ(decoded, value);
+        }
+    }
+    char digits[8];
+    encodeFixedWidth(TokenEncoding::Hex, 0xCBF43926u, 8, digits);
+    EXPECT_EQ(std::string(digits, 8), "cbf43926");
+
+    uint64_t decoded;
+    EXPECT_FALSE(decodeFixedWidth(TokenEncoding::Base58, "10O", 3, decoded));
+
+    // 32 bytes carry 256 bits; 43 base58 characters carry 252.2
+    EXPECT_EQ(encodedLength(TokenEncoding::Base58, 32), 44u);
+    EXPECT_EQ(encodedLength(TokenEncoding::Base64Url, 32), 43u);
+    EXPECT_EQ(encodedLength(TokenEncoding::Base32, 32), 52u);
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include "utils/UnicodeCategory.h"
+#include "utils/Utf8.h"
+#include "utils/Utf8Alphabet.h"
+
+using namespace password_generator::utils;
+
+TEST(Utf8Test, DecodesAndEncodes) {
+    const std::string text = "a\xc3\xa9\xd0\x96\xe2\x82\xac\xf0\x9f\x94\x91";  // a é Ж € 🔑
+    const char32_t expected[] = {U'a', 0xe9, 0x416, 0x20ac, 0x1f511};
+    size_t pos = 0;
+    for (char32_t want : expected) {
+        char32_t got;
+        ASSERT_TRUE(decodeUtf8(text, pos, got));
+        EXPECT_EQ(got, want);
+        char encoded[4];
+        size_t length = encodeUtf8(got, encoded);
+        EXPECT_EQ(std::string(encoded, length), text.substr(pos - length, length));
+    }
+    EXPECT_EQ(pos, text.size());
+    EXPECT_EQ(utf8Length(text), 5u);
+
+    // Overlong, truncated, surrogate and stray continuation bytes count one each
+    const std::string bad = "\xc0\xaf" "\xe2\x82" "\xed\xa0\x80" "\x80";
+    pos = 0;
+    char32_t codePoint;
+    EXPECT_FALSE(decodeUtf8(bad, pos, codePoint));
+    EXPECT_EQ(pos, 1u);
+    EXPECT_EQ(utf8Length(bad), bad.size());
+    char out[4];
+    EXPECT_EQ(encodeUtf8(0xd800, out), 0u);
+    EXPECT_EQ(encodeUtf8(0x110000, out), 0u);
+}
+
+TEST(Utf8Test, ClassifiesFromTable) {
+    EXPECT_EQ(unicodeCategory(U'A'), UnicodeCategory::UPPERCASE);
+    EXPECT_EQ(unicodeCategory(U'z'), UnicodeCategory::LOWERCASE);
+    EXPECT_EQ(unicodeCategory(U'5'), UnicodeCategory::DIGIT);
+    EXPECT_EQ(unicodeCategory(U'#'), UnicodeCategory::SYMBOL);
+    EXPECT_EQ(unicodeCategory(U' '), UnicodeCategory::OTHER);
+    EXPECT_EQ(unicodeCategory(0xc9), UnicodeCategory::UPPERCASE);  // É
+    EXPECT_EQ(unicodeCategory(0xdf), UnicodeCategory::LOWERCASE);  // ß
+    EXPECT_EQ(unicodeCategory(0xd7), UnicodeCategory::SYMBOL);     // ×
+    EXPECT_EQ(unicodeCategory(0x141), UnicodeCategory::UPPERCASE); // Ł
+    EXPECT_EQ(unicodeCategory(0x142), UnicodeCategory::LOWERCASE); // ł
+    EXPECT_EQ(unicodeCategory(0x160), UnicodeCategory::UPPERCASE); // Š
+    EXPECT_EQ(unicodeCategory(0x3a9), UnicodeCategory::UPPERCASE); // Ω
+    EXPECT_EQ(unicodeCategory(0x3c2), UnicodeCategory::LOWERCASE); // ς
+    EXPECT_EQ(unicodeCategory(0x401), UnicodeCategory::UPPERCASE); // Ё
+    EXPECT_EQ(unicodeCategory(0x44f), UnicodeCategory::LOWERCASE); // я
+    EXPECT_EQ(unicodeCategory(0x200b), UnicodeCategory::OTHER);    // zero-width space
+    EXPECT_EQ(unicodeCategory(0x110000), UnicodeCategory::OTHER);
+}
+
+TEST(Utf8AlphabetTest, StoresPreEncodedSlots) {
+    Utf8Alphabet cyrillic = Utf8Alphabet::named("cyrillic");
+    EXPECT_EQ(cyrillic.size(), 66u);
+    EXPECT_EQ(cyrillic.stride(), 2u);
+    EXPECT_EQ(Utf8Alphabet::named("latin1").size(), 62u);
+    EXPECT_EQ(Utf8Alphabet::named("latin-ext").size(), 128u);
+    EXPECT_EQ(Utf8Alphabet::named("greek").size(), 49u);
+    for (const std::string& name : Utf8Alphabet::names()) {
+        EXPECT_FALSE(Utf8Alphabet::named(name).empty()) << name;
+    }
+    EXPECT_THROW(Utf8Alphabet::named("emoji"), std::invalid_argument);
+
+    Utf8Alphabet mixed = Utf8Alphabet::fromString("b\xc3\xa9" "a\xe2\x82\xac" "a");
+    EXPECT_EQ(mixed.size(), 4u);
+    EXPECT_EQ(mixed.stride(), 0u);
+    EXPECT_EQ(mixed.maxEncodedLength(), 3u);
+    EXPECT_EQ(mixed.toString(), "ab\xc3\xa9\xe2\x82\xac");
+
+    char out[4];
+    ASSERT_EQ(mixed.copyTo(2, out), 2u);
+    EXPECT_EQ(std::string(out, 2), "\xc3\xa9");
+
+    mixed.merge(Utf8Alphabet::fromRange(U'a', U'c'));
+    EXPECT_EQ(mixed.toString(), "abc\xc3\xa9\xe2\x82\xac");
+
+    EXPECT_THROW(Utf8Alphabet::fromString("a b"), std::invalid_argument);
+    EXPECT_THROW(Utf8Alphabet::fromString("\xc3"), std::invalid_argument);
+    EXPECT_EQ(Utf8Alphabet::fromRange(0x7e, 0xa1).size(), 2u);  // ~ and ¡ around controls
+}
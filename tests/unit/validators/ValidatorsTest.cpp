@@ -30,4 +30,28 @@ TEST(CharacterTypeValidatorTest, ValidatesCharacterTypes) {
     EXPECT_FALSE(validator.validate("ABC123!@#"));  // No lowercase
     EXPECT_FALSE(validator.validate("Abc!@#"));     // No digits
     EXPECT_FALSE(validator.validate("Abc123"));     // No symbols
-}
\ No newline at end of file
+}
+
+TEST(CharacterTypeValidatorTest, ClassifiesWithoutLocale) {
+    EXPECT_EQ(CharacterTypeValidator::typeOf('Q'), CharacterTypeValidator::UPPERCASE);
+    EXPECT_EQ(CharacterTypeValidator::typeOf('q'), CharacterTypeValidator::LOWERCASE);
+    EXPECT_EQ(CharacterTypeValidator::typeOf('7'), CharacterTypeValidator::DIGIT);
+    EXPECT_EQ(CharacterTypeValidator::typeOf(' '), CharacterTypeValidator::SYMBOL);
+    EXPECT_EQ(CharacterTypeValidator::typeOf('\xe9'), CharacterTypeValidator::SYMBOL);
+
+    CharacterTypeValidator validator(false, true, true, false);
+    EXPECT_EQ(validator.getRequiredTypes(),
+              unsigned(CharacterTypeValidator::LOWERCASE | CharacterTypeValidator::DIGIT));
+}
+
+TEST(CharacterTypeValidatorTest, ClassifiesUtf8CodePoints) {
+    CharacterTypeValidator validator(true, true, true, false);
+    EXPECT_TRUE(validator.validate("\xc3\x89\xc3\xa9" "1"));    // É é 1
+    EXPECT_TRUE(validator.validate("\xd0\x96\xd0\xb6" "7"));    // Ж ж 7
+    EXPECT_FALSE(validator.validate("\xc3\xa9\xd0\xb6" "1"));   // no upper case
+    EXPECT_FALSE(validator.validate("\xc9\xe9" "1"));           // Latin-1 bytes are not UTF-8
+
+    MaxLengthValidator maxLength(3);
+    EXPECT_TRUE(maxLength.validate("\xc3\x89\xc3\xa9\xd0\x96"));  // 3 code points, 6 bytes
+    EXPECT_FALSE(maxLength.validate("\xc3\x89\xc3\xa9\xd0\x96!"));
+}
@@ -0,0 +1,103 @@
+#include "strategies/WordList.h"
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using password_generator::strategies::WordList;
+
+namespace {
+
+void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " [options] -o LIST [WORDS...]\n"
+              << "\n"
+              << "Compile word lists for PassphrasePasswordStrategy.\n"
+              << "Each line holds one word; when a line has several fields (as in the\n"
+              << "EFF dice lists) the last one is used. Empty lines and lines starting\n"
+              << "with '#' are skipped, duplicates are removed. Reads standard input\n"
+              << "when no file is given.\n"
+              << "\n"
+              << "Options:\n"
+              << "  -o, --output FILE   Write the compiled list to FILE\n"
+              << "  --lowercase         Fold ASCII letters to lowercase\n"
+              << "  -h, --help          Show this help\n";
+}
+
+void readWords(std::istream& in, bool lowercase, std::vector<std::string>& words) {
+    std::string line;
+    while (std::getline(in, line)) {
+        std::istringstream fields(line);
+        std::string field, word;
+        while (fields >> field) {
+            word = field;
+        }
+        if (word.empty() || line[line.find_first_not_of(" \t")] == '#') {
+            continue;
+        }
+        if (lowercase) {
+            for (char& c : word) {
+                if (c >= 'A' && c <= 'Z') {
+                    c = static_cast<char>(c - 'A' + 'a');
+                }
+            }
+        }
+        words.push_back(std::move(word));
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string output;
+    bool lowercase = false;
+    std::vector<std::string> inputs;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if ((arg == "-o" || arg == "--output") && i + 1 < argc) {
+            output = argv[++i];
+        } else if (arg == "--lowercase") {
+            lowercase = true;
+        } else if (arg == "-h" || arg == "--help") {
+            printUsage(argv[0]);
+            return 0;
+        } else if (!arg.empty() && arg[0] == '-') {
+            std::cerr << "Error: Unknown option " << arg << "\n";
+            printUsage(argv[0]);
+            return 1;
+        } else {
+            inputs.push_back(arg);
+        }
+    }
+    if (output.empty()) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::vector<std::string> words;
+    if (inputs.empty()) {
+        readWords(std::cin, lowercase, words);
+    }
+    for (const auto& path : inputs) {
+        std::ifstream in(path);
+        if (!in) {
+            std::cerr << "Error: Cannot open " << path << "\n";
+            return 1;
+        }
+        readWords(in, lowercase, words);
+    }
+
+    try {
+        const size_t read = words.size();
+        WordList::write(std::move(words), output);
+        auto list = WordList::load(output);
+        std::cerr << "Compiled " << list->size() << " distinct words (" << read - list->size()
+                  << " duplicates dropped) -> " << output << "\n";
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}